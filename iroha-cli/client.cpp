@@ -48,6 +48,25 @@ namespace iroha_cli {
     return response;
   }
 
+  CliClient::Response<CliClient::TxStatus> CliClient::sendTxList(
+      const iroha::protocol::TxList &tx_list) {
+    CliClient::Response<CliClient::TxStatus> response;
+    response.status = command_client_.ListTorii(tx_list);
+    response.answer = TxStatus::OK;
+    return response;
+  }
+
+  void CliClient::followTxStatuses(
+      const std::vector<std::string> &tx_hashes,
+      const std::function<void(const iroha::protocol::ToriiResponse &)>
+          &on_status) {
+    iroha::protocol::TxStatusListRequest request;
+    for (const auto &hash : tx_hashes) {
+      request.add_tx_hashes(hash);
+    }
+    command_client_.ListStatusStream(request, on_status);
+  }
+
   CliClient::Response<iroha::protocol::QueryResponse> CliClient::sendQuery(
       const shared_model::interface::Query &query) {
     CliClient::Response<iroha::protocol::QueryResponse> response;
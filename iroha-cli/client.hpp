@@ -6,7 +6,9 @@
 #ifndef IROHACLI_CLIENT_HPP
 #define IROHACLI_CLIENT_HPP
 
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "torii/command_client.hpp"
 #include "torii/query_client.hpp"
@@ -51,6 +53,25 @@ namespace iroha_cli {
     CliClient::Response<iroha::protocol::ToriiResponse> getTxStatus(
         std::string tx_hash);
 
+    /**
+     * Send list of transactions to Iroha Peer with a single request
+     * @param tx_list - transactions to send
+     * @return status of the request
+     */
+    CliClient::Response<CliClient::TxStatus> sendTxList(
+        const iroha::protocol::TxList &tx_list);
+
+    /**
+     * Follow statuses of transactions until all of them are final or the
+     * peer closes the stream
+     * @param tx_hashes - hex hashes of transactions to follow
+     * @param on_status - called with every status as soon as it arrives
+     */
+    void followTxStatuses(
+        const std::vector<std::string> &tx_hashes,
+        const std::function<void(const iroha::protocol::ToriiResponse &)>
+            &on_status);
+
    private:
     torii::CommandSyncClient command_client_;
     torii_utils::QuerySyncClient query_client_;
@@ -0,0 +1,151 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+namespace iroha_cli {
+
+  LatencyHistogram::LatencyHistogram(int significant_digits)
+      : total_count_(0),
+        min_(std::numeric_limits<uint64_t>::max()),
+        max_(0),
+        sum_(0) {
+    significant_digits = std::min(std::max(significant_digits, 1), 5);
+    // every value below this one is recorded exactly
+    const auto single_unit_resolution_limit =
+        2 * static_cast<uint64_t>(std::pow(10, significant_digits));
+    const auto sub_bucket_count_magnitude = static_cast<int>(
+        std::ceil(std::log2(static_cast<double>(single_unit_resolution_limit))));
+    sub_bucket_half_count_magnitude_ = sub_bucket_count_magnitude - 1;
+    sub_bucket_half_count_ = uint64_t(1) << sub_bucket_half_count_magnitude_;
+    sub_bucket_mask_ = (uint64_t(1) << sub_bucket_count_magnitude) - 1;
+    counts_.resize(sub_bucket_mask_ + 1);
+  }
+
+  void LatencyHistogram::record(uint64_t value) {
+    auto index = indexOf(value);
+    if (index >= counts_.size()) {
+      counts_.resize(index + 1);
+    }
+    ++counts_[index];
+    ++total_count_;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    sum_ += value;
+  }
+
+  uint64_t LatencyHistogram::count() const {
+    return total_count_;
+  }
+
+  uint64_t LatencyHistogram::min() const {
+    return total_count_ == 0 ? 0 : min_;
+  }
+
+  uint64_t LatencyHistogram::max() const {
+    return max_;
+  }
+
+  double LatencyHistogram::mean() const {
+    return total_count_ == 0 ? 0 : sum_ / total_count_;
+  }
+
+  uint64_t LatencyHistogram::valueAtPercentile(double percentile) const {
+    if (total_count_ == 0) {
+      return 0;
+    }
+    percentile = std::min(std::max(percentile, 0.), 100.);
+    auto count_at_percentile = static_cast<uint64_t>(
+        std::ceil(percentile / 100 * static_cast<double>(total_count_)));
+    count_at_percentile =
+        std::min(std::max(count_at_percentile, uint64_t(1)), total_count_);
+    uint64_t total = 0;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+      total += counts_[i];
+      if (total >= count_at_percentile) {
+        return std::min(highestEquivalentValue(i), max_);
+      }
+    }
+    return max_;
+  }
+
+  void LatencyHistogram::printPercentileDistribution(std::ostream &os,
+                                                     double scale) const {
+    constexpr int kTicksPerHalfDistance = 5;
+    os << std::setw(12) << "Value" << std::setw(15) << "Percentile"
+       << std::setw(12) << "TotalCount" << std::setw(18) << "1/(1-Percentile)"
+       << "\n\n";
+    if (total_count_ == 0) {
+      return;
+    }
+
+    auto print_line = [&](double percentile, uint64_t value, uint64_t count) {
+      os << std::fixed << std::setprecision(3) << std::setw(12)
+         << value / scale << std::setprecision(6) << std::setw(15)
+         << percentile / 100 << std::setw(12) << count;
+      if (percentile < 100) {
+        os << std::setprecision(2) << std::setw(18)
+           << 100 / (100 - percentile);
+      }
+      os << "\n";
+    };
+
+    double percentile = 0;
+    size_t index = 0;
+    uint64_t count = 0;
+    while (true) {
+      auto value = valueAtPercentile(percentile);
+      while (index < counts_.size() and lowestEquivalentValue(index) <= value) {
+        count += counts_[index++];
+      }
+      if (count == total_count_) {
+        print_line(100, max_, count);
+        break;
+      }
+      print_line(percentile, value, count);
+
+      auto half_distance =
+          std::floor(std::log2(100 / (100 - percentile))) + 1;
+      percentile +=
+          100 / (kTicksPerHalfDistance * std::pow(2, half_distance));
+    }
+
+    os << std::setprecision(3) << "#[Mean = " << mean() / scale
+       << ", Max = " << max_ / scale << ", Total count = " << total_count_
+       << "]\n";
+  }
+
+  size_t LatencyHistogram::indexOf(uint64_t value) const {
+    const int pow2_ceiling = 64 - __builtin_clzll(value | sub_bucket_mask_);
+    const int bucket_index =
+        pow2_ceiling - (sub_bucket_half_count_magnitude_ + 1);
+    const auto sub_bucket_index = value >> bucket_index;
+    return ((static_cast<size_t>(bucket_index) + 1)
+            << sub_bucket_half_count_magnitude_)
+        + (sub_bucket_index - sub_bucket_half_count_);
+  }
+
+  uint64_t LatencyHistogram::lowestEquivalentValue(size_t index) const {
+    int bucket_index =
+        static_cast<int>(index >> sub_bucket_half_count_magnitude_) - 1;
+    auto sub_bucket_index =
+        (index & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+    if (bucket_index < 0) {
+      sub_bucket_index -= sub_bucket_half_count_;
+      bucket_index = 0;
+    }
+    return static_cast<uint64_t>(sub_bucket_index) << bucket_index;
+  }
+
+  uint64_t LatencyHistogram::highestEquivalentValue(size_t index) const {
+    return lowestEquivalentValue(index + 1) - 1;
+  }
+
+}  // namespace iroha_cli
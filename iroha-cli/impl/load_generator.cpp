@@ -0,0 +1,379 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load_generator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <thread>
+
+#include "backend/protobuf/transaction.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "client.hpp"
+#include "datetime/time.hpp"
+
+namespace {
+  /// number of hashes followed by one status stream
+  constexpr size_t kHashesPerStream = 10000;
+  /// delay before following statuses again if the stream brought nothing
+  constexpr std::chrono::milliseconds kFollowRetryDelay(100);
+
+  /// period of checking status timeouts while waiting in the closed loop
+  constexpr std::chrono::milliseconds kTimeoutCheckPeriod(100);
+
+  double seconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double>(duration).count();
+  }
+
+  /// transport over the command service of a peer
+  class CliClientTransport : public iroha_cli::LoadGenerator::Transport {
+   public:
+    CliClientTransport(const std::string &peer_ip, int torii_port)
+        : client_(peer_ip, torii_port) {}
+
+    boost::optional<std::string> sendTxList(
+        const iroha::protocol::TxList &tx_list) override {
+      auto response = client_.sendTxList(tx_list);
+      if (not response.status.ok()) {
+        return response.status.error_message();
+      }
+      return boost::none;
+    }
+
+    void followTxStatuses(
+        const std::vector<std::string> &tx_hashes,
+        const std::function<void(const iroha::protocol::ToriiResponse &)>
+            &on_status) override {
+      client_.followTxStatuses(tx_hashes, on_status);
+    }
+
+   private:
+    iroha_cli::CliClient client_;
+  };
+}  // namespace
+
+namespace iroha_cli {
+
+  LoadGenerator::LoadGenerator(Config config, logger::Logger log)
+      : LoadGenerator(config,
+                      [peer_ip = config.peer_ip, port = config.torii_port] {
+                        return std::make_unique<CliClientTransport>(peer_ip,
+                                                                    port);
+                      },
+                      std::move(log)) {}
+
+  LoadGenerator::LoadGenerator(Config config,
+                               TransportFactory transport_factory,
+                               logger::Logger log)
+      : config_(std::move(config)),
+        transport_factory_(std::move(transport_factory)),
+        log_(std::move(log)),
+        in_flight_(0),
+        finished_(0),
+        sending_finished_(false) {
+    config_.batch_size = std::max<size_t>(config_.batch_size, 1);
+    config_.max_in_flight = std::max<size_t>(config_.max_in_flight, 1);
+    config_.senders = std::max<size_t>(config_.senders, 1);
+  }
+
+  void LoadGenerator::run() {
+    auto generation_start = Clock::now();
+    generate();
+    log_->info("Generated and signed {} transactions in {} s",
+               hashes_.size(),
+               seconds(Clock::now() - generation_start));
+
+    progress_.assign(hashes_.size(), Progress{});
+    latencies_.assign(kStagesCount, LatencyHistogram());
+    std::vector<std::thread> followers;
+    for (size_t begin = 0; begin < hashes_.size();
+         begin += kHashesPerStream) {
+      followers.emplace_back([this, begin] {
+        this->follow(begin,
+                     std::min(begin + kHashesPerStream, hashes_.size()));
+      });
+    }
+    send();
+    for (auto &follower : followers) {
+      follower.join();
+    }
+  }
+
+  void LoadGenerator::generate() {
+    const auto count = config_.transactions;
+    const auto quorum = config_.keypairs.size();
+    const auto batches = (count + config_.batch_size - 1) / config_.batch_size;
+    requests_.assign(batches, std::vector<iroha::protocol::TxList>(quorum));
+    hashes_.resize(count);
+
+    // transactions are created in the past, so that a long load is not
+    // rejected for a creation time in the future
+    const auto created_time = iroha::time::now();
+    const auto threads =
+        std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<std::thread> workers;
+    for (size_t thread = 0; thread < threads; ++thread) {
+      workers.emplace_back([&, thread] {
+        for (auto batch = thread; batch < batches; batch += threads) {
+          const auto end = std::min((batch + 1) * config_.batch_size, count);
+          for (auto i = batch * config_.batch_size; i < end; ++i) {
+            auto tx = shared_model::proto::TransactionBuilder()
+                          .creatorAccountId(config_.account_id)
+                          .createdTime(created_time - i)
+                          .quorum(quorum)
+                          .setAccountDetail(config_.account_id,
+                                            "bench",
+                                            std::to_string(i))
+                          .build();
+            hashes_[i] = tx.hash().hex();
+            for (size_t key = 0; key < quorum; ++key) {
+              auto signed_tx = tx;
+              *requests_[batch][key].add_transactions() =
+                  signed_tx.signAndAddSignature(config_.keypairs[key])
+                      .finish()
+                      .getTransport();
+            }
+          }
+        }
+      });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+
+    // peers report the hashes of the statuses in hex
+    indices_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      indices_.emplace(hashes_[i], i);
+    }
+  }
+
+  void LoadGenerator::send() {
+    const auto count = hashes_.size();
+    std::atomic<size_t> next_batch{0};
+    start_ = Clock::now();
+
+    auto sender = [&] {
+      auto transport = transport_factory_();
+      while (true) {
+        const auto batch = next_batch++;
+        if (batch >= requests_.size()) {
+          return;
+        }
+        const auto begin = batch * config_.batch_size;
+        const auto end = std::min(begin + config_.batch_size, count);
+
+        Clock::time_point sent;
+        if (config_.rate > 0) {
+          // latencies of the open loop are measured from the scheduled time,
+          // so that a delayed request does not hide its delay
+          sent = start_
+              + std::chrono::duration_cast<Clock::duration>(
+                     std::chrono::duration<double>(begin / config_.rate));
+          std::this_thread::sleep_until(sent);
+        }
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          if (config_.rate <= 0) {
+            auto can_send = [&] {
+              return in_flight_ == 0
+                  or in_flight_ + (end - begin) <= config_.max_in_flight;
+            };
+            while (not can_send()) {
+              progress_cv_.wait_for(lock, kTimeoutCheckPeriod);
+              expireOverdue(Clock::now());
+            }
+            sent = Clock::now();
+          }
+          for (auto i = begin; i < end; ++i) {
+            progress_[i].sent = sent;
+            in_flight_order_.push_back(i);
+          }
+          in_flight_ += end - begin;
+        }
+
+        for (const auto &request : requests_[batch]) {
+          if (auto error = transport->sendTxList(request)) {
+            markUnsent(batch, *error);
+            break;
+          }
+        }
+      }
+    };
+
+    std::vector<std::thread> senders;
+    for (size_t i = 0; i < config_.senders; ++i) {
+      senders.emplace_back(sender);
+    }
+    for (auto &thread : senders) {
+      thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    sending_finished_ = true;
+    sent_ = Clock::now();
+    log_->info("Sent {} transactions in {} s", count, seconds(sent_ - start_));
+  }
+
+  void LoadGenerator::follow(size_t begin, size_t end) {
+    auto transport = transport_factory_();
+    while (true) {
+      std::vector<std::string> remaining;
+      bool sending_finished;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        expireOverdue(Clock::now());
+        for (auto i = begin; i < end; ++i) {
+          if (not progress_[i].final) {
+            remaining.push_back(hashes_[i]);
+          }
+        }
+        sending_finished = sending_finished_;
+      }
+      if (remaining.empty()) {
+        return;
+      }
+
+      size_t updates = 0;
+      transport->followTxStatuses(remaining, [&](const auto &response) {
+        if (this->onStatus(response)) {
+          ++updates;
+        }
+      });
+      if (updates == 0) {
+        if (sending_finished) {
+          log_->warn("{} transactions did not reach a final status",
+                     remaining.size());
+          return;
+        }
+        std::this_thread::sleep_for(kFollowRetryDelay);
+      }
+    }
+  }
+
+  bool LoadGenerator::onStatus(
+      const iroha::protocol::ToriiResponse &response) {
+    using iroha::protocol::TxStatus;
+
+    auto index = indices_.find(response.tx_hash());
+    if (index == indices_.end()) {
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &progress = progress_[index->second];
+    if (progress.final) {
+      return false;
+    }
+    const auto now = Clock::now();
+    const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                             now - progress.sent)
+                             .count();
+    // statuses may be coalesced by the peer, so a stage which was not
+    // reported is considered passed not later than the next one
+    auto reach = [&](int stage) {
+      while (progress.stages <= stage) {
+        latencies_[progress.stages++].record(std::max<int64_t>(latency, 0));
+      }
+    };
+    auto finish = [&](const std::string &status) {
+      this->finish(progress, status);
+      end_ = now;
+    };
+
+    const auto status = response.tx_status();
+    switch (status) {
+      case TxStatus::NOT_RECEIVED:
+        return false;
+      case TxStatus::STATELESS_VALIDATION_SUCCESS:
+        reach(kStatelessValid);
+        break;
+      case TxStatus::STATEFUL_VALIDATION_SUCCESS:
+        reach(kStatefulValid);
+        break;
+      case TxStatus::COMMITTED:
+        reach(kCommitted);
+        finish(iroha::protocol::TxStatus_Name(status));
+        break;
+      case TxStatus::MST_PENDING:
+      case TxStatus::ENOUGH_SIGNATURES_COLLECTED:
+        break;
+      default:
+        finish(iroha::protocol::TxStatus_Name(status));
+        break;
+    }
+    return true;
+  }
+
+  void LoadGenerator::markUnsent(size_t batch, const std::string &reason) {
+    log_->error("Failed to send batch {}: {}", batch, reason);
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto begin = batch * config_.batch_size;
+    const auto end = std::min(begin + config_.batch_size, progress_.size());
+    for (auto i = begin; i < end; ++i) {
+      if (not progress_[i].final) {
+        finish(progress_[i], "NOT_SENT");
+      }
+    }
+  }
+
+  void LoadGenerator::finish(Progress &progress, const std::string &status) {
+    progress.final = true;
+    --in_flight_;
+    ++finished_;
+    ++final_statuses_[status];
+    progress_cv_.notify_all();
+  }
+
+  void LoadGenerator::expireOverdue(Clock::time_point now) {
+    if (config_.status_timeout.count() <= 0) {
+      return;
+    }
+    // transactions are sent nearly in order of their sending time, so the
+    // oldest ones are at the front
+    while (not in_flight_order_.empty()) {
+      auto &progress = progress_[in_flight_order_.front()];
+      if (not progress.final) {
+        if (now - progress.sent < config_.status_timeout) {
+          return;
+        }
+        finish(progress, "TIMEOUT");
+      }
+      in_flight_order_.pop_front();
+    }
+  }
+
+  void LoadGenerator::printReport(std::ostream &os) const {
+    static const char *kStageNames[] = {
+        "stateless validation", "stateful validation", "commit"};
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto count = hashes_.size();
+    if (latencies_.empty()) {
+      return;
+    }
+    const auto committed = latencies_[kCommitted].count();
+    const auto send_time = seconds(sent_ - start_);
+    const auto total_time = seconds(std::max(end_, sent_) - start_);
+    os << std::fixed << std::setprecision(2) << "Sent " << count
+       << " transactions in " << send_time << " s, "
+       << (send_time > 0 ? count / send_time : 0) << " tx/s\n"
+       << "Committed " << committed << " transactions in " << total_time
+       << " s, " << (total_time > 0 ? committed / total_time : 0)
+       << " tx/s\n";
+    for (const auto &status : final_statuses_) {
+      os << "  " << status.first << ": " << status.second << "\n";
+    }
+    if (finished_ < count) {
+      os << "  without final status: " << count - finished_ << "\n";
+    }
+    for (int stage = 0; stage < kStagesCount; ++stage) {
+      os << "\nLatency of " << kStageNames[stage] << ", ms\n";
+      latencies_[stage].printPercentileDistribution(os, 1000);
+    }
+  }
+
+}  // namespace iroha_cli
@@ -0,0 +1,76 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLI_LATENCY_HISTOGRAM_HPP
+#define IROHA_CLI_LATENCY_HISTOGRAM_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace iroha_cli {
+
+  /**
+   * Histogram of latencies with high dynamic range: values are kept in
+   * buckets of powers of two, and every bucket is split linearly, so each
+   * value is recorded with a fixed relative precision regardless of its
+   * magnitude. The layout follows HdrHistogram.
+   */
+  class LatencyHistogram {
+   public:
+    /**
+     * @param significant_digits - number of decimal digits of a value which
+     * are kept, from 1 to 5
+     */
+    explicit LatencyHistogram(int significant_digits = 3);
+
+    /**
+     * Record a value
+     * @param value - value, which is usually a latency in microseconds
+     */
+    void record(uint64_t value);
+
+    uint64_t count() const;
+
+    uint64_t min() const;
+
+    uint64_t max() const;
+
+    double mean() const;
+
+    /**
+     * @param percentile - percentile from 0 to 100
+     * @return largest value, which is equivalent to the value at percentile
+     */
+    uint64_t valueAtPercentile(double percentile) const;
+
+    /**
+     * Print percentile distribution in the format of HdrHistogram: five
+     * percentiles per every halving of the remaining distance to 100%
+     * @param os - stream to print to
+     * @param scale - divisor of values, e.g. 1000 for microseconds printed
+     * as milliseconds
+     */
+    void printPercentileDistribution(std::ostream &os, double scale) const;
+
+   private:
+    size_t indexOf(uint64_t value) const;
+    uint64_t lowestEquivalentValue(size_t index) const;
+    uint64_t highestEquivalentValue(size_t index) const;
+
+    int sub_bucket_half_count_magnitude_;
+    uint64_t sub_bucket_half_count_;
+    uint64_t sub_bucket_mask_;
+
+    std::vector<uint64_t> counts_;
+    uint64_t total_count_;
+    uint64_t min_;
+    uint64_t max_;
+    double sum_;
+  };
+
+}  // namespace iroha_cli
+
+#endif  // IROHA_CLI_LATENCY_HISTOGRAM_HPP
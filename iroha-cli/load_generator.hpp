@@ -0,0 +1,194 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLI_LOAD_GENERATOR_HPP
+#define IROHA_CLI_LOAD_GENERATOR_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "cryptography/keypair.hpp"
+#include "endpoint.pb.h"
+#include "latency_histogram.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha_cli {
+
+  /**
+   * Generates load of signed transactions on an Iroha peer and measures
+   * latencies of their statuses.
+   *
+   * Transactions set details of the creator account. All of them are
+   * generated and signed in advance on all cores, then sent with ListTorii
+   * in lists of the configured size by several senders, while their
+   * statuses are followed with ListStatusStream.
+   */
+  class LoadGenerator {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Config {
+      std::string peer_ip;
+      int torii_port;
+      /// creator of transactions
+      std::string account_id;
+      /**
+       * keys of the creator, the quorum of transactions is their number.
+       * With several keys every transaction is sent once per key with a
+       * single signature, so the peers collect signatures of multisignature
+       * transactions
+       */
+      std::vector<shared_model::crypto::Keypair> keypairs;
+      /// number of transactions to send
+      size_t transactions;
+      /// number of transactions in one ListTorii request
+      size_t batch_size;
+      /**
+       * transactions per second of the open loop; latencies are measured
+       * from the scheduled time of sending. If zero, the load is the closed
+       * loop with at most max_in_flight transactions without a final status
+       */
+      double rate;
+      size_t max_in_flight;
+      /// number of threads, which send requests concurrently
+      size_t senders;
+      /**
+       * time after sending, in which a transaction has to reach a final
+       * status; otherwise it is counted as failed with status TIMEOUT and no
+       * longer occupies the closed loop. Zero to wait indefinitely
+       */
+      std::chrono::milliseconds status_timeout{0};
+    };
+
+    /**
+     * Connection to the peer, which is used by one thread
+     */
+    class Transport {
+     public:
+      virtual ~Transport() = default;
+
+      /**
+       * Send transactions with ListTorii
+       * @return error message if the request failed
+       */
+      virtual boost::optional<std::string> sendTxList(
+          const iroha::protocol::TxList &tx_list) = 0;
+
+      /**
+       * Follow statuses of transactions until all of them are final or the
+       * peer closes the stream
+       * @param tx_hashes - hex hashes of transactions to follow
+       * @param on_status - called with every status as soon as it arrives
+       */
+      virtual void followTxStatuses(
+          const std::vector<std::string> &tx_hashes,
+          const std::function<void(const iroha::protocol::ToriiResponse &)>
+              &on_status) = 0;
+    };
+
+    using TransportFactory = std::function<std::unique_ptr<Transport>()>;
+
+    /**
+     * Generator which connects to config.peer_ip and config.torii_port
+     */
+    LoadGenerator(Config config,
+                  logger::Logger log = logger::log("LoadGenerator"));
+
+    /**
+     * @param transport_factory - creates a connection for every sending and
+     * following thread
+     */
+    LoadGenerator(Config config,
+                  TransportFactory transport_factory,
+                  logger::Logger log = logger::log("LoadGenerator"));
+
+    /**
+     * Generate transactions, send them and wait for their final statuses
+     */
+    void run();
+
+    /**
+     * Print throughput, numbers of statuses and latency histograms
+     * @param os - stream to print to
+     */
+    void printReport(std::ostream &os) const;
+
+   private:
+    /// stages of the pipeline, which are measured
+    enum Stage { kStatelessValid, kStatefulValid, kCommitted, kStagesCount };
+
+    /// state of one transaction
+    struct Progress {
+      Clock::time_point sent;
+      /// number of stages passed
+      int stages = 0;
+      bool final = false;
+    };
+
+    void generate();
+    void send();
+    void follow(size_t begin, size_t end);
+    /**
+     * Update progress of the transaction with the status
+     * @return false if the status is ignored, because the transaction is
+     * unknown, already has a final status or is not received by the peer,
+     * true otherwise
+     */
+    bool onStatus(const iroha::protocol::ToriiResponse &response);
+    /**
+     * Mark transactions of the batch as final without a status from the peer
+     */
+    void markUnsent(size_t batch, const std::string &reason);
+    /**
+     * Count the transaction as finished with the status; mutex_ has to be
+     * locked
+     */
+    void finish(Progress &progress, const std::string &status);
+    /**
+     * Finish transactions, which are in flight longer than the status
+     * timeout, with status TIMEOUT; mutex_ has to be locked
+     */
+    void expireOverdue(Clock::time_point now);
+
+    Config config_;
+    TransportFactory transport_factory_;
+    logger::Logger log_;
+
+    /// lists of transactions to send, one per batch and key
+    std::vector<std::vector<iroha::protocol::TxList>> requests_;
+    /// hex hashes of transactions in order of generation
+    std::vector<std::string> hashes_;
+    /// indices of transactions by their hex hashes
+    std::unordered_map<std::string, size_t> indices_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable progress_cv_;
+    std::vector<Progress> progress_;
+    size_t in_flight_;
+    /// transactions in order of sending, which may be still in flight
+    std::deque<size_t> in_flight_order_;
+    size_t finished_;
+    bool sending_finished_;
+    /// number of transactions by final status
+    std::map<std::string, size_t> final_statuses_;
+    std::vector<LatencyHistogram> latencies_;
+    Clock::time_point start_;
+    Clock::time_point sent_;
+    Clock::time_point end_;
+  };
+
+}  // namespace iroha_cli
+
+#endif  // IROHA_CLI_LOAD_GENERATOR_HPP
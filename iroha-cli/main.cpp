@@ -6,6 +6,7 @@
 #include <gflags/gflags.h>
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/rapidjson.h>
+#include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
 #include <iostream>
 
@@ -18,6 +19,7 @@
 #include "crypto/keys_manager_impl.hpp"
 #include "grpc_response_handler.hpp"
 #include "interactive/interactive_cli.hpp"
+#include "load_generator.hpp"
 #include "model/converters/json_block_factory.hpp"
 #include "model/converters/json_query_factory.hpp"
 #include "model/converters/pb_block_factory.hpp"
@@ -56,6 +58,35 @@ DEFINE_string(peers_address,
               "",
               "File with peers address for new Iroha network");
 
+// Generate load on Iroha peer
+DEFINE_bool(bench,
+            false,
+            "Send generated transactions of the account to Iroha peer and "
+            "measure latencies of their statuses");
+DEFINE_uint64(bench_transactions, 10000, "Number of transactions to send");
+DEFINE_uint64(bench_batch_size,
+              100,
+              "Number of transactions sent in one request");
+DEFINE_double(bench_rate,
+              0,
+              "Transactions per second to send regardless of responses, 0 to "
+              "keep bench_max_in_flight transactions in progress instead");
+DEFINE_uint64(bench_max_in_flight,
+              1000,
+              "Number of transactions without final status, when bench_rate "
+              "is 0");
+DEFINE_uint64(bench_senders, 4, "Number of concurrent senders of requests");
+DEFINE_uint64(bench_status_timeout,
+              60000,
+              "Milliseconds after sending, in which a transaction has to get "
+              "a final status; it is counted as failed otherwise. 0 to wait "
+              "indefinitely");
+DEFINE_string(bench_quorum_keys,
+              "",
+              "Comma-separated names of additional keys of the account in "
+              "key_path; transactions require signatures of all keys and are "
+              "sent once per key");
+
 // Run iroha-cli in interactive mode
 DEFINE_bool(interactive, true, "Run iroha-cli in interactive mode");
 
@@ -65,6 +96,31 @@ using namespace iroha::model::converters;
 using namespace iroha_cli::interactive;
 namespace fs = boost::filesystem;
 
+/**
+ * Load keypair with the pass phrase from the flags
+ * @param path - directory with keys
+ * @param name - name of keys
+ * @param logger - logger for errors
+ * @return keypair or none if it cannot be loaded
+ */
+boost::optional<shared_model::crypto::Keypair> loadKeypair(
+    const fs::path &path, const std::string &name, logger::Logger &logger) {
+  iroha::KeysManagerImpl manager((path / name).string());
+  auto keypair = FLAGS_pass_phrase.size() != 0
+      ? manager.loadKeys(FLAGS_pass_phrase)
+      : manager.loadKeys();
+  if (not keypair) {
+    logger->error(
+        "Cannot load specified keypair, or keypair is invalid. Path: {}, "
+        "keypair name: {}. Use --key_path with path of your keypair. \n"
+        "Maybe wrong pass phrase (\"{}\")?",
+        path.string(),
+        name,
+        FLAGS_pass_phrase);
+  }
+  return keypair;
+}
+
 iroha::keypair_t *makeOldModel(const shared_model::crypto::Keypair &keypair) {
   return new iroha::keypair_t{
       iroha::pubkey_t::from_string(toBinaryString(keypair.publicKey())),
@@ -189,6 +245,51 @@ int main(int argc, char *argv[]) {
       }
     }
   }
+  // Send generated transactions to Iroha peer and measure latencies
+  else if (FLAGS_bench) {
+    if (FLAGS_account_name.empty()) {
+      logger->error("Specify your account name");
+      return EXIT_FAILURE;
+    }
+    fs::path path(FLAGS_key_path);
+    if (not fs::exists(path)) {
+      logger->error("Path {} not found.", path.string());
+      return EXIT_FAILURE;
+    }
+    std::vector<std::string> key_names{FLAGS_account_name};
+    if (not FLAGS_bench_quorum_keys.empty()) {
+      boost::split(key_names,
+                   FLAGS_bench_quorum_keys,
+                   boost::is_any_of(","),
+                   boost::token_compress_on);
+      key_names.insert(key_names.begin(), FLAGS_account_name);
+    }
+    iroha_cli::LoadGenerator::Config config;
+    for (const auto &name : key_names) {
+      auto keypair = loadKeypair(path, name, logger);
+      if (not keypair) {
+        return EXIT_FAILURE;
+      }
+      config.keypairs.push_back(*keypair);
+    }
+    config.peer_ip = FLAGS_peer_ip;
+    config.torii_port = FLAGS_torii_port;
+    config.account_id = FLAGS_account_name;
+    config.transactions = FLAGS_bench_transactions;
+    config.batch_size = FLAGS_bench_batch_size;
+    config.rate = FLAGS_bench_rate;
+    config.max_in_flight = FLAGS_bench_max_in_flight;
+    config.senders = FLAGS_bench_senders;
+    config.status_timeout =
+        std::chrono::milliseconds(FLAGS_bench_status_timeout);
+    logger->info("Send {} transactions to {}:{}",
+                 config.transactions,
+                 FLAGS_peer_ip,
+                 FLAGS_torii_port);
+    iroha_cli::LoadGenerator generator(std::move(config));
+    generator.run();
+    generator.printReport(std::cout);
+  }
   // Run iroha-cli in interactive mode
   else if (FLAGS_interactive) {
     if (FLAGS_account_name.empty()) {
@@ -200,18 +301,8 @@ int main(int argc, char *argv[]) {
       logger->error("Path {} not found.", path.string());
       return EXIT_FAILURE;
     }
-    iroha::KeysManagerImpl manager((path / FLAGS_account_name).string());
-    auto keypair = FLAGS_pass_phrase.size() != 0
-        ? manager.loadKeys(FLAGS_pass_phrase)
-        : manager.loadKeys();
+    auto keypair = loadKeypair(path, FLAGS_account_name, logger);
     if (not keypair) {
-      logger->error(
-          "Cannot load specified keypair, or keypair is invalid. Path: {}, "
-          "keypair name: {}. Use --key_path with path of your keypair. \n"
-          "Maybe wrong pass phrase (\"{}\")?",
-          path.string(),
-          FLAGS_account_name,
-          FLAGS_pass_phrase);
       return EXIT_FAILURE;
     }
     // TODO 13/09/17 grimadas: Init counters from Iroha, or read from disk?
@@ -70,6 +70,16 @@ namespace iroha {
       virtual boost::optional<TxCacheStatusType> checkTxPresence(
           const shared_model::crypto::Hash &hash) = 0;
 
+      /**
+       * Synchronously checks whether transactions with given hashes are
+       * present in any block with one storage query
+       * @param hashes - transactions' hashes
+       * @return statuses of the transactions in the same order if storage
+       * query was successful, boost::none otherwise
+       */
+      virtual boost::optional<std::vector<TxCacheStatusType>> checkTxPresence(
+          const std::vector<shared_model::crypto::Hash> &hashes) = 0;
+
       /**
        * Get the top-most block
        * @return result of Model Block or error message
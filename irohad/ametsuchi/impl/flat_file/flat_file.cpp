@@ -20,6 +20,8 @@ using Identifier = FlatFile::Identifier;
 
 // ----------| public API |----------
 
+const std::string FlatFile::kPartsExtension = ".parts";
+
 std::string FlatFile::id_to_name(Identifier id) {
   std::ostringstream os;
   os << std::setw(FlatFile::DIGIT_CAPACITY) << std::setfill('0') << id;
@@ -71,11 +73,42 @@ bool FlatFile::add(Identifier id, const Bytes &block) {
   file.write(reinterpret_cast<const char *>(block.data()),
              block.size() * val_size);
 
+  // positions of parts of a block, which was removed from the storage
+  auto parts_file_name = file_name;
+  parts_file_name += kPartsExtension;
+  boost::system::error_code err;
+  boost::filesystem::remove(parts_file_name, err);
+
   // Update internals, release lock
   current_id_ = next_id;
   return true;
 }
 
+bool FlatFile::add(Identifier id, const Bytes &blob, const Parts &parts) {
+  if (not add(id, blob)) {
+    return false;
+  }
+
+  auto file_name = boost::filesystem::path{dump_dir_} / id_to_name(id);
+  file_name += kPartsExtension;
+  boost::filesystem::ofstream file(file_name.native(), std::ofstream::binary);
+  if (not file.is_open()) {
+    log_->warn("Cannot open parts file by index {} for writing", id);
+    return true;
+  }
+  for (const auto &part : parts) {
+    uint64_t position[] = {part.offset, part.size};
+    file.write(reinterpret_cast<const char *>(position), sizeof(position));
+  }
+  if (not file) {
+    log_->warn("Cannot write parts file by index {}", id);
+    file.close();
+    boost::system::error_code err;
+    boost::filesystem::remove(file_name, err);
+  }
+  return true;
+}
+
 boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
   const auto filename =
       boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id);
@@ -95,6 +128,53 @@ boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
   return buf;
 }
 
+boost::optional<FlatFile::Parts> FlatFile::parts(Identifier id) const {
+  auto filename = boost::filesystem::path{dump_dir_} / id_to_name(id);
+  filename += kPartsExtension;
+  boost::system::error_code err;
+  const auto file_size = boost::filesystem::file_size(filename, err);
+  if (err) {
+    return boost::none;
+  }
+  boost::filesystem::ifstream file(filename, std::ifstream::binary);
+  if (not file.is_open()) {
+    log_->info("parts({}) problem with opening file", id);
+    return boost::none;
+  }
+  Parts result;
+  result.reserve(file_size / (2 * sizeof(uint64_t)));
+  uint64_t position[2];
+  while (file.read(reinterpret_cast<char *>(position), sizeof(position))) {
+    result.push_back(Part{position[0], position[1]});
+  }
+  return result;
+}
+
+boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id,
+                                               const Part &part) const {
+  const auto filename =
+      boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id);
+  boost::system::error_code err;
+  const auto file_size = boost::filesystem::file_size(filename, err);
+  if (err or part.offset > file_size or part.size > file_size - part.offset) {
+    log_->info("get({}) part is out of the file", id);
+    return boost::none;
+  }
+  boost::filesystem::ifstream file(filename, std::ifstream::binary);
+  if (not file.is_open()) {
+    log_->info("get({}) problem with opening file", id);
+    return boost::none;
+  }
+  Bytes buf(part.size);
+  file.seekg(part.offset);
+  file.read(reinterpret_cast<char *>(buf.data()), part.size);
+  if (not file) {
+    log_->info("get({}) problem with reading file", id);
+    return boost::none;
+  }
+  return buf;
+}
+
 std::string FlatFile::directory() const {
   return dump_dir_;
 }
@@ -128,11 +208,15 @@ boost::optional<Identifier> FlatFile::check_consistency(
     return boost::none;
   }
 
+  // files with positions of parts go along with their data files
   auto const files = [&dump_dir] {
     std::vector<boost::filesystem::path> ps;
-    std::copy(boost::filesystem::directory_iterator{dump_dir},
-              boost::filesystem::directory_iterator{},
-              std::back_inserter(ps));
+    std::copy_if(boost::filesystem::directory_iterator{dump_dir},
+                 boost::filesystem::directory_iterator{},
+                 std::back_inserter(ps),
+                 [](const boost::filesystem::path &p) {
+                   return p.extension() != FlatFile::kPartsExtension;
+                 });
     std::sort(ps.begin(), ps.end(), std::less<boost::filesystem::path>());
     return ps;
   }();
@@ -145,6 +229,8 @@ boost::optional<Identifier> FlatFile::check_consistency(
   std::for_each(
       missing.get(), files.cend(), [](const boost::filesystem::path &p) {
         boost::filesystem::remove(p);
+        boost::filesystem::remove(
+            boost::filesystem::path{p} += FlatFile::kPartsExtension);
       });
 
   return missing.get() - files.cbegin();
@@ -31,6 +31,11 @@ namespace iroha {
 
       static const uint32_t DIGIT_CAPACITY = 16;
 
+      /**
+       * Extension of files with positions of parts of the data
+       */
+      static const std::string kPartsExtension;
+
       /**
        * Convert id to a string representation. The string representation is
        * always DIGIT_CAPACITY-character width regardless of the value of `id`.
@@ -55,8 +60,20 @@ namespace iroha {
 
       bool add(Identifier id, const Bytes &blob) override;
 
+      /**
+       * Parts are kept next to the data in a file with kPartsExtension, which
+       * is written after the data. If it fails, the data is still added and
+       * can only be read as a whole.
+       */
+      bool add(Identifier id, const Bytes &blob, const Parts &parts) override;
+
       boost::optional<Bytes> get(Identifier id) const override;
 
+      boost::optional<Parts> parts(Identifier id) const override;
+
+      boost::optional<Bytes> get(Identifier id,
+                                 const Part &part) const override;
+
       std::string directory() const override;
 
       Identifier last_id() const override;
@@ -0,0 +1,611 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/in_memory_command_executor.hpp"
+
+#include <algorithm>
+
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
+#include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/common_objects/amount.hpp"
+#include "interfaces/common_objects/peer.hpp"
+
+namespace {
+  using Role = shared_model::interface::permissions::Role;
+  using Grantable = shared_model::interface::permissions::Grantable;
+
+  /// error codes shared by all commands, other codes are command-specific
+  const iroha::ametsuchi::CommandError::ErrorCodeType kGeneralError = 1;
+  const iroha::ametsuchi::CommandError::ErrorCodeType kNoPermission = 2;
+
+  template <typename Command>
+  iroha::ametsuchi::CommandResult makeCommandError(
+      std::string command_name,
+      iroha::ametsuchi::CommandError::ErrorCodeType code,
+      const Command &command) {
+    return iroha::expected::makeError(iroha::ametsuchi::CommandError{
+        std::move(command_name), code, command.toString()});
+  }
+
+  iroha::ametsuchi::WsvDecimal toDecimal(
+      const shared_model::interface::Amount &amount) {
+    if (not amount.value()) {
+      // all the digits do not fit 256 bits, which is rare
+      return *iroha::ametsuchi::WsvDecimal::fromString(amount.toStringRepr());
+    }
+    const auto &words = amount.value()->words();
+    boost::multiprecision::cpp_int value;
+    for (auto word = words.rbegin(); word != words.rend(); ++word) {
+      value = (value << 64) | *word;
+    }
+    return {std::move(value), amount.precision()};
+  }
+
+  /**
+   * Same as split_part(str, delimiter, 2) in Postgres
+   */
+  std::string secondPart(const std::string &str, char delimiter) {
+    auto begin = str.find(delimiter);
+    if (begin == std::string::npos) {
+      return {};
+    }
+    auto end = str.find(delimiter, begin + 1);
+    return str.substr(begin + 1,
+                      end == std::string::npos ? end : end - begin - 1);
+  }
+
+  bool isHexDigit(char c) {
+    return (c >= '0' and c <= '9') or (c >= 'a' and c <= 'f')
+        or (c >= 'A' and c <= 'F');
+  }
+
+  /**
+   * Postgres executor inlines the value into a JSON string literal, which is
+   * itself inlined into an SQL string literal. Check that the value does not
+   * break either of them, so it would be accepted by Postgres.
+   */
+  bool isValidDetailValue(const std::string &value) {
+    for (size_t i = 0; i < value.size(); ++i) {
+      auto c = static_cast<unsigned char>(value[i]);
+      if (c < 0x20 or c == '\'' or c == '"') {
+        return false;
+      }
+      if (c != '\\') {
+        continue;
+      }
+      if (++i == value.size()) {
+        return false;
+      }
+      switch (value[i]) {
+        case '"':
+        case '\\':
+        case '/':
+        case 'b':
+        case 'f':
+        case 'n':
+        case 'r':
+        case 't':
+          break;
+        case 'u':
+          // jsonb does not accept \u0000
+          if (i + 4 >= value.size()
+              or not std::all_of(value.begin() + i + 1,
+                                 value.begin() + i + 5,
+                                 isHexDigit)
+              or value.compare(i + 1, 4, "0000") == 0) {
+            return false;
+          }
+          i += 4;
+          break;
+        default:
+          return false;
+      }
+    }
+    return true;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    InMemoryCommandExecutor::InMemoryCommandExecutor(
+        std::shared_ptr<InMemoryWsvState> state)
+        : state_(std::move(state)), do_validation_(true) {}
+
+    void InMemoryCommandExecutor::setCreatorAccountId(
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id) {
+      creator_account_id_ = creator_account_id;
+    }
+
+    void InMemoryCommandExecutor::doValidation(bool do_validation) {
+      do_validation_ = do_validation;
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::AddAssetQuantity &command) {
+      const auto &account_id = creator_account_id_;
+      const auto &asset_id = command.assetId();
+      auto precision = command.amount().precision();
+
+      bool has_perm = not do_validation_
+          or hasGlobalOrDomainPermission(
+                asset_id, Role::kAddAssetQty, Role::kAddDomainAssetQty);
+      const auto &asset = state_->asset(asset_id);
+      bool has_asset = asset and asset->precision >= precision;
+      auto new_value = toDecimal(command.amount())
+          + state_->balance(account_id, asset_id).value_or(WsvDecimal{});
+      bool fits = new_value.lessThanPowerOfTwo(256 - precision);
+
+      if (has_perm and has_asset and fits and state_->account(account_id)) {
+        state_->putBalance(account_id, asset_id, std::move(new_value));
+        return {};
+      }
+      if (not has_perm) {
+        return makeCommandError("AddAssetQuantity", kNoPermission, command);
+      }
+      if (not has_asset) {
+        return makeCommandError("AddAssetQuantity", 3, command);
+      }
+      if (not fits) {
+        return makeCommandError("AddAssetQuantity", 4, command);
+      }
+      return makeCommandError("AddAssetQuantity", kGeneralError, command);
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::AddPeer &command) {
+      const auto &peer = command.peer();
+      if (do_validation_
+          and not hasPermission(creator_account_id_, Role::kAddPeer)) {
+        return makeCommandError("AddPeer", kNoPermission, command);
+      }
+      const auto &public_key = peer.pubkey().hex();
+      if (state_->peerAddress(public_key)
+          or state_->peerAddressTaken(peer.address())) {
+        return makeCommandError("AddPeer", kGeneralError, command);
+      }
+      state_->putPeer(public_key, peer.address());
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::AddSignatory &command) {
+      const auto &account_id = command.accountId();
+      if (do_validation_
+          and not hasRoleOrGrantablePermission(account_id,
+                                               Role::kAddSignatory,
+                                               Grantable::kAddMySignatory)) {
+        return makeCommandError("AddSignatory", kNoPermission, command);
+      }
+      auto signatories = state_->signatories(account_id);
+      if (not signatories.insert(command.pubkey().hex()).second) {
+        return makeCommandError("AddSignatory", 4, command);
+      }
+      if (not state_->account(account_id)) {
+        return makeCommandError("AddSignatory", 3, command);
+      }
+      state_->putSignatories(account_id, std::move(signatories));
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::AppendRole &command) {
+      const auto &account_id = command.accountId();
+      const auto &role_id = command.roleName();
+      if (do_validation_) {
+        const auto &role = state_->role(role_id);
+        if (not role) {
+          return makeCommandError("AppendRole", 4, command);
+        }
+        if (state_->accountRoles(creator_account_id_).empty()
+            or not role->isSubsetOf(
+                   state_->accountPermissions(creator_account_id_))
+            or not hasPermission(creator_account_id_, Role::kAppendRole)) {
+          return makeCommandError("AppendRole", kNoPermission, command);
+        }
+      }
+      auto roles = state_->accountRoles(account_id);
+      if (not roles.insert(role_id).second) {
+        return makeCommandError("AppendRole", kGeneralError, command);
+      }
+      if (not state_->account(account_id)) {
+        return makeCommandError("AppendRole", 3, command);
+      }
+      if (not state_->role(role_id)) {
+        return makeCommandError("AppendRole", 4, command);
+      }
+      state_->putAccountRoles(account_id, std::move(roles));
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::CreateAccount &command) {
+      const auto &domain_id = command.domainId();
+      auto account_id = command.accountName() + "@" + domain_id;
+      auto default_role = state_->domain(domain_id);
+      if (do_validation_) {
+        if (not hasPermission(creator_account_id_, Role::kCreateAccount)) {
+          return makeCommandError("CreateAccount", kNoPermission, command);
+        }
+        auto domain_permissions = default_role
+            ? state_->role(*default_role)
+                  .value_or(shared_model::interface::RolePermissionSet{})
+            : shared_model::interface::RolePermissionSet{};
+        if (not domain_permissions.isSubsetOf(
+                state_->accountPermissions(creator_account_id_))) {
+          return makeCommandError("CreateAccount", kNoPermission, command);
+        }
+      }
+      if (not default_role) {
+        return makeCommandError("CreateAccount", 3, command);
+      }
+      if (state_->account(account_id)) {
+        return makeCommandError("CreateAccount", 4, command);
+      }
+      state_->putAccount(account_id, WsvAccount{domain_id, 1});
+      state_->putSignatories(account_id, {command.pubkey().hex()});
+      state_->putAccountRoles(account_id, {*default_role});
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::CreateAsset &command) {
+      const auto &domain_id = command.domainId();
+      auto asset_id = command.assetName() + "#" + domain_id;
+      if (do_validation_
+          and not hasPermission(creator_account_id_, Role::kCreateAsset)) {
+        return makeCommandError("CreateAsset", kNoPermission, command);
+      }
+      if (state_->asset(asset_id)) {
+        return makeCommandError("CreateAsset", 4, command);
+      }
+      if (not state_->domain(domain_id)) {
+        return makeCommandError("CreateAsset", 3, command);
+      }
+      state_->putAsset(asset_id, WsvAsset{domain_id, command.precision()});
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::CreateDomain &command) {
+      const auto &domain_id = command.domainId();
+      const auto &default_role = command.userDefaultRole();
+      if (do_validation_
+          and not hasPermission(creator_account_id_, Role::kCreateDomain)) {
+        return makeCommandError("CreateDomain", kNoPermission, command);
+      }
+      if (state_->domain(domain_id)) {
+        return makeCommandError("CreateDomain", 3, command);
+      }
+      if (not state_->role(default_role)) {
+        return makeCommandError("CreateDomain", 4, command);
+      }
+      state_->putDomain(domain_id, default_role);
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::CreateRole &command) {
+      const auto &role_id = command.roleName();
+      const auto &permissions = command.rolePermissions();
+      if (do_validation_
+          and (not permissions.isSubsetOf(
+                   state_->accountPermissions(creator_account_id_))
+               or not hasPermission(creator_account_id_, Role::kCreateRole))) {
+        return makeCommandError("CreateRole", kNoPermission, command);
+      }
+      if (state_->role(role_id)) {
+        return makeCommandError("CreateRole", 3, command);
+      }
+      state_->putRole(role_id, permissions);
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::DetachRole &command) {
+      const auto &account_id = command.accountId();
+      const auto &role_id = command.roleName();
+      bool has_perm = not do_validation_
+          or hasPermission(creator_account_id_, Role::kDetachRole);
+      auto roles = state_->accountRoles(account_id);
+      bool has_role = roles.count(role_id) != 0;
+      if (has_perm and has_role) {
+        roles.erase(role_id);
+        state_->putAccountRoles(account_id, std::move(roles));
+        return {};
+      }
+      if (not state_->account(account_id)) {
+        return makeCommandError("DetachRole", 3, command);
+      }
+      if (not state_->role(role_id)) {
+        return makeCommandError("DetachRole", 5, command);
+      }
+      if (not has_role) {
+        return makeCommandError("DetachRole", 4, command);
+      }
+      return makeCommandError("DetachRole", kNoPermission, command);
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::GrantPermission &command) {
+      const auto &permittee_account_id = command.accountId();
+      const auto permission = command.permissionName();
+      if (do_validation_
+          and not hasPermission(
+                  creator_account_id_,
+                  shared_model::interface::permissions::permissionFor(
+                      permission))) {
+        return makeCommandError("GrantPermission", kNoPermission, command);
+      }
+      auto permissions = state_->grantablePermissions(permittee_account_id,
+                                                      creator_account_id_);
+      if (permissions and permissions->test(permission)) {
+        return makeCommandError("GrantPermission", kGeneralError, command);
+      }
+      if (not permissions) {
+        if (not state_->account(permittee_account_id)) {
+          return makeCommandError("GrantPermission", 3, command);
+        }
+        if (not state_->account(creator_account_id_)) {
+          return makeCommandError("GrantPermission", kGeneralError, command);
+        }
+        permissions = shared_model::interface::GrantablePermissionSet{};
+      }
+      permissions->set(permission);
+      state_->putGrantablePermissions(
+          permittee_account_id, creator_account_id_, *permissions);
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::RemoveSignatory &command) {
+      const auto &account_id = command.accountId();
+      const auto &public_key = command.pubkey().hex();
+      auto signatories = state_->signatories(account_id);
+      if (do_validation_) {
+        const auto &account = state_->account(account_id);
+        if (not account) {
+          return makeCommandError("RemoveSignatory", 3, command);
+        }
+        if (not hasRoleOrGrantablePermission(account_id,
+                                             Role::kRemoveSignatory,
+                                             Grantable::kRemoveMySignatory)) {
+          return makeCommandError("RemoveSignatory", kNoPermission, command);
+        }
+        if (signatories.count(public_key) == 0) {
+          return makeCommandError("RemoveSignatory", 4, command);
+        }
+        if (account->quorum >= signatories.size()) {
+          return makeCommandError("RemoveSignatory", 5, command);
+        }
+      }
+      if (signatories.erase(public_key) == 0) {
+        return makeCommandError("RemoveSignatory", kGeneralError, command);
+      }
+      // signatory itself is kept like Postgres executor does, since its
+      // statement does not see the removed link
+      state_->putSignatories(account_id, std::move(signatories));
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::RevokePermission &command) {
+      const auto &permittee_account_id = command.accountId();
+      const auto permission = command.permissionName();
+      auto permissions = state_->grantablePermissions(permittee_account_id,
+                                                      creator_account_id_);
+      bool has_perm = permissions and permissions->test(permission);
+      if (do_validation_ and not has_perm) {
+        return makeCommandError("RevokePermission", kNoPermission, command);
+      }
+      if (not has_perm) {
+        return makeCommandError("RevokePermission", kGeneralError, command);
+      }
+      permissions->unset(permission);
+      state_->putGrantablePermissions(
+          permittee_account_id, creator_account_id_, *permissions);
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::SetAccountDetail &command) {
+      const auto &account_id = command.accountId();
+      if (creator_account_id_.empty()) {
+        // When creator is not known, it is genesis block
+        creator_account_id_ = "genesis";
+      }
+      if (not isValidDetailValue(command.value())) {
+        return makeCommandError("SetAccountDetail", kGeneralError, command);
+      }
+      if (do_validation_ and creator_account_id_ != account_id
+          and not hasGrantablePermission(creator_account_id_,
+                                         account_id,
+                                         Grantable::kSetMyAccountDetail)
+          and not hasPermission(creator_account_id_, Role::kSetDetail)) {
+        return makeCommandError("SetAccountDetail", kNoPermission, command);
+      }
+      if (not state_->account(account_id)) {
+        return makeCommandError("SetAccountDetail", 3, command);
+      }
+      state_->appendAccountDetail(WsvAccountDetail{account_id,
+                                                   creator_account_id_,
+                                                   command.key(),
+                                                   "\"" + command.value()
+                                                       + "\""});
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::SetQuorum &command) {
+      const auto &account_id = command.accountId();
+      auto quorum = command.newQuorum();
+      if (do_validation_) {
+        if (not hasRoleOrGrantablePermission(
+                account_id, Role::kSetQuorum, Grantable::kSetMyQuorum)) {
+          return makeCommandError("SetQuorum", kNoPermission, command);
+        }
+        auto signatories_count = state_->signatories(account_id).size();
+        if (signatories_count == 0) {
+          return makeCommandError("SetQuorum", 4, command);
+        }
+        if (quorum > signatories_count or not state_->account(account_id)) {
+          return makeCommandError("SetQuorum", 5, command);
+        }
+      }
+      auto account = state_->account(account_id);
+      if (not account) {
+        return makeCommandError("SetQuorum", kGeneralError, command);
+      }
+      account->quorum = quorum;
+      state_->putAccount(account_id, std::move(*account));
+      return {};
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::SubtractAssetQuantity &command) {
+      const auto &account_id = creator_account_id_;
+      const auto &asset_id = command.assetId();
+      auto precision = command.amount().precision();
+
+      bool has_perm = not do_validation_
+          or hasGlobalOrDomainPermission(asset_id,
+                                         Role::kSubtractAssetQty,
+                                         Role::kSubtractDomainAssetQty);
+      const auto &asset = state_->asset(asset_id);
+      bool has_asset = asset and asset->precision >= precision;
+      auto new_value =
+          state_->balance(account_id, asset_id).value_or(WsvDecimal{})
+          - toDecimal(command.amount());
+
+      if (has_perm and has_asset and not new_value.isNegative()
+          and state_->account(account_id)) {
+        state_->putBalance(account_id, asset_id, std::move(new_value));
+        return {};
+      }
+      if (not has_perm) {
+        return makeCommandError(
+            "SubtractAssetQuantity", kNoPermission, command);
+      }
+      if (not has_asset) {
+        return makeCommandError("SubtractAssetQuantity", 3, command);
+      }
+      if (new_value.isNegative()) {
+        return makeCommandError("SubtractAssetQuantity", 4, command);
+      }
+      return makeCommandError("SubtractAssetQuantity", kGeneralError, command);
+    }
+
+    CommandResult InMemoryCommandExecutor::operator()(
+        const shared_model::interface::TransferAsset &command) {
+      const auto &src_account_id = command.srcAccountId();
+      const auto &dest_account_id = command.destAccountId();
+      const auto &asset_id = command.assetId();
+      auto precision = command.amount().precision();
+      auto amount = toDecimal(command.amount());
+
+      bool has_perm = not do_validation_
+          or (hasPermission(dest_account_id, Role::kReceive)
+              and (creator_account_id_ != src_account_id
+                       ? hasGrantablePermission(creator_account_id_,
+                                                src_account_id,
+                                                Grantable::kTransferMyAssets)
+                       : hasPermission(creator_account_id_, Role::kTransfer)));
+      bool has_src = static_cast<bool>(state_->account(src_account_id));
+      bool has_dest = static_cast<bool>(state_->account(dest_account_id));
+      const auto &asset = state_->asset(asset_id);
+      bool has_asset = asset and asset->precision >= precision;
+      auto new_src_value =
+          state_->balance(src_account_id, asset_id).value_or(WsvDecimal{})
+          - amount;
+      // a transfer to the source account itself is a subtraction followed by
+      // an addition, so the addition starts from the subtracted balance
+      auto new_dest_value = amount
+          + (src_account_id == dest_account_id
+                 ? new_src_value
+                 : state_->balance(dest_account_id, asset_id)
+                       .value_or(WsvDecimal{}));
+      bool src_fits = not new_src_value.isNegative();
+      bool dest_fits = new_dest_value.lessThanPowerOfTwo(256 - precision);
+
+      if (has_perm and has_src and has_dest and has_asset and src_fits
+          and dest_fits) {
+        state_->putBalance(src_account_id, asset_id, std::move(new_src_value));
+        state_->putBalance(
+            dest_account_id, asset_id, std::move(new_dest_value));
+        return {};
+      }
+      if (not has_perm) {
+        return makeCommandError("TransferAsset", kNoPermission, command);
+      }
+      if (not has_dest) {
+        return makeCommandError("TransferAsset", 4, command);
+      }
+      if (not has_src) {
+        return makeCommandError("TransferAsset", 3, command);
+      }
+      if (not has_asset) {
+        return makeCommandError("TransferAsset", 5, command);
+      }
+      if (not src_fits) {
+        return makeCommandError("TransferAsset", 6, command);
+      }
+      if (not dest_fits) {
+        return makeCommandError("TransferAsset", 7, command);
+      }
+      return makeCommandError("TransferAsset", kGeneralError, command);
+    }
+
+    bool InMemoryCommandExecutor::hasPermission(const std::string &account_id,
+                                                Role permission) {
+      return state_->accountPermissions(account_id).test(permission);
+    }
+
+    bool InMemoryCommandExecutor::hasGrantablePermission(
+        const std::string &permittee_account_id,
+        const std::string &account_id,
+        Grantable permission) {
+      const auto &permissions =
+          state_->grantablePermissions(permittee_account_id, account_id);
+      return permissions and permissions->test(permission);
+    }
+
+    bool InMemoryCommandExecutor::hasRoleOrGrantablePermission(
+        const std::string &account_id,
+        Role role_permission,
+        Grantable grantable_permission) {
+      return hasGrantablePermission(
+                 creator_account_id_, account_id, grantable_permission)
+          or (creator_account_id_ == account_id
+              and hasPermission(creator_account_id_, role_permission));
+    }
+
+    bool InMemoryCommandExecutor::hasGlobalOrDomainPermission(
+        const std::string &asset_id,
+        Role global_permission,
+        Role domain_permission) {
+      return hasPermission(creator_account_id_, global_permission)
+          or (secondPart(creator_account_id_, '@') == secondPart(asset_id, '#')
+              and hasPermission(creator_account_id_, domain_permission));
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,119 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_IN_MEMORY_COMMAND_EXECUTOR_HPP
+#define IROHA_IN_MEMORY_COMMAND_EXECUTOR_HPP
+
+#include "ametsuchi/command_executor.hpp"
+
+#include <memory>
+
+#include "interfaces/permissions.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class InMemoryWsvState;
+
+    /**
+     * Command executor which validates and applies commands to the world
+     * state kept in memory. Results and error codes of every command are the
+     * same as the ones of PostgresCommandExecutor.
+     */
+    class InMemoryCommandExecutor : public CommandExecutor {
+     public:
+      explicit InMemoryCommandExecutor(std::shared_ptr<InMemoryWsvState> state);
+
+      void setCreatorAccountId(
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id) override;
+
+      void doValidation(bool do_validation) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AddAssetQuantity &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AddPeer &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AddSignatory &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AppendRole &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateAccount &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateAsset &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateDomain &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateRole &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::DetachRole &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::GrantPermission &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::RemoveSignatory &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::RevokePermission &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::SetAccountDetail &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::SetQuorum &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::SubtractAssetQuantity &command)
+          override;
+
+      CommandResult operator()(
+          const shared_model::interface::TransferAsset &command) override;
+
+     private:
+      bool hasPermission(const std::string &account_id,
+                         shared_model::interface::permissions::Role permission);
+
+      bool hasGrantablePermission(
+          const std::string &permittee_account_id,
+          const std::string &account_id,
+          shared_model::interface::permissions::Grantable permission);
+
+      /**
+       * Role permission of the creator on itself or the grantable permission
+       * on the account
+       */
+      bool hasRoleOrGrantablePermission(
+          const std::string &account_id,
+          shared_model::interface::permissions::Role role_permission,
+          shared_model::interface::permissions::Grantable grantable_permission);
+
+      /**
+       * Global role permission of the creator or the domain one, if the
+       * asset is in the creator domain
+       */
+      bool hasGlobalOrDomainPermission(
+          const std::string &asset_id,
+          shared_model::interface::permissions::Role global_permission,
+          shared_model::interface::permissions::Role domain_permission);
+
+      std::shared_ptr<InMemoryWsvState> state_;
+      bool do_validation_;
+      shared_model::interface::types::AccountIdType creator_account_id_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_IN_MEMORY_COMMAND_EXECUTOR_HPP
@@ -0,0 +1,172 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/in_memory_temporary_wsv.hpp"
+
+#include <boost/range/size.hpp>
+#include "ametsuchi/impl/in_memory_command_executor.hpp"
+#include "ametsuchi/impl/in_memory_wsv_keys.hpp"
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
+#include "ametsuchi/impl/postgres_wsv_state_storage.hpp"
+#include "cryptography/public_key.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    InMemoryTemporaryWsv::InMemoryTemporaryWsv(
+        std::unique_ptr<soci::session> sql, logger::Logger log)
+        : sql_(std::move(sql)),
+          storage_(std::make_shared<PostgresWsvStateStorage>(*sql_)),
+          state_(std::make_shared<InMemoryWsvState>(storage_)),
+          command_executor_(std::make_unique<InMemoryCommandExecutor>(state_)),
+          log_(std::move(log)) {
+      *sql_ << "BEGIN";
+    }
+
+    expected::Result<void, validation::CommandError>
+    InMemoryTemporaryWsv::validateSignatures(
+        const shared_model::interface::Transaction &transaction) {
+      const auto signatures_count = boost::size(transaction.signatures());
+      bool signatories_valid = false;
+      try {
+        const auto &account = state_->account(transaction.creatorAccountId());
+        const auto &signatories =
+            state_->signatories(transaction.creatorAccountId());
+        size_t known_signatures = 0;
+        for (const auto &signature : transaction.signatures()) {
+          known_signatures += signatories.count(signature.publicKey().hex());
+        }
+        signatories_valid = account and known_signatures == signatures_count
+            and account->quorum <= signatures_count;
+      } catch (const std::exception &e) {
+        auto error_str = "Transaction " + transaction.toString()
+            + " failed signatures validation with db error: " + e.what();
+        // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
+        // with named constant
+        return expected::makeError(validation::CommandError{
+            "signatures validation", 1, error_str, false});
+      }
+
+      if (signatories_valid) {
+        return {};
+      }
+      auto error_str = "Transaction " + transaction.toString()
+          + " failed signatures validation";
+      // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
+      // with named constant
+      return expected::makeError(validation::CommandError{
+          "signatures validation", 2, error_str, false});
+    }
+
+    expected::Result<void, validation::CommandError>
+    InMemoryTemporaryWsv::apply(
+        const shared_model::interface::Transaction &transaction) {
+      command_executor_->setCreatorAccountId(transaction.creatorAccountId());
+      command_executor_->doValidation(true);
+      auto execute_command =
+          [this](auto &command) -> expected::Result<void, CommandError> {
+        try {
+          return boost::apply_visitor(*command_executor_, command.get());
+        } catch (const std::exception &e) {
+          // the state failed to load, e.g. because of a database error
+          return expected::makeError(
+              CommandError{"TemporaryWsv", 1, e.what()});
+        }
+      };
+
+      auto savepoint_wrapper = createSavepoint("savepoint_temp_wsv");
+
+      return validateSignatures(transaction) |
+                 [savepoint = std::move(savepoint_wrapper),
+                  &execute_command,
+                  &transaction]()
+                 -> expected::Result<void, validation::CommandError> {
+        // check transaction's commands validity
+        const auto &commands = transaction.commands();
+        validation::CommandError cmd_error;
+        for (size_t i = 0; i < commands.size(); ++i) {
+          // in case of failed command, rollback and return
+          auto cmd_is_valid =
+              execute_command(commands[i])
+                  .match([](expected::Value<void> &) { return true; },
+                         [i, &cmd_error](expected::Error<CommandError> &error) {
+                           cmd_error = {error.error.command_name,
+                                        error.error.error_code,
+                                        error.error.error_extra,
+                                        true,
+                                        i};
+                           return false;
+                         });
+          if (not cmd_is_valid) {
+            return expected::makeError(cmd_error);
+          }
+        }
+        // success
+        savepoint->release();
+        return {};
+      };
+    }
+
+    std::unique_ptr<TemporaryWsv::SavepointWrapper>
+    InMemoryTemporaryWsv::createSavepoint(const std::string &) {
+      return std::make_unique<SavepointWrapperImpl>(*state_);
+    }
+
+    bool InMemoryTemporaryWsv::merge(TemporaryWsv &other) {
+      auto in_memory = dynamic_cast<InMemoryTemporaryWsv *>(&other);
+      if (not in_memory) {
+        return false;
+      }
+      state_->merge(in_memory->state_->changes());
+      return true;
+    }
+
+    void InMemoryTemporaryWsv::prefetch(
+        const std::vector<
+            shared_model::interface::types::TransactionsCollectionType>
+            &batches) {
+      WsvStateKeys keys;
+      for (const auto &batch : batches) {
+        for (const auto &transaction : batch) {
+          collectWsvStateKeys(transaction, keys);
+        }
+      }
+      try {
+        state_->preload(keys);
+      } catch (const std::exception &e) {
+        log_->warn("Failed to preload the state: {}", e.what());
+      }
+    }
+
+    void InMemoryTemporaryWsv::writeBack() {
+      storage_->writeBack(*state_);
+    }
+
+    InMemoryTemporaryWsv::~InMemoryTemporaryWsv() {
+      try {
+        *sql_ << "ROLLBACK";
+      } catch (std::exception &e) {
+        log_->error("Rollback did not happen: {}", e.what());
+      }
+    }
+
+    InMemoryTemporaryWsv::SavepointWrapperImpl::SavepointWrapperImpl(
+        InMemoryWsvState &state)
+        : state_(state), savepoint_(state.savepoint()), is_released_(false) {}
+
+    void InMemoryTemporaryWsv::SavepointWrapperImpl::release() {
+      is_released_ = true;
+    }
+
+    InMemoryTemporaryWsv::SavepointWrapperImpl::~SavepointWrapperImpl() {
+      if (not is_released_) {
+        state_.rollbackTo(savepoint_);
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
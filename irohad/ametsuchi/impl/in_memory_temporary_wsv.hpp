@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_IN_MEMORY_TEMPORARY_WSV_HPP
+#define IROHA_IN_MEMORY_TEMPORARY_WSV_HPP
+
+#include "ametsuchi/temporary_wsv.hpp"
+
+#include <soci/soci.h>
+#include "ametsuchi/command_executor.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class InMemoryWsvState;
+    class PostgresWsvStateStorage;
+
+    /**
+     * Temporary world state view which validates and applies transactions in
+     * memory. Postgres is only read on the first access to each entity, and
+     * nothing is written unless the state is prepared as the next block.
+     */
+    class InMemoryTemporaryWsv : public TemporaryWsv {
+      friend class StorageImpl;
+
+     public:
+      struct SavepointWrapperImpl : public TemporaryWsv::SavepointWrapper {
+        explicit SavepointWrapperImpl(InMemoryWsvState &state);
+
+        void release() override;
+
+        ~SavepointWrapperImpl() override;
+
+       private:
+        InMemoryWsvState &state_;
+        size_t savepoint_;
+        bool is_released_;
+      };
+
+      InMemoryTemporaryWsv(
+          std::unique_ptr<soci::session> sql,
+          logger::Logger log = logger::log("InMemoryTemporaryWSV"));
+
+      expected::Result<void, validation::CommandError> apply(
+          const shared_model::interface::Transaction &transaction) override;
+
+      std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
+          const std::string &name) override;
+
+      bool merge(TemporaryWsv &other) override;
+
+      /// loads the state read by all the transactions with one query
+      void prefetch(
+          const std::vector<
+              shared_model::interface::types::TransactionsCollectionType>
+              &batches) override;
+
+      ~InMemoryTemporaryWsv() override;
+
+     private:
+      /**
+       * Verifies whether transaction has at least quorum signatures and they
+       * are a subset of creator account signatories
+       */
+      expected::Result<void, validation::CommandError> validateSignatures(
+          const shared_model::interface::Transaction &transaction);
+
+      /**
+       * Write the state to the transaction of the session, so it can be
+       * prepared as the next block
+       */
+      void writeBack();
+
+      std::unique_ptr<soci::session> sql_;
+      std::shared_ptr<PostgresWsvStateStorage> storage_;
+      std::shared_ptr<InMemoryWsvState> state_;
+      std::unique_ptr<CommandExecutor> command_executor_;
+
+      logger::Logger log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_IN_MEMORY_TEMPORARY_WSV_HPP
@@ -0,0 +1,151 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/in_memory_wsv_keys.hpp"
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  using namespace shared_model::interface;
+  using iroha::ametsuchi::WsvStateKeys;
+
+  /**
+   * Adds keys read by a command to the keys. Permissions of an account are
+   * loaded together with the account.
+   */
+  class KeysVisitor : public boost::static_visitor<> {
+   public:
+    KeysVisitor(WsvStateKeys &keys, const std::string &creator)
+        : keys_(keys), creator_(creator) {}
+
+    void operator()(const AddAssetQuantity &command) {
+      keys_.assets.insert(command.assetId());
+      keys_.balances.emplace(creator_, command.assetId());
+    }
+
+    void operator()(const AddPeer &) {}
+
+    void operator()(const AddSignatory &command) {
+      accountWithGrantable(command.accountId());
+    }
+
+    void operator()(const AppendRole &command) {
+      keys_.accounts.insert(command.accountId());
+      keys_.roles.insert(command.roleName());
+    }
+
+    void operator()(const CreateAccount &command) {
+      keys_.accounts.insert(command.accountName() + "@" + command.domainId());
+      keys_.domains.insert(command.domainId());
+    }
+
+    void operator()(const CreateAsset &command) {
+      keys_.assets.insert(command.assetName() + "#" + command.domainId());
+      keys_.domains.insert(command.domainId());
+    }
+
+    void operator()(const CreateDomain &command) {
+      keys_.domains.insert(command.domainId());
+      keys_.roles.insert(command.userDefaultRole());
+    }
+
+    void operator()(const CreateRole &command) {
+      keys_.roles.insert(command.roleName());
+    }
+
+    void operator()(const DetachRole &command) {
+      keys_.accounts.insert(command.accountId());
+      keys_.roles.insert(command.roleName());
+    }
+
+    void operator()(const GrantPermission &command) {
+      keys_.accounts.insert(command.accountId());
+      keys_.grantable_permissions.emplace(command.accountId(), creator_);
+    }
+
+    void operator()(const RemoveSignatory &command) {
+      accountWithGrantable(command.accountId());
+    }
+
+    void operator()(const RevokePermission &command) {
+      keys_.accounts.insert(command.accountId());
+      keys_.grantable_permissions.emplace(command.accountId(), creator_);
+    }
+
+    void operator()(const SetAccountDetail &command) {
+      accountWithGrantable(command.accountId());
+    }
+
+    void operator()(const SetQuorum &command) {
+      accountWithGrantable(command.accountId());
+    }
+
+    void operator()(const SubtractAssetQuantity &command) {
+      keys_.assets.insert(command.assetId());
+      keys_.balances.emplace(creator_, command.assetId());
+    }
+
+    void operator()(const TransferAsset &command) {
+      keys_.accounts.insert(command.srcAccountId());
+      keys_.accounts.insert(command.destAccountId());
+      keys_.assets.insert(command.assetId());
+      keys_.balances.emplace(command.srcAccountId(), command.assetId());
+      keys_.balances.emplace(command.destAccountId(), command.assetId());
+      if (creator_ != command.srcAccountId()) {
+        keys_.grantable_permissions.emplace(creator_, command.srcAccountId());
+      }
+    }
+
+   private:
+    /// account, which the creator may access by a grantable permission
+    void accountWithGrantable(const std::string &account_id) {
+      keys_.accounts.insert(account_id);
+      keys_.grantable_permissions.emplace(creator_, account_id);
+    }
+
+    WsvStateKeys &keys_;
+    const std::string &creator_;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    void collectWsvStateKeys(
+        const shared_model::interface::Transaction &transaction,
+        WsvStateKeys &keys) {
+      const auto &creator = transaction.creatorAccountId();
+      // the creator is empty in the genesis block
+      if (not creator.empty()) {
+        keys.accounts.insert(creator);
+      }
+      KeysVisitor visitor(keys, creator);
+      for (const auto &command : transaction.commands()) {
+        boost::apply_visitor(visitor, command.get());
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
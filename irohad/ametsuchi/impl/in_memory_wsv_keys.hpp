@@ -0,0 +1,31 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_IN_MEMORY_WSV_KEYS_HPP
+#define IROHA_IN_MEMORY_WSV_KEYS_HPP
+
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Add the entities, which the in-memory command executor reads when it
+     * applies the transaction, to the keys
+     */
+    void collectWsvStateKeys(
+        const shared_model::interface::Transaction &transaction,
+        WsvStateKeys &keys);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_IN_MEMORY_WSV_KEYS_HPP
@@ -0,0 +1,585 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+  boost::multiprecision::cpp_int pow10(uint32_t power) {
+    return boost::multiprecision::pow(boost::multiprecision::cpp_int(10),
+                                      power);
+  }
+
+  /// @return the value with the key, which is removed from the map
+  template <typename Map>
+  boost::optional<typename Map::mapped_type> take(
+      Map &map, const typename Map::key_type &key) {
+    auto it = map.find(key);
+    if (it == map.end()) {
+      return boost::none;
+    }
+    auto value = std::move(it->second);
+    map.erase(it);
+    return value;
+  }
+
+  /// bring both values to the larger scale
+  std::tuple<boost::multiprecision::cpp_int,
+             boost::multiprecision::cpp_int,
+             uint32_t>
+  align(const iroha::ametsuchi::WsvDecimal &lhs,
+        const iroha::ametsuchi::WsvDecimal &rhs) {
+    auto scale = std::max(lhs.scale, rhs.scale);
+    return std::make_tuple(lhs.value * pow10(scale - lhs.scale),
+                           rhs.value * pow10(scale - rhs.scale),
+                           scale);
+  }
+
+  std::vector<std::string> difference(const std::set<std::string> &lhs,
+                                      const std::set<std::string> &rhs) {
+    std::vector<std::string> result;
+    std::set_difference(lhs.begin(),
+                        lhs.end(),
+                        rhs.begin(),
+                        rhs.end(),
+                        std::back_inserter(result));
+    return result;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    boost::optional<WsvDecimal> WsvDecimal::fromString(const std::string &str) {
+      auto begin = str.begin();
+      bool negative = begin != str.end() and *begin == '-';
+      if (negative) {
+        ++begin;
+      }
+      auto point = std::find(begin, str.end(), '.');
+      std::string digits(begin, point);
+      if (point != str.end()) {
+        digits.append(std::next(point), str.end());
+      }
+      bool malformed_point = point != str.end()
+          and (point == begin or std::next(point) == str.end());
+      if (digits.empty() or malformed_point
+          or not std::all_of(digits.begin(), digits.end(), [](char c) {
+               return c >= '0' and c <= '9';
+             })) {
+        return boost::none;
+      }
+
+      WsvDecimal result;
+      result.value = boost::multiprecision::cpp_int(digits);
+      if (negative) {
+        result.value = -result.value;
+      }
+      result.scale = point == str.end()
+          ? 0
+          : static_cast<uint32_t>(std::distance(point, str.end()) - 1);
+      return result;
+    }
+
+    std::string WsvDecimal::toString() const {
+      auto digits = boost::multiprecision::cpp_int(abs(value)).str();
+      if (digits.size() <= scale) {
+        digits.insert(0, scale + 1 - digits.size(), '0');
+      }
+      if (scale > 0) {
+        digits.insert(digits.size() - scale, 1, '.');
+      }
+      return isNegative() ? "-" + digits : digits;
+    }
+
+    WsvDecimal WsvDecimal::operator+(const WsvDecimal &rhs) const {
+      auto aligned = align(*this, rhs);
+      return {std::get<0>(aligned) + std::get<1>(aligned),
+              std::get<2>(aligned)};
+    }
+
+    WsvDecimal WsvDecimal::operator-(const WsvDecimal &rhs) const {
+      auto aligned = align(*this, rhs);
+      return {std::get<0>(aligned) - std::get<1>(aligned),
+              std::get<2>(aligned)};
+    }
+
+    bool WsvDecimal::isNegative() const {
+      return value < 0;
+    }
+
+    bool WsvDecimal::lessThanPowerOfTwo(uint32_t power) const {
+      return value
+          < (boost::multiprecision::cpp_int(1) << power) * pow10(scale);
+    }
+
+    bool WsvDecimal::operator==(const WsvDecimal &rhs) const {
+      return value == rhs.value and scale == rhs.scale;
+    }
+
+    bool WsvDecimal::operator!=(const WsvDecimal &rhs) const {
+      return not(*this == rhs);
+    }
+
+    bool WsvAccount::operator==(const WsvAccount &rhs) const {
+      return domain_id == rhs.domain_id and quorum == rhs.quorum;
+    }
+
+    bool WsvAccount::operator!=(const WsvAccount &rhs) const {
+      return not(*this == rhs);
+    }
+
+    bool WsvAsset::operator==(const WsvAsset &rhs) const {
+      return domain_id == rhs.domain_id and precision == rhs.precision;
+    }
+
+    bool WsvAsset::operator!=(const WsvAsset &rhs) const {
+      return not(*this == rhs);
+    }
+
+    bool WsvStateKeys::empty() const {
+      return domains.empty() and accounts.empty() and roles.empty()
+          and assets.empty() and balances.empty()
+          and grantable_permissions.empty();
+    }
+
+    WsvStateValues WsvStateLoader::loadAll(const WsvStateKeys &keys) {
+      WsvStateValues values;
+      auto add = [](auto &map, const auto &key, auto value) {
+        if (value) {
+          map.emplace(key, std::move(*value));
+        }
+      };
+      for (const auto &domain_id : keys.domains) {
+        add(values.domains, domain_id, loadDomain(domain_id));
+      }
+      auto role_ids = keys.roles;
+      for (const auto &account_id : keys.accounts) {
+        add(values.accounts, account_id, loadAccount(account_id));
+        values.signatories.emplace(account_id, loadSignatories(account_id));
+        auto roles = loadAccountRoles(account_id);
+        role_ids.insert(roles.begin(), roles.end());
+        values.account_roles.emplace(account_id, std::move(roles));
+      }
+      for (const auto &role_id : role_ids) {
+        add(values.roles, role_id, loadRole(role_id));
+      }
+      for (const auto &asset_id : keys.assets) {
+        add(values.assets, asset_id, loadAsset(asset_id));
+      }
+      for (const auto &key : keys.balances) {
+        add(values.balances, key, loadBalance(key.first, key.second));
+      }
+      for (const auto &key : keys.grantable_permissions) {
+        add(values.grantable_permissions,
+            key,
+            loadGrantablePermissions(key.first, key.second));
+      }
+      return values;
+    }
+
+    bool InMemoryWsvState::Changes::empty() const {
+      return roles.empty() and domains.empty() and created_accounts.empty()
+          and updated_accounts.empty() and signatories.empty()
+          and account_roles.empty() and grantable_permissions.empty()
+          and assets.empty() and balances.empty() and peers.empty()
+          and account_details.empty();
+    }
+
+    InMemoryWsvState::InMemoryWsvState(std::shared_ptr<WsvStateLoader> loader)
+        : loader_(std::move(loader)) {}
+
+    const boost::optional<std::string> &InMemoryWsvState::domain(
+        const std::string &domain_id) {
+      return domains_.get(domain_id,
+                          [&] { return loader_->loadDomain(domain_id); });
+    }
+
+    void InMemoryWsvState::putDomain(const std::string &domain_id,
+                                     std::string default_role) {
+      domains_.put(domain_id,
+                   std::move(default_role),
+                   [&] { return loader_->loadDomain(domain_id); },
+                   journal_);
+    }
+
+    const boost::optional<WsvAccount> &InMemoryWsvState::account(
+        const std::string &account_id) {
+      return accounts_.get(account_id,
+                           [&] { return loader_->loadAccount(account_id); });
+    }
+
+    void InMemoryWsvState::putAccount(const std::string &account_id,
+                                      WsvAccount account) {
+      accounts_.put(account_id,
+                    std::move(account),
+                    [&] { return loader_->loadAccount(account_id); },
+                    journal_);
+    }
+
+    const std::set<std::string> &InMemoryWsvState::signatories(
+        const std::string &account_id) {
+      return *signatories_.get(account_id, [&] {
+        return boost::make_optional(loader_->loadSignatories(account_id));
+      });
+    }
+
+    void InMemoryWsvState::putSignatories(const std::string &account_id,
+                                          std::set<std::string> signatories) {
+      signatories_.put(account_id,
+                       std::move(signatories),
+                       [&] {
+                         return boost::make_optional(
+                             loader_->loadSignatories(account_id));
+                       },
+                       journal_);
+    }
+
+    const std::set<std::string> &InMemoryWsvState::accountRoles(
+        const std::string &account_id) {
+      return *account_roles_.get(account_id, [&] {
+        return boost::make_optional(loader_->loadAccountRoles(account_id));
+      });
+    }
+
+    void InMemoryWsvState::putAccountRoles(const std::string &account_id,
+                                           std::set<std::string> roles) {
+      account_roles_.put(account_id,
+                         std::move(roles),
+                         [&] {
+                           return boost::make_optional(
+                               loader_->loadAccountRoles(account_id));
+                         },
+                         journal_);
+    }
+
+    const boost::optional<shared_model::interface::RolePermissionSet>
+        &InMemoryWsvState::role(const std::string &role_id) {
+      return roles_.get(role_id, [&] { return loader_->loadRole(role_id); });
+    }
+
+    void InMemoryWsvState::putRole(
+        const std::string &role_id,
+        shared_model::interface::RolePermissionSet permissions) {
+      roles_.put(role_id,
+                 std::move(permissions),
+                 [&] { return loader_->loadRole(role_id); },
+                 journal_);
+    }
+
+    const boost::optional<shared_model::interface::GrantablePermissionSet>
+        &InMemoryWsvState::grantablePermissions(
+            const std::string &permittee_account_id,
+            const std::string &account_id) {
+      return grantable_permissions_.get(
+          {permittee_account_id, account_id}, [&] {
+            return loader_->loadGrantablePermissions(permittee_account_id,
+                                                     account_id);
+          });
+    }
+
+    void InMemoryWsvState::putGrantablePermissions(
+        const std::string &permittee_account_id,
+        const std::string &account_id,
+        shared_model::interface::GrantablePermissionSet permissions) {
+      grantable_permissions_.put({permittee_account_id, account_id},
+                                 std::move(permissions),
+                                 [&] {
+                                   return loader_->loadGrantablePermissions(
+                                       permittee_account_id, account_id);
+                                 },
+                                 journal_);
+    }
+
+    const boost::optional<WsvAsset> &InMemoryWsvState::asset(
+        const std::string &asset_id) {
+      return assets_.get(asset_id,
+                         [&] { return loader_->loadAsset(asset_id); });
+    }
+
+    void InMemoryWsvState::putAsset(const std::string &asset_id,
+                                    WsvAsset asset) {
+      assets_.put(asset_id,
+                  std::move(asset),
+                  [&] { return loader_->loadAsset(asset_id); },
+                  journal_);
+    }
+
+    const boost::optional<WsvDecimal> &InMemoryWsvState::balance(
+        const std::string &account_id, const std::string &asset_id) {
+      return balances_.get({account_id, asset_id}, [&] {
+        return loader_->loadBalance(account_id, asset_id);
+      });
+    }
+
+    void InMemoryWsvState::putBalance(const std::string &account_id,
+                                      const std::string &asset_id,
+                                      WsvDecimal balance) {
+      balances_.put(
+          {account_id, asset_id},
+          std::move(balance),
+          [&] { return loader_->loadBalance(account_id, asset_id); },
+          journal_);
+    }
+
+    const boost::optional<std::string> &InMemoryWsvState::peerAddress(
+        const std::string &public_key) {
+      return peers_.get(public_key,
+                        [&] { return loader_->loadPeerAddress(public_key); });
+    }
+
+    bool InMemoryWsvState::peerAddressTaken(const std::string &address) {
+      return static_cast<bool>(peer_addresses_.get(address, [&] {
+        return loader_->loadPeerAddressTaken(address)
+            ? boost::make_optional(true)
+            : boost::none;
+      }));
+    }
+
+    void InMemoryWsvState::putPeer(const std::string &public_key,
+                                   const std::string &address) {
+      peers_.put(public_key,
+                 address,
+                 [&] { return loader_->loadPeerAddress(public_key); },
+                 journal_);
+      peer_addresses_.put(address,
+                          true,
+                          [&] {
+                            return loader_->loadPeerAddressTaken(address)
+                                ? boost::make_optional(true)
+                                : boost::none;
+                          },
+                          journal_);
+    }
+
+    void InMemoryWsvState::appendAccountDetail(WsvAccountDetail detail) {
+      account_details_.push_back(std::move(detail));
+      journal_.emplace_back([this] { account_details_.pop_back(); });
+    }
+
+    void InMemoryWsvState::preload(const WsvStateKeys &keys) {
+      WsvStateKeys missing;
+      auto add_missing = [](const auto &table, const auto &from, auto &to) {
+        for (const auto &key : from) {
+          if (not table.contains(key)) {
+            to.insert(key);
+          }
+        }
+      };
+      add_missing(domains_, keys.domains, missing.domains);
+      for (const auto &account_id : keys.accounts) {
+        if (not accounts_.contains(account_id)
+            or not signatories_.contains(account_id)
+            or not account_roles_.contains(account_id)) {
+          missing.accounts.insert(account_id);
+        }
+      }
+      add_missing(roles_, keys.roles, missing.roles);
+      add_missing(assets_, keys.assets, missing.assets);
+      add_missing(balances_, keys.balances, missing.balances);
+      add_missing(grantable_permissions_,
+                  keys.grantable_permissions,
+                  missing.grantable_permissions);
+      if (missing.empty()) {
+        return;
+      }
+
+      // keys without values are absent entities, which are kept as none
+      auto values = loader_->loadAll(missing);
+      for (const auto &domain_id : missing.domains) {
+        domains_.preload(domain_id, take(values.domains, domain_id));
+      }
+      for (const auto &account_id : missing.accounts) {
+        accounts_.preload(account_id, take(values.accounts, account_id));
+        signatories_.preload(account_id,
+                             take(values.signatories, account_id)
+                                 .value_or(std::set<std::string>{}));
+        account_roles_.preload(account_id,
+                               take(values.account_roles, account_id)
+                                   .value_or(std::set<std::string>{}));
+      }
+      for (const auto &role_id : missing.roles) {
+        roles_.preload(role_id, take(values.roles, role_id));
+      }
+      // the rest are roles of the accounts
+      for (auto &role : values.roles) {
+        roles_.preload(role.first, std::move(role.second));
+      }
+      for (const auto &asset_id : missing.assets) {
+        assets_.preload(asset_id, take(values.assets, asset_id));
+      }
+      for (const auto &key : missing.balances) {
+        balances_.preload(key, take(values.balances, key));
+      }
+      for (const auto &key : missing.grantable_permissions) {
+        grantable_permissions_.preload(
+            key, take(values.grantable_permissions, key));
+      }
+    }
+
+    shared_model::interface::RolePermissionSet
+    InMemoryWsvState::accountPermissions(const std::string &account_id) {
+      shared_model::interface::RolePermissionSet result;
+      for (const auto &role_id : accountRoles(account_id)) {
+        if (const auto &permissions = role(role_id)) {
+          result |= *permissions;
+        }
+      }
+      return result;
+    }
+
+    InMemoryWsvState::Savepoint InMemoryWsvState::savepoint() const {
+      return journal_.size();
+    }
+
+    void InMemoryWsvState::rollbackTo(Savepoint savepoint) {
+      while (journal_.size() > savepoint) {
+        journal_.back()();
+        journal_.pop_back();
+      }
+    }
+
+    InMemoryWsvState::Changes InMemoryWsvState::changes() const {
+      Changes result;
+      roles_.forEachChange([&](const auto &key, const auto &, const auto &to) {
+        if (to) {
+          result.roles.emplace_back(key, *to);
+        }
+      });
+      domains_.forEachChange(
+          [&](const auto &key, const auto &, const auto &to) {
+            if (to) {
+              result.domains.emplace_back(key, *to);
+            }
+          });
+      accounts_.forEachChange(
+          [&](const auto &key, const auto &from, const auto &to) {
+            if (to) {
+              (from ? result.updated_accounts : result.created_accounts)
+                  .emplace_back(key, *to);
+            }
+          });
+      auto set_delta = [](const auto &key, const auto &from, const auto &to) {
+        return Changes::SetDelta{
+            key, difference(*to, *from), difference(*from, *to)};
+      };
+      signatories_.forEachChange(
+          [&](const auto &key, const auto &from, const auto &to) {
+            result.signatories.push_back(set_delta(key, from, to));
+          });
+      account_roles_.forEachChange(
+          [&](const auto &key, const auto &from, const auto &to) {
+            result.account_roles.push_back(set_delta(key, from, to));
+          });
+      grantable_permissions_.forEachChange(
+          [&](const auto &key, const auto &, const auto &to) {
+            if (to) {
+              result.grantable_permissions.emplace_back(
+                  key.first, key.second, *to);
+            }
+          });
+      assets_.forEachChange([&](const auto &key, const auto &, const auto &to) {
+        if (to) {
+          result.assets.emplace_back(key, *to);
+        }
+      });
+      balances_.forEachChange(
+          [&](const auto &key, const auto &, const auto &to) {
+            if (to) {
+              result.balances.emplace_back(key.first, key.second, *to);
+            }
+          });
+      peers_.forEachChange([&](const auto &key, const auto &, const auto &to) {
+        if (to) {
+          result.peers.emplace_back(key, *to);
+        }
+      });
+      result.account_details = account_details_;
+      return result;
+    }
+
+    void InMemoryWsvState::merge(const Changes &changes) {
+      for (const auto &role : changes.roles) {
+        putRole(role.first, role.second);
+      }
+      for (const auto &domain : changes.domains) {
+        putDomain(domain.first, domain.second);
+      }
+      for (const auto &account : changes.created_accounts) {
+        putAccount(account.first, account.second);
+      }
+      for (const auto &account : changes.updated_accounts) {
+        putAccount(account.first, account.second);
+      }
+      auto apply_delta = [](std::set<std::string> set,
+                            const Changes::SetDelta &delta) {
+        for (const auto &item : delta.removed) {
+          set.erase(item);
+        }
+        set.insert(delta.added.begin(), delta.added.end());
+        return set;
+      };
+      for (const auto &delta : changes.signatories) {
+        putSignatories(delta.account_id,
+                       apply_delta(signatories(delta.account_id), delta));
+      }
+      for (const auto &delta : changes.account_roles) {
+        putAccountRoles(delta.account_id,
+                        apply_delta(accountRoles(delta.account_id), delta));
+      }
+      for (const auto &permissions : changes.grantable_permissions) {
+        putGrantablePermissions(std::get<0>(permissions),
+                                std::get<1>(permissions),
+                                std::get<2>(permissions));
+      }
+      for (const auto &asset : changes.assets) {
+        putAsset(asset.first, asset.second);
+      }
+      for (const auto &balance : changes.balances) {
+        putBalance(
+            std::get<0>(balance), std::get<1>(balance), std::get<2>(balance));
+      }
+      for (const auto &peer : changes.peers) {
+        putPeer(peer.first, peer.second);
+      }
+      for (const auto &detail : changes.account_details) {
+        appendAccountDetail(detail);
+      }
+    }
+
+    void InMemoryWsvState::markWritten() {
+      domains_.markWritten();
+      accounts_.markWritten();
+      signatories_.markWritten();
+      account_roles_.markWritten();
+      roles_.markWritten();
+      grantable_permissions_.markWritten();
+      assets_.markWritten();
+      balances_.markWritten();
+      peers_.markWritten();
+      peer_addresses_.markWritten();
+      account_details_.clear();
+      journal_.clear();
+    }
+
+    void InMemoryWsvState::clear() {
+      domains_.clear();
+      accounts_.clear();
+      signatories_.clear();
+      account_roles_.clear();
+      roles_.clear();
+      grantable_permissions_.clear();
+      assets_.clear();
+      balances_.clear();
+      peers_.clear();
+      peer_addresses_.clear();
+      account_details_.clear();
+      journal_.clear();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
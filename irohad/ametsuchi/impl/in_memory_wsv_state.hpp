@@ -0,0 +1,421 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_IN_MEMORY_WSV_STATE_HPP
+#define IROHA_IN_MEMORY_WSV_STATE_HPP
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/optional.hpp>
+#include "interfaces/permissions.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Decimal number with the arithmetic of Postgres numeric type, which
+     * stores asset balances: the scale of a sum or a difference is the largest
+     * scale of the operands. Keeping the scale makes balances computed in
+     * memory textually equal to the ones computed by Postgres.
+     */
+    struct WsvDecimal {
+      /// value multiplied by 10^scale
+      boost::multiprecision::cpp_int value;
+      uint32_t scale{0};
+
+      /**
+       * Parse textual representation of Postgres numeric, e.g. "12.3400"
+       * @return parsed value or none if the string is malformed
+       */
+      static boost::optional<WsvDecimal> fromString(const std::string &str);
+
+      std::string toString() const;
+
+      WsvDecimal operator+(const WsvDecimal &rhs) const;
+      WsvDecimal operator-(const WsvDecimal &rhs) const;
+
+      bool isNegative() const;
+
+      /**
+       * @return true if the value is less than 2^power
+       */
+      bool lessThanPowerOfTwo(uint32_t power) const;
+
+      /// values are equal only if scales are equal too
+      bool operator==(const WsvDecimal &rhs) const;
+      bool operator!=(const WsvDecimal &rhs) const;
+    };
+
+    struct WsvAccount {
+      std::string domain_id;
+      uint32_t quorum;
+
+      bool operator==(const WsvAccount &rhs) const;
+      bool operator!=(const WsvAccount &rhs) const;
+    };
+
+    struct WsvAsset {
+      std::string domain_id;
+      uint32_t precision;
+
+      bool operator==(const WsvAsset &rhs) const;
+      bool operator!=(const WsvAsset &rhs) const;
+    };
+
+    /**
+     * Account detail set by a command. Details are never read by commands, so
+     * they are only recorded to be written back in order.
+     */
+    struct WsvAccountDetail {
+      std::string account_id;
+      std::string writer;
+      std::string key;
+      /// value as a JSON string literal, including the quotes
+      std::string json_value;
+    };
+
+    /**
+     * Entities to be loaded at once, e.g. the ones read by the transactions
+     * of a proposal. Signatories and roles of an account, and permissions of
+     * these roles, are loaded together with the account.
+     */
+    struct WsvStateKeys {
+      using AccountPair = std::pair<std::string, std::string>;
+
+      std::set<std::string> domains;
+      std::set<std::string> accounts;
+      std::set<std::string> roles;
+      std::set<std::string> assets;
+      /// account and asset
+      std::set<AccountPair> balances;
+      /// permittee and account
+      std::set<AccountPair> grantable_permissions;
+
+      bool empty() const;
+    };
+
+    /**
+     * Persisted entities found by the keys; absent entities are not in the
+     * maps. Roles include the roles of the loaded accounts.
+     */
+    struct WsvStateValues {
+      using AccountPair = WsvStateKeys::AccountPair;
+
+      std::map<std::string, std::string> domains;
+      std::map<std::string, WsvAccount> accounts;
+      std::map<std::string, std::set<std::string>> signatories;
+      std::map<std::string, std::set<std::string>> account_roles;
+      std::map<std::string, shared_model::interface::RolePermissionSet> roles;
+      std::map<std::string, WsvAsset> assets;
+      std::map<AccountPair, WsvDecimal> balances;
+      std::map<AccountPair, shared_model::interface::GrantablePermissionSet>
+          grantable_permissions;
+    };
+
+    /**
+     * Source of the state which is not in memory yet, e.g. the Postgres WSV.
+     * Every method returns the persisted value, or none if there is no such
+     * entity.
+     */
+    class WsvStateLoader {
+     public:
+      virtual ~WsvStateLoader() = default;
+
+      /// @return default role of the domain
+      virtual boost::optional<std::string> loadDomain(
+          const std::string &domain_id) = 0;
+
+      virtual boost::optional<WsvAccount> loadAccount(
+          const std::string &account_id) = 0;
+
+      /// @return hex public keys of the account signatories
+      virtual std::set<std::string> loadSignatories(
+          const std::string &account_id) = 0;
+
+      virtual std::set<std::string> loadAccountRoles(
+          const std::string &account_id) = 0;
+
+      virtual boost::optional<shared_model::interface::RolePermissionSet>
+      loadRole(const std::string &role_id) = 0;
+
+      /**
+       * @return permissions granted by account_id to permittee_account_id
+       */
+      virtual boost::optional<shared_model::interface::GrantablePermissionSet>
+      loadGrantablePermissions(const std::string &permittee_account_id,
+                               const std::string &account_id) = 0;
+
+      virtual boost::optional<WsvAsset> loadAsset(
+          const std::string &asset_id) = 0;
+
+      virtual boost::optional<WsvDecimal> loadBalance(
+          const std::string &account_id, const std::string &asset_id) = 0;
+
+      /// @return address of the peer with the hex public key
+      virtual boost::optional<std::string> loadPeerAddress(
+          const std::string &public_key) = 0;
+
+      /// @return true if some peer has the address
+      virtual bool loadPeerAddressTaken(const std::string &address) = 0;
+
+      /**
+       * Load all the entities with the keys. Loads them one by one by default,
+       * a database loader should override it with a single query.
+       */
+      virtual WsvStateValues loadAll(const WsvStateKeys &keys);
+    };
+
+    /**
+     * Part of the world state view, which is kept in memory while commands are
+     * validated and applied. Entities are read through the loader on the first
+     * access, or all at once by preload(), and then served from memory.
+     *
+     * Every write saves the previous value in a journal, so the state can be
+     * rolled back to a savepoint without copying untouched entities. Net
+     * changes against the loaded values are reported by changes() to be
+     * written back in one batch.
+     *
+     * The class is not thread-safe.
+     */
+    class InMemoryWsvState {
+     public:
+      using Savepoint = size_t;
+
+      /**
+       * Net changes of the state since it was loaded or last marked as
+       * written
+       */
+      struct Changes {
+        struct SetDelta {
+          std::string account_id;
+          std::vector<std::string> added;
+          std::vector<std::string> removed;
+        };
+
+        std::vector<
+            std::pair<std::string, shared_model::interface::RolePermissionSet>>
+            roles;
+        /// domain ids with default roles
+        std::vector<std::pair<std::string, std::string>> domains;
+        std::vector<std::pair<std::string, WsvAccount>> created_accounts;
+        std::vector<std::pair<std::string, WsvAccount>> updated_accounts;
+        std::vector<SetDelta> signatories;
+        std::vector<SetDelta> account_roles;
+        /// permittee, account and permissions
+        std::vector<
+            std::tuple<std::string,
+                       std::string,
+                       shared_model::interface::GrantablePermissionSet>>
+            grantable_permissions;
+        std::vector<std::pair<std::string, WsvAsset>> assets;
+        /// account, asset and balance
+        std::vector<std::tuple<std::string, std::string, WsvDecimal>> balances;
+        /// public keys with addresses
+        std::vector<std::pair<std::string, std::string>> peers;
+        std::vector<WsvAccountDetail> account_details;
+
+        bool empty() const;
+      };
+
+      explicit InMemoryWsvState(std::shared_ptr<WsvStateLoader> loader);
+
+      const boost::optional<std::string> &domain(const std::string &domain_id);
+      void putDomain(const std::string &domain_id, std::string default_role);
+
+      const boost::optional<WsvAccount> &account(const std::string &account_id);
+      void putAccount(const std::string &account_id, WsvAccount account);
+
+      const std::set<std::string> &signatories(const std::string &account_id);
+      void putSignatories(const std::string &account_id,
+                          std::set<std::string> signatories);
+
+      const std::set<std::string> &accountRoles(const std::string &account_id);
+      void putAccountRoles(const std::string &account_id,
+                           std::set<std::string> roles);
+
+      const boost::optional<shared_model::interface::RolePermissionSet> &role(
+          const std::string &role_id);
+      void putRole(const std::string &role_id,
+                   shared_model::interface::RolePermissionSet permissions);
+
+      const boost::optional<shared_model::interface::GrantablePermissionSet>
+          &grantablePermissions(const std::string &permittee_account_id,
+                                const std::string &account_id);
+      void putGrantablePermissions(
+          const std::string &permittee_account_id,
+          const std::string &account_id,
+          shared_model::interface::GrantablePermissionSet permissions);
+
+      const boost::optional<WsvAsset> &asset(const std::string &asset_id);
+      void putAsset(const std::string &asset_id, WsvAsset asset);
+
+      const boost::optional<WsvDecimal> &balance(const std::string &account_id,
+                                                 const std::string &asset_id);
+      void putBalance(const std::string &account_id,
+                      const std::string &asset_id,
+                      WsvDecimal balance);
+
+      const boost::optional<std::string> &peerAddress(
+          const std::string &public_key);
+      bool peerAddressTaken(const std::string &address);
+      void putPeer(const std::string &public_key, const std::string &address);
+
+      void appendAccountDetail(WsvAccountDetail detail);
+
+      /**
+       * Load the entities, which are not in memory yet, at once instead of on
+       * the first access to each of them
+       */
+      void preload(const WsvStateKeys &keys);
+
+      /**
+       * @return union of permissions of all roles of the account
+       */
+      shared_model::interface::RolePermissionSet accountPermissions(
+          const std::string &account_id);
+
+      /**
+       * @return savepoint to roll the state back to
+       */
+      Savepoint savepoint() const;
+
+      /**
+       * Undo all writes made after the savepoint was created
+       */
+      void rollbackTo(Savepoint savepoint);
+
+      Changes changes() const;
+
+      /**
+       * Write changes made by another state over the same persisted state,
+       * e.g. by a state of a concurrent validation of independent
+       * transactions
+       */
+      void merge(const Changes &changes);
+
+      /**
+       * Make the current state the baseline of changes(), e.g. after the
+       * changes are written back. Drops all savepoints.
+       */
+      void markWritten();
+
+      /**
+       * Forget all entities, so they will be loaded again, e.g. after the
+       * persisted state was rolled back. Drops all savepoints.
+       */
+      void clear();
+
+     private:
+      /**
+       * Map from a key to a loaded value and a current one. Absent entities
+       * are stored as none, so they are not loaded twice.
+       */
+      template <typename Key, typename Value, typename Hasher = std::hash<Key>>
+      class Table {
+       public:
+        struct Entry {
+          boost::optional<Value> loaded;
+          boost::optional<Value> current;
+        };
+
+        template <typename Load>
+        const boost::optional<Value> &get(const Key &key, Load &&load) {
+          return entry(key, std::forward<Load>(load)).current;
+        }
+
+        template <typename Load>
+        void put(const Key &key,
+                 boost::optional<Value> value,
+                 Load &&load,
+                 std::vector<std::function<void()>> &journal) {
+          auto &e = entry(key, std::forward<Load>(load));
+          journal.emplace_back(
+              [&e, previous = std::move(e.current)] { e.current = previous; });
+          e.current = std::move(value);
+        }
+
+        template <typename Function>
+        void forEachChange(Function &&function) const {
+          for (const auto &item : entries_) {
+            if (item.second.loaded != item.second.current) {
+              function(item.first, item.second.loaded, item.second.current);
+            }
+          }
+        }
+
+        bool contains(const Key &key) const {
+          return entries_.count(key) != 0;
+        }
+
+        /// keeps the entry if the key is in memory already
+        void preload(const Key &key, boost::optional<Value> value) {
+          if (not contains(key)) {
+            entries_.emplace(key, Entry{value, value});
+          }
+        }
+
+        void markWritten() {
+          for (auto &item : entries_) {
+            item.second.loaded = item.second.current;
+          }
+        }
+
+        void clear() {
+          entries_.clear();
+        }
+
+       private:
+        template <typename Load>
+        Entry &entry(const Key &key, Load &&load) {
+          auto it = entries_.find(key);
+          if (it == entries_.end()) {
+            auto value = std::forward<Load>(load)();
+            it = entries_.emplace(key, Entry{value, value}).first;
+          }
+          return it->second;
+        }
+
+        // node-based map keeps references to entries valid for the journal
+        std::unordered_map<Key, Entry, Hasher> entries_;
+      };
+
+      using AccountPair = std::pair<std::string, std::string>;
+      using AccountPairHasher = boost::hash<AccountPair>;
+
+      std::shared_ptr<WsvStateLoader> loader_;
+
+      Table<std::string, std::string> domains_;
+      Table<std::string, WsvAccount> accounts_;
+      Table<std::string, std::set<std::string>> signatories_;
+      Table<std::string, std::set<std::string>> account_roles_;
+      Table<std::string, shared_model::interface::RolePermissionSet> roles_;
+      Table<AccountPair,
+            shared_model::interface::GrantablePermissionSet,
+            AccountPairHasher>
+          grantable_permissions_;
+      Table<std::string, WsvAsset> assets_;
+      Table<AccountPair, WsvDecimal, AccountPairHasher> balances_;
+      Table<std::string, std::string> peers_;
+      Table<std::string, bool> peer_addresses_;
+      std::vector<WsvAccountDetail> account_details_;
+
+      /// undo actions of all writes, the last write is at the back
+      std::vector<std::function<void()>> journal_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_IN_MEMORY_WSV_STATE_HPP
@@ -5,12 +5,17 @@
 
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 
+#include <chrono>
+
 #include <boost/variant/apply_visitor.hpp>
+#include "ametsuchi/impl/in_memory_wsv_keys.hpp"
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_state_storage.hpp"
 #include "interfaces/commands/command.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "interfaces/iroha_internal/block.hpp"
@@ -19,7 +24,8 @@ namespace iroha {
   namespace ametsuchi {
     MutableStorageImpl::MutableStorageImpl(
         shared_model::interface::types::HashType top_hash,
-        std::shared_ptr<PostgresCommandExecutor> cmd_executor,
+        std::shared_ptr<CommandExecutor> cmd_executor,
+        std::shared_ptr<InMemoryWsvState> wsv_state,
         std::unique_ptr<soci::session> sql,
         std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory,
         logger::Logger log)
@@ -29,6 +35,10 @@ namespace iroha {
               std::make_shared<PostgresWsvQuery>(*sql_, std::move(factory)))),
           block_index_(std::make_unique<PostgresBlockIndex>(*sql_)),
           command_executor_(std::move(cmd_executor)),
+          postgres_command_executor_(
+              std::dynamic_pointer_cast<PostgresCommandExecutor>(
+                  command_executor_)),
+          wsv_state_(std::move(wsv_state)),
           committed(false),
           log_(std::move(log)) {
       *sql_ << "BEGIN";
@@ -57,14 +67,51 @@ namespace iroha {
                            execute_command);
       };
 
+      // the block was validated, so queries of all its commands are sent
+      // together instead of waiting for the result of each one
+      auto execute_deferred = [this] {
+        if (not postgres_command_executor_) {
+          return true;
+        }
+        return postgres_command_executor_->executeDeferred().match(
+            [](expected::Value<void> &) { return true; },
+            [&](expected::Error<CommandError> &e) {
+              log_->error(e.error.toString());
+              return false;
+            });
+      };
+
       log_->info("Applying block: height {}, hash {}",
                  block.height(),
                  block.hash().hex());
+      auto start_time = std::chrono::steady_clock::now();
 
+      if (postgres_command_executor_) {
+        postgres_command_executor_->deferExecution();
+      }
+      auto wsv_savepoint = wsv_state_ ? wsv_state_->savepoint() : 0;
+      if (wsv_state_) {
+        // the state read by all the transactions is loaded with one query
+        WsvStateKeys keys;
+        for (const auto &transaction : block.transactions()) {
+          collectWsvStateKeys(transaction, keys);
+        }
+        wsv_state_->preload(keys);
+      }
       auto block_applied = predicate(block, *peer_query_, top_hash_)
           and std::all_of(block.transactions().begin(),
                           block.transactions().end(),
-                          execute_transaction);
+                          execute_transaction)
+          and execute_deferred();
+      if (wsv_state_) {
+        // the next block is checked against the persisted state, so the
+        // changes are written after each block
+        if (block_applied) {
+          PostgresWsvStateStorage(*sql_).writeBack(*wsv_state_);
+        } else {
+          wsv_state_->rollbackTo(wsv_savepoint);
+        }
+      }
       if (block_applied) {
         block_store_.insert(std::make_pair(block.height(), clone(block)));
         block_index_->index(block);
@@ -72,6 +119,12 @@ namespace iroha {
         top_hash_ = block.hash();
       }
 
+      log_->info("Block {} {} in {} us",
+                 block.height(),
+                 block_applied ? "applied" : "rejected",
+                 std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::steady_clock::now() - start_time)
+                     .count());
       return block_applied;
     }
 
@@ -86,14 +139,24 @@ namespace iroha {
           *sql_ << "RELEASE SAVEPOINT savepoint_";
         } else {
           *sql_ << "ROLLBACK TO SAVEPOINT savepoint_";
+          resetWsvState();
         }
         return function_executed;
       } catch (std::exception &e) {
         log_->warn("Apply has failed. Reason: {}", e.what());
+        resetWsvState();
         return false;
       }
     }
 
+    void MutableStorageImpl::resetWsvState() {
+      // blocks written before the failed one may have been rolled back too,
+      // so the state is reloaded from Postgres
+      if (wsv_state_) {
+        wsv_state_->clear();
+      }
+    }
+
     bool MutableStorageImpl::apply(
         const shared_model::interface::Block &block) {
       return withSavepoint([&] {
@@ -18,15 +18,22 @@
 namespace iroha {
   namespace ametsuchi {
     class BlockIndex;
+    class InMemoryWsvState;
     class PostgresCommandExecutor;
 
     class MutableStorageImpl : public MutableStorage {
       friend class StorageImpl;
 
      public:
+      /**
+       * @param wsv_state - state used by the command executor, if commands
+       * are executed in memory; its changes are written to Postgres after
+       * each block. Null if commands are executed by Postgres.
+       */
       MutableStorageImpl(
           shared_model::interface::types::HashType top_hash,
-          std::shared_ptr<PostgresCommandExecutor> cmd_executor,
+          std::shared_ptr<CommandExecutor> cmd_executor,
+          std::shared_ptr<InMemoryWsvState> wsv_state,
           std::unique_ptr<soci::session> sql,
           std::shared_ptr<shared_model::interface::CommonObjectsFactory>
               factory,
@@ -49,6 +56,11 @@ namespace iroha {
       template <typename Function>
       bool withSavepoint(Function &&function);
 
+      /**
+       * Drop the in-memory state after the persisted one was rolled back
+       */
+      void resetWsvState();
+
       /**
        * Verifies whether the block is applicable using predicate, and applies
        * the block
@@ -66,6 +78,9 @@ namespace iroha {
       std::unique_ptr<PeerQuery> peer_query_;
       std::unique_ptr<BlockIndex> block_index_;
       std::shared_ptr<CommandExecutor> command_executor_;
+      /// the same executor, if commands are executed by Postgres
+      std::shared_ptr<PostgresCommandExecutor> postgres_command_executor_;
+      std::shared_ptr<InMemoryWsvState> wsv_state_;
 
       bool committed;
 
@@ -5,6 +5,9 @@
 
 #include "ametsuchi/impl/postgres_block_query.hpp"
 
+#include <unordered_map>
+
+#include <soci/boost-tuple.h>
 #include <boost/format.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm/for_each.hpp>
@@ -77,7 +80,8 @@ namespace iroha {
       const auto &hash_str = hash.hex();
 
       try {
-        sql_ << "SELECT status FROM tx_status_by_hash WHERE hash = :hash",
+        sql_ << "SELECT status FROM tx_status_by_hash "
+                "WHERE hash = decode(:hash, 'hex')",
             soci::into(res), soci::use(hash_str);
       } catch (const std::exception &e) {
         log_->error("Failed to execute query: {}", e.what());
@@ -98,6 +102,52 @@ namespace iroha {
           tx_cache_status_responses::Missing{hash});
     }
 
+    boost::optional<std::vector<TxCacheStatusType>>
+    PostgresBlockQuery::checkTxPresence(
+        const std::vector<shared_model::crypto::Hash> &hashes) {
+      std::vector<TxCacheStatusType> statuses;
+      if (hashes.empty()) {
+        return statuses;
+      }
+
+      // hex hashes are passed as one array literal
+      std::string hashes_str = "{";
+      for (const auto &hash : hashes) {
+        hashes_str += hash.hex() + ",";
+      }
+      hashes_str.back() = '}';
+
+      // status by hex hash of the found transactions
+      std::unordered_map<std::string, int> found;
+      try {
+        soci::rowset<boost::tuple<std::string, int>> rows =
+            (sql_.prepare << "SELECT encode(hash, 'hex'), status::integer "
+                             "FROM tx_status_by_hash WHERE hash = ANY("
+                             "SELECT decode(h, 'hex') "
+                             "FROM unnest(CAST(:hashes AS text[])) AS h)",
+             soci::use(hashes_str));
+        for (const auto &row : rows) {
+          found.emplace(row.get<0>(), row.get<1>());
+        }
+      } catch (const std::exception &e) {
+        log_->error("Failed to execute query: {}", e.what());
+        return boost::none;
+      }
+
+      statuses.reserve(hashes.size());
+      for (const auto &hash : hashes) {
+        auto it = found.find(hash.hex());
+        if (it == found.end()) {
+          statuses.emplace_back(tx_cache_status_responses::Missing{hash});
+        } else if (it->second > 0) {
+          statuses.emplace_back(tx_cache_status_responses::Committed{hash});
+        } else {
+          statuses.emplace_back(tx_cache_status_responses::Rejected{hash});
+        }
+      }
+      return statuses;
+    }
+
     uint32_t PostgresBlockQuery::getTopBlockHeight() {
       return block_store_.last_id();
     }
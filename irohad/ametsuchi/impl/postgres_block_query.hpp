@@ -52,6 +52,9 @@ namespace iroha {
       boost::optional<TxCacheStatusType> checkTxPresence(
           const shared_model::crypto::Hash &hash) override;
 
+      boost::optional<std::vector<TxCacheStatusType>> checkTxPresence(
+          const std::vector<shared_model::crypto::Hash> &hashes) override;
+
       expected::Result<wBlock, std::string> getTopBlock() override;
 
      private:
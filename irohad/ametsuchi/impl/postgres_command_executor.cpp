@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 
+#include <cstdlib>
+
 #include <soci/postgresql/soci-postgresql.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
@@ -795,6 +797,7 @@ namespace iroha {
             perm_converter)
         : sql_(sql),
           do_validation_(true),
+          defer_execution_(false),
           perm_converter_{std::move(perm_converter)} {}
 
     void PostgresCommandExecutor::setCreatorAccountId(
@@ -807,6 +810,80 @@ namespace iroha {
       do_validation_ = do_validation;
     }
 
+    void PostgresCommandExecutor::deferExecution() {
+      defer_execution_ = true;
+      deferred_queries_.clear();
+    }
+
+    CommandResult PostgresCommandExecutor::executeDeferred() {
+      defer_execution_ = false;
+      auto queries = std::move(deferred_queries_);
+      deferred_queries_.clear();
+      if (queries.empty()) {
+        return {};
+      }
+
+      std::string batch;
+      for (const auto &query : queries) {
+        batch.append(query.query).append(";\n");
+      }
+
+      // a simple query with several statements is sent in one round trip,
+      // and libpq returns a result for each statement until the first error
+      auto conn =
+          static_cast<soci::postgresql_session_backend *>(sql_.get_backend())
+              ->conn_;
+      if (PQsendQuery(conn, batch.c_str()) == 0) {
+        auto &query = queries.front();
+        return getCommandError(std::move(query.command_name),
+                               PQerrorMessage(conn),
+                               [&query] { return query.query_args; });
+      }
+
+      boost::optional<CommandResult> error;
+      size_t index = 0;
+      // all results have to be read before the connection is used again
+      while (auto result = PQgetResult(conn)) {
+        std::unique_ptr<PGresult, decltype(&PQclear)> result_guard(result,
+                                                                   &PQclear);
+        if (error or index >= queries.size()) {
+          continue;
+        }
+        auto &query = queries[index++];
+        auto query_args = [&query] { return query.query_args; };
+        if (PQresultStatus(result) != PGRES_TUPLES_OK) {
+          error = getCommandError(std::move(query.command_name),
+                                  PQresultErrorMessage(result),
+                                  query_args);
+        } else if (auto code =
+                       std::strtoul(PQgetvalue(result, 0, 0), nullptr, 10)) {
+          error = makeCommandError(std::move(query.command_name),
+                                   static_cast<uint32_t>(code),
+                                   query_args);
+        }
+      }
+      if (error) {
+        return *error;
+      }
+      return {};
+    }
+
+    template <typename QueryArgsCallable>
+    CommandResult PostgresCommandExecutor::execute(
+        const std::string &query,
+        std::string command_name,
+        QueryArgsCallable &&query_args) {
+      if (defer_execution_) {
+        deferred_queries_.push_back(
+            {query, std::move(command_name), query_args()});
+        return {};
+      }
+      return executeQuery(sql_,
+                          query,
+                          std::move(command_name),
+                          std::forward<QueryArgsCallable>(query_args));
+    }
+
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddAssetQuantity &command) {
       auto &account_id = creator_account_id_;
@@ -830,8 +907,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "AddAssetQuantity", std::move(str_args));
+      return execute(cmd.str(), "AddAssetQuantity", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -850,7 +926,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AddPeer", std::move(str_args));
+      return execute(cmd.str(), "AddPeer", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -870,7 +946,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AddSignatory", std::move(str_args));
+      return execute(cmd.str(), "AddSignatory", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -890,7 +966,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AppendRole", std::move(str_args));
+      return execute(cmd.str(), "AppendRole", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -915,8 +991,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "CreateAccount", std::move(str_args));
+      return execute(cmd.str(), "CreateAccount", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -938,7 +1013,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateAsset", std::move(str_args));
+      return execute(cmd.str(), "CreateAsset", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -958,7 +1033,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateDomain", std::move(str_args));
+      return execute(cmd.str(), "CreateDomain", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -981,7 +1056,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateRole", std::move(str_args));
+      return execute(cmd.str(), "CreateRole", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1001,7 +1076,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "DetachRole", std::move(str_args));
+      return execute(cmd.str(), "DetachRole", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1032,8 +1107,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "GrantPermission", std::move(str_args));
+      return execute(cmd.str(), "GrantPermission", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1053,8 +1127,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "RemoveSignatory", std::move(str_args));
+      return execute(cmd.str(), "RemoveSignatory", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1087,8 +1160,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "RevokePermission", std::move(str_args));
+      return execute(cmd.str(), "RevokePermission", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1121,8 +1193,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "SetAccountDetail", std::move(str_args));
+      return execute(cmd.str(), "SetAccountDetail", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1142,7 +1213,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "SetQuorum", std::move(str_args));
+      return execute(cmd.str(), "SetQuorum", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1168,8 +1239,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "SubtractAssetQuantity", std::move(str_args));
+      return execute(cmd.str(), "SubtractAssetQuantity", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1198,8 +1268,7 @@ namespace iroha {
                 .finalize();
           };
 
-      return executeQuery(
-          sql_, cmd.str(), "TransferAsset", std::move(str_args));
+      return execute(cmd.str(), "TransferAsset", std::move(str_args));
     }
 
     void PostgresCommandExecutor::prepareStatements(soci::session &sql) {
@@ -31,6 +31,20 @@ namespace iroha {
 
       void doValidation(bool do_validation) override;
 
+      /**
+       * Collect queries of the following commands instead of executing them
+       * one by one; the commands report success until the queries are
+       * executed by executeDeferred()
+       */
+      void deferExecution();
+
+      /**
+       * Execute queries collected since deferExecution() in one round trip to
+       * the database and execute the following commands immediately again
+       * @return error of the first failed command, if any
+       */
+      CommandResult executeDeferred();
+
       CommandResult operator()(
           const shared_model::interface::AddAssetQuantity &command) override;
 
@@ -83,8 +97,26 @@ namespace iroha {
       static void prepareStatements(soci::session &sql);
 
      private:
+      /// query of a command, which execution is deferred
+      struct DeferredQuery {
+        std::string query;
+        std::string command_name;
+        std::string query_args;
+      };
+
+      /**
+       * Execute the query of a command, or collect it if execution is
+       * deferred
+       */
+      template <typename QueryArgsCallable>
+      CommandResult execute(const std::string &query,
+                            std::string command_name,
+                            QueryArgsCallable &&query_args);
+
       soci::session &sql_;
       bool do_validation_;
+      bool defer_execution_;
+      std::vector<DeferredQuery> deferred_queries_;
 
       shared_model::interface::types::AccountIdType creator_account_id_;
       std::shared_ptr<shared_model::interface::PermissionToString>
@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/postgres_query_executor.hpp"
 
+#include <set>
+
 #include <boost-tuple.h>
 #include <soci/boost-tuple.h>
 #include <soci/postgresql/soci-postgresql.h>
@@ -156,6 +158,33 @@ namespace iroha {
                                                            RangeGen &&range_gen,
                                                            Pred &&pred) {
       std::vector<std::unique_ptr<shared_model::interface::Transaction>> result;
+      if (auto parts = block_store_.parts(block_id)) {
+        // only the requested transactions are read and deserialized
+        for (auto i : range_gen(parts->size())) {
+          if (i >= parts->size()) {
+            log_->error("No transaction {} in block {}", i, block_id);
+            continue;
+          }
+          auto serialized_tx = block_store_.get(block_id, (*parts)[i]);
+          if (not serialized_tx) {
+            log_->error(
+                "Failed to retrieve transaction {} of block {}", i, block_id);
+            continue;
+          }
+          converter_->deserializeTransaction(bytesToString(*serialized_tx))
+              .match(
+                  [&](auto &&tx) {
+                    if (pred(*tx.value)) {
+                      result.push_back(std::move(tx.value));
+                    }
+                  },
+                  [this](const auto &e) { log_->error(e.error); });
+        }
+        return result;
+      }
+
+      // blocks, which were stored without positions of transactions, are
+      // read as a whole
       auto serialized_block = block_store_.get(block_id);
       if (not serialized_block) {
         log_->error("Failed to retrieve block with id {}", block_id);
@@ -443,7 +472,7 @@ namespace iroha {
 
       // select tx with specified hash
       auto first_by_hash = R"(SELECT height, index FROM position_by_hash
-      WHERE hash = :hash LIMIT 1)";
+      WHERE hash = decode(:hash, 'hex') LIMIT 1)";
 
       // select first ever tx
       auto first_tx = R"(SELECT height, index FROM position_by_hash
@@ -732,7 +761,9 @@ namespace iroha {
 
     QueryExecutorResult PostgresQueryExecutorVisitor::operator()(
         const shared_model::interface::GetTransactions &q) {
-      auto escape = [](auto &hash) { return "'" + hash.hex() + "'"; };
+      auto escape = [](auto &hash) {
+        return "decode('" + hash.hex() + "', 'hex')";
+      };
       std::string hash_str = std::accumulate(
           std::next(q.transactionHashes().begin()),
           q.transactionHashes().end(),
@@ -740,16 +771,17 @@ namespace iroha {
           [&escape](auto &acc, auto &val) { return acc + "," + escape(val); });
 
       using QueryTuple =
-          QueryType<shared_model::interface::types::HeightType, std::string>;
+          QueryType<shared_model::interface::types::HeightType, uint64_t>;
       using PermissionTuple = boost::tuple<int, int>;
 
       auto cmd =
           (boost::format(R"(WITH has_my_perm AS (%s),
       has_all_perm AS (%s),
       t AS (
-          SELECT height, hash FROM position_by_hash WHERE hash IN (%s)
+          SELECT height, index FROM position_by_hash
+          WHERE hash IN (%s)
       )
-      SELECT height, hash, has_my_perm.perm, has_all_perm.perm FROM t
+      SELECT height, index, has_my_perm.perm, has_all_perm.perm FROM t
       RIGHT OUTER JOIN has_my_perm ON TRUE
       RIGHT OUTER JOIN has_all_perm ON TRUE
       )") % getAccountRolePermissionCheckSql(Role::kGetMyTxs, "account_id")
@@ -772,10 +804,12 @@ namespace iroha {
                   "At least one of the supplied hashes is incorrect",
                   4);
             }
-            std::map<uint64_t, std::unordered_set<std::string>> index;
+            // positions of the transactions are known, so only they are
+            // read from the blocks
+            std::map<uint64_t, std::set<uint64_t>> index;
             boost::for_each(range, [&index](auto t) {
-              apply(t, [&index](auto &height, auto &hash) {
-                index[height].insert(hash);
+              apply(t, [&index](auto &height, auto &idx) {
+                index[height].insert(idx);
               });
             });
 
@@ -784,14 +818,10 @@ namespace iroha {
             for (auto &block : index) {
               auto txs = this->getTransactionsFromBlock(
                   block.first,
-                  [](auto size) {
-                    return boost::irange(static_cast<decltype(size)>(0), size);
-                  },
+                  [&block](auto) { return block.second; },
                   [&](auto &tx) {
-                    return block.second.count(tx.hash().hex()) > 0
-                        and (all_perm
-                             or (my_perm
-                                 and tx.creatorAccountId() == creator_id_));
+                    return all_perm
+                        or (my_perm and tx.creatorAccountId() == creator_id_);
                   });
               std::move(
                   txs.begin(), txs.end(), std::back_inserter(response_txs));
@@ -1084,18 +1114,53 @@ namespace iroha {
 
     QueryExecutorResult PostgresQueryExecutorVisitor::operator()(
         const shared_model::interface::GetPendingTransactions &q) {
-      std::vector<std::unique_ptr<shared_model::interface::Transaction>>
-          response_txs;
-      auto interface_txs =
-          pending_txs_storage_->getPendingTransactions(creator_id_);
-      response_txs.reserve(interface_txs.size());
-
-      std::transform(interface_txs.begin(),
-                     interface_txs.end(),
-                     std::back_inserter(response_txs),
-                     [](auto &tx) { return clone(*tx); });
-      return query_response_factory_->createTransactionsResponse(
-          std::move(response_txs), query_hash_);
+      auto clone_txs = [](const auto &interface_txs) {
+        std::vector<std::unique_ptr<shared_model::interface::Transaction>>
+            response_txs;
+        response_txs.reserve(interface_txs.size());
+        std::transform(interface_txs.begin(),
+                       interface_txs.end(),
+                       std::back_inserter(response_txs),
+                       [](auto &tx) { return clone(*tx); });
+        return response_txs;
+      };
+
+      auto pagination_meta = q.paginationMeta();
+      if (not pagination_meta) {
+        // all the pending transactions at once, as before pagination
+        auto interface_txs =
+            pending_txs_storage_->getPendingTransactions(creator_id_);
+        return query_response_factory_->createTransactionsResponse(
+            clone_txs(interface_txs), query_hash_);
+      }
+
+      const auto first_hash = pagination_meta->firstTxHash();
+      return pending_txs_storage_
+          ->getPendingTransactions(
+              creator_id_, pagination_meta->pageSize(), first_hash)
+          .match(
+              [&](auto &page) -> QueryExecutorResult {
+                auto &response = page.value;
+                if (response.next_tx_hash) {
+                  return query_response_factory_
+                      ->createTransactionsPageResponse(
+                          clone_txs(response.transactions),
+                          *response.next_tx_hash,
+                          response.all_transactions_size,
+                          query_hash_);
+                }
+                return query_response_factory_->createTransactionsPageResponse(
+                    clone_txs(response.transactions),
+                    response.all_transactions_size,
+                    query_hash_);
+              },
+              [&](auto &) -> QueryExecutorResult {
+                auto error = (boost::format("invalid pagination hash: %s")
+                              % first_hash->hex())
+                                 .str();
+                return this->logAndReturnErrorResponse(
+                    QueryErrorType::kStatefulFailed, error, 4);
+              });
     }
 
     template <typename ReturnValueType>
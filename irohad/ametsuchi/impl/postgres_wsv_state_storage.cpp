@@ -0,0 +1,389 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_wsv_state_storage.hpp"
+
+#include <soci/boost-tuple.h>
+#include <boost/algorithm/string/replace.hpp>
+#include <boost/format.hpp>
+
+namespace {
+  /// SQL string literal
+  std::string quote(const std::string &str) {
+    return "'" + boost::algorithm::replace_all_copy(str, "'", "''") + "'";
+  }
+
+  /// SQL array literal of strings, e.g. {"a","b"}
+  template <typename Strings>
+  std::string arrayLiteral(const Strings &strings) {
+    std::string result = "{";
+    for (const auto &str : strings) {
+      result.push_back('"');
+      for (auto c : str) {
+        if (c == '"' or c == '\\') {
+          result.push_back('\\');
+        }
+        result.push_back(c);
+      }
+      result.append("\",");
+    }
+    if (result.size() > 1) {
+      result.pop_back();
+    }
+    return result + "}";
+  }
+
+  /// entities of a batch load are told apart by the first column
+  const std::string kLoadAllQuery = R"(
+WITH domain_ids AS (SELECT unnest(CAST(:domains AS text[])) AS id),
+account_ids AS (SELECT unnest(CAST(:accounts AS text[])) AS id),
+role_ids AS (
+  SELECT unnest(CAST(:roles AS text[])) AS id
+  UNION SELECT role_id FROM account_has_roles
+  WHERE account_id IN (SELECT id FROM account_ids)),
+asset_ids AS (SELECT unnest(CAST(:assets AS text[])) AS id),
+balance_ids AS (
+  SELECT * FROM unnest(CAST(:balance_accounts AS text[]),
+                       CAST(:balance_assets AS text[]))
+  AS t(account_id, asset_id)),
+grantable_ids AS (
+  SELECT * FROM unnest(CAST(:permittees AS text[]),
+                       CAST(:grantors AS text[]))
+  AS t(permittee_account_id, account_id))
+SELECT 'domain', domain_id::text, NULL::text, default_role::text FROM domain
+WHERE domain_id IN (SELECT id FROM domain_ids)
+UNION ALL
+SELECT 'account', account_id, domain_id, quorum::text FROM account
+WHERE account_id IN (SELECT id FROM account_ids)
+UNION ALL
+SELECT 'signatory', account_id, public_key, NULL FROM account_has_signatory
+WHERE account_id IN (SELECT id FROM account_ids)
+UNION ALL
+SELECT 'account_role', account_id, role_id, NULL FROM account_has_roles
+WHERE account_id IN (SELECT id FROM account_ids)
+UNION ALL
+SELECT 'role', r.role_id, NULL, rp.permission::text FROM role AS r
+LEFT JOIN role_has_permissions AS rp ON rp.role_id = r.role_id
+WHERE r.role_id IN (SELECT id FROM role_ids)
+UNION ALL
+SELECT 'asset', asset_id, domain_id, precision::text FROM asset
+WHERE asset_id IN (SELECT id FROM asset_ids)
+UNION ALL
+SELECT 'balance', account_id, asset_id, amount::text FROM account_has_asset
+WHERE (account_id, asset_id) IN (SELECT account_id, asset_id FROM balance_ids)
+UNION ALL
+SELECT 'grantable', permittee_account_id, account_id, permission::text
+FROM account_has_grantable_permissions
+WHERE (permittee_account_id, account_id) IN (
+  SELECT permittee_account_id, account_id FROM grantable_ids)
+)";
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    PostgresWsvStateStorage::PostgresWsvStateStorage(soci::session &sql)
+        : sql_(sql) {}
+
+    boost::optional<std::string> PostgresWsvStateStorage::loadDomain(
+        const std::string &domain_id) {
+      std::string default_role;
+      sql_ << "SELECT default_role FROM domain WHERE domain_id = :domain_id",
+          soci::into(default_role), soci::use(domain_id);
+      return boost::make_optional(sql_.got_data(), default_role);
+    }
+
+    boost::optional<WsvAccount> PostgresWsvStateStorage::loadAccount(
+        const std::string &account_id) {
+      std::string domain_id;
+      int quorum = 0;
+      sql_ << "SELECT domain_id, quorum FROM account "
+              "WHERE account_id = :account_id",
+          soci::into(domain_id), soci::into(quorum), soci::use(account_id);
+      return boost::make_optional(
+          sql_.got_data(),
+          WsvAccount{std::move(domain_id), static_cast<uint32_t>(quorum)});
+    }
+
+    std::set<std::string> PostgresWsvStateStorage::loadSignatories(
+        const std::string &account_id) {
+      soci::rowset<std::string> rows =
+          (sql_.prepare << "SELECT public_key FROM account_has_signatory "
+                           "WHERE account_id = :account_id",
+           soci::use(account_id));
+      return {rows.begin(), rows.end()};
+    }
+
+    std::set<std::string> PostgresWsvStateStorage::loadAccountRoles(
+        const std::string &account_id) {
+      soci::rowset<std::string> rows =
+          (sql_.prepare << "SELECT role_id FROM account_has_roles "
+                           "WHERE account_id = :account_id",
+           soci::use(account_id));
+      return {rows.begin(), rows.end()};
+    }
+
+    boost::optional<shared_model::interface::RolePermissionSet>
+    PostgresWsvStateStorage::loadRole(const std::string &role_id) {
+      boost::optional<std::string> permission;
+      sql_ << "SELECT rp.permission FROM role AS r "
+              "LEFT JOIN role_has_permissions AS rp ON rp.role_id = r.role_id "
+              "WHERE r.role_id = :role_id",
+          soci::into(permission), soci::use(role_id);
+      if (not sql_.got_data()) {
+        return boost::none;
+      }
+      return permission
+          ? shared_model::interface::RolePermissionSet(*permission)
+          : shared_model::interface::RolePermissionSet{};
+    }
+
+    boost::optional<shared_model::interface::GrantablePermissionSet>
+    PostgresWsvStateStorage::loadGrantablePermissions(
+        const std::string &permittee_account_id,
+        const std::string &account_id) {
+      std::string permission;
+      sql_ << "SELECT permission FROM account_has_grantable_permissions "
+              "WHERE permittee_account_id = :permittee_account_id "
+              "AND account_id = :account_id",
+          soci::into(permission), soci::use(permittee_account_id),
+          soci::use(account_id);
+      if (not sql_.got_data()) {
+        return boost::none;
+      }
+      return shared_model::interface::GrantablePermissionSet(permission);
+    }
+
+    boost::optional<WsvAsset> PostgresWsvStateStorage::loadAsset(
+        const std::string &asset_id) {
+      std::string domain_id;
+      int precision = 0;
+      sql_ << "SELECT domain_id, precision FROM asset "
+              "WHERE asset_id = :asset_id",
+          soci::into(domain_id), soci::into(precision), soci::use(asset_id);
+      return boost::make_optional(
+          sql_.got_data(),
+          WsvAsset{std::move(domain_id), static_cast<uint32_t>(precision)});
+    }
+
+    boost::optional<WsvDecimal> PostgresWsvStateStorage::loadBalance(
+        const std::string &account_id, const std::string &asset_id) {
+      std::string amount;
+      sql_ << "SELECT amount FROM account_has_asset "
+              "WHERE account_id = :account_id AND asset_id = :asset_id",
+          soci::into(amount), soci::use(account_id), soci::use(asset_id);
+      if (not sql_.got_data()) {
+        return boost::none;
+      }
+      return WsvDecimal::fromString(amount);
+    }
+
+    boost::optional<std::string> PostgresWsvStateStorage::loadPeerAddress(
+        const std::string &public_key) {
+      std::string address;
+      sql_ << "SELECT address FROM peer WHERE public_key = :public_key",
+          soci::into(address), soci::use(public_key);
+      return boost::make_optional(sql_.got_data(), address);
+    }
+
+    bool PostgresWsvStateStorage::loadPeerAddressTaken(
+        const std::string &address) {
+      int found = 0;
+      sql_ << "SELECT 1 FROM peer WHERE address = :address",
+          soci::into(found), soci::use(address);
+      return sql_.got_data();
+    }
+
+    WsvStateValues PostgresWsvStateStorage::loadAll(
+        const WsvStateKeys &keys) {
+      // pairs are passed as two arrays of the same length
+      auto unzip = [](const std::set<WsvStateKeys::AccountPair> &pairs) {
+        std::vector<std::string> first, second;
+        for (const auto &pair : pairs) {
+          first.push_back(pair.first);
+          second.push_back(pair.second);
+        }
+        return std::make_pair(arrayLiteral(first), arrayLiteral(second));
+      };
+      const auto domains = arrayLiteral(keys.domains);
+      const auto accounts = arrayLiteral(keys.accounts);
+      const auto roles = arrayLiteral(keys.roles);
+      const auto assets = arrayLiteral(keys.assets);
+      const auto balances = unzip(keys.balances);
+      const auto grantable_permissions = unzip(keys.grantable_permissions);
+
+      using Row = boost::tuple<std::string,
+                               std::string,
+                               boost::optional<std::string>,
+                               boost::optional<std::string>>;
+      soci::rowset<Row> rows =
+          (sql_.prepare << kLoadAllQuery,
+           soci::use(domains),
+           soci::use(accounts),
+           soci::use(roles),
+           soci::use(assets),
+           soci::use(balances.first),
+           soci::use(balances.second),
+           soci::use(grantable_permissions.first),
+           soci::use(grantable_permissions.second));
+
+      WsvStateValues values;
+      for (const auto &row : rows) {
+        const auto &kind = row.get<0>();
+        const auto &key = row.get<1>();
+        const auto second_key = row.get<2>().value_or("");
+        const auto value = row.get<3>().value_or("");
+        if (kind == "domain") {
+          values.domains.emplace(key, value);
+        } else if (kind == "account") {
+          values.accounts.emplace(
+              key,
+              WsvAccount{second_key, static_cast<uint32_t>(std::stoul(value))});
+        } else if (kind == "signatory") {
+          values.signatories[key].insert(second_key);
+        } else if (kind == "account_role") {
+          values.account_roles[key].insert(second_key);
+        } else if (kind == "role") {
+          values.roles.emplace(
+              key,
+              row.get<3>()
+                  ? shared_model::interface::RolePermissionSet(value)
+                  : shared_model::interface::RolePermissionSet{});
+        } else if (kind == "asset") {
+          values.assets.emplace(
+              key,
+              WsvAsset{second_key, static_cast<uint32_t>(std::stoul(value))});
+        } else if (kind == "balance") {
+          if (auto balance = WsvDecimal::fromString(value)) {
+            values.balances.emplace(std::make_pair(key, second_key),
+                                    std::move(*balance));
+          }
+        } else if (kind == "grantable") {
+          values.grantable_permissions.emplace(
+              std::make_pair(key, second_key),
+              shared_model::interface::GrantablePermissionSet(value));
+        }
+      }
+      return values;
+    }
+
+    void PostgresWsvStateStorage::writeBack(InMemoryWsvState &state) {
+      auto query = makeWriteBackQuery(state.changes());
+      if (not query.empty()) {
+        sql_ << query;
+      }
+      state.markWritten();
+    }
+
+    std::string PostgresWsvStateStorage::makeWriteBackQuery(
+        const InMemoryWsvState::Changes &changes) {
+      // statements are ordered so that foreign keys are satisfied
+      std::string query;
+      auto append = [&query](const boost::format &statement) {
+        query.append(statement.str()).append(";\n");
+      };
+
+      for (const auto &role : changes.roles) {
+        append(boost::format("INSERT INTO role(role_id) VALUES (%1%) "
+                             "ON CONFLICT DO NOTHING")
+               % quote(role.first));
+        append(boost::format(
+                   "INSERT INTO role_has_permissions(role_id, permission) "
+                   "VALUES (%1%, '%2%') ON CONFLICT (role_id) "
+                   "DO UPDATE SET permission = EXCLUDED.permission")
+               % quote(role.first) % role.second.toBitstring());
+      }
+      for (const auto &domain : changes.domains) {
+        append(boost::format(
+                   "INSERT INTO domain(domain_id, default_role) "
+                   "VALUES (%1%, %2%) ON CONFLICT (domain_id) "
+                   "DO UPDATE SET default_role = EXCLUDED.default_role")
+               % quote(domain.first) % quote(domain.second));
+      }
+      for (const auto &account : changes.created_accounts) {
+        append(boost::format("INSERT INTO account(account_id, domain_id, "
+                             "quorum, data) VALUES (%1%, %2%, %3%, '{}')")
+               % quote(account.first) % quote(account.second.domain_id)
+               % account.second.quorum);
+      }
+      for (const auto &account : changes.updated_accounts) {
+        append(boost::format("UPDATE account SET domain_id = %2%, quorum = %3% "
+                             "WHERE account_id = %1%")
+               % quote(account.first) % quote(account.second.domain_id)
+               % account.second.quorum);
+      }
+      for (const auto &delta : changes.signatories) {
+        for (const auto &public_key : delta.removed) {
+          append(boost::format("DELETE FROM account_has_signatory "
+                               "WHERE account_id = %1% AND public_key = %2%")
+                 % quote(delta.account_id) % quote(public_key));
+        }
+        for (const auto &public_key : delta.added) {
+          append(boost::format("INSERT INTO signatory(public_key) VALUES (%1%) "
+                               "ON CONFLICT DO NOTHING")
+                 % quote(public_key));
+          append(boost::format("INSERT INTO account_has_signatory(account_id, "
+                               "public_key) VALUES (%1%, %2%)")
+                 % quote(delta.account_id) % quote(public_key));
+        }
+      }
+      for (const auto &delta : changes.account_roles) {
+        for (const auto &role_id : delta.removed) {
+          append(boost::format("DELETE FROM account_has_roles "
+                               "WHERE account_id = %1% AND role_id = %2%")
+                 % quote(delta.account_id) % quote(role_id));
+        }
+        for (const auto &role_id : delta.added) {
+          append(boost::format("INSERT INTO account_has_roles(account_id, "
+                               "role_id) VALUES (%1%, %2%)")
+                 % quote(delta.account_id) % quote(role_id));
+        }
+      }
+      for (const auto &permissions : changes.grantable_permissions) {
+        append(boost::format(
+                   "INSERT INTO account_has_grantable_permissions"
+                   "(permittee_account_id, account_id, permission) "
+                   "VALUES (%1%, %2%, '%3%') "
+                   "ON CONFLICT (permittee_account_id, account_id) "
+                   "DO UPDATE SET permission = EXCLUDED.permission")
+               % quote(std::get<0>(permissions))
+               % quote(std::get<1>(permissions))
+               % std::get<2>(permissions).toBitstring());
+      }
+      for (const auto &asset : changes.assets) {
+        append(boost::format("INSERT INTO asset(asset_id, domain_id, "
+                             "precision, data) VALUES (%1%, %2%, %3%, NULL)")
+               % quote(asset.first) % quote(asset.second.domain_id)
+               % asset.second.precision);
+      }
+      for (const auto &balance : changes.balances) {
+        append(boost::format(
+                   "INSERT INTO account_has_asset(account_id, asset_id, "
+                   "amount) VALUES (%1%, %2%, '%3%') "
+                   "ON CONFLICT (account_id, asset_id) "
+                   "DO UPDATE SET amount = EXCLUDED.amount")
+               % quote(std::get<0>(balance)) % quote(std::get<1>(balance))
+               % std::get<2>(balance).toString());
+      }
+      for (const auto &peer : changes.peers) {
+        append(boost::format("INSERT INTO peer(public_key, address) "
+                             "VALUES (%1%, %2%)")
+               % quote(peer.first) % quote(peer.second));
+      }
+      // same update as the one of Postgres command executor
+      for (const auto &detail : changes.account_details) {
+        append(boost::format(
+                   "UPDATE account SET data = jsonb_set("
+                   "CASE WHEN data ? %2% THEN data "
+                   "ELSE jsonb_set(data, ARRAY[%2%], '{}') END, "
+                   "ARRAY[%2%, %3%], %4%) WHERE account_id = %1%")
+               % quote(detail.account_id) % quote(detail.writer)
+               % quote(detail.key) % quote(detail.json_value));
+      }
+      return query;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_WSV_STATE_STORAGE_HPP
+#define IROHA_POSTGRES_WSV_STATE_STORAGE_HPP
+
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
+
+#include <soci/soci.h>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Loads the in-memory world state from Postgres and writes its changes
+     * back. Both are done in the transaction of the given session.
+     */
+    class PostgresWsvStateStorage : public WsvStateLoader {
+     public:
+      explicit PostgresWsvStateStorage(soci::session &sql);
+
+      boost::optional<std::string> loadDomain(
+          const std::string &domain_id) override;
+
+      boost::optional<WsvAccount> loadAccount(
+          const std::string &account_id) override;
+
+      std::set<std::string> loadSignatories(
+          const std::string &account_id) override;
+
+      std::set<std::string> loadAccountRoles(
+          const std::string &account_id) override;
+
+      boost::optional<shared_model::interface::RolePermissionSet> loadRole(
+          const std::string &role_id) override;
+
+      boost::optional<shared_model::interface::GrantablePermissionSet>
+      loadGrantablePermissions(const std::string &permittee_account_id,
+                               const std::string &account_id) override;
+
+      boost::optional<WsvAsset> loadAsset(const std::string &asset_id) override;
+
+      boost::optional<WsvDecimal> loadBalance(
+          const std::string &account_id, const std::string &asset_id) override;
+
+      boost::optional<std::string> loadPeerAddress(
+          const std::string &public_key) override;
+
+      bool loadPeerAddressTaken(const std::string &address) override;
+
+      /// loads all the entities with a single query
+      WsvStateValues loadAll(const WsvStateKeys &keys) override;
+
+      /**
+       * Write net changes of the state in one batch and make them the new
+       * baseline of the state
+       * @throws soci::soci_error if the batch fails
+       */
+      void writeBack(InMemoryWsvState &state);
+
+      /**
+       * @return SQL statements which apply the changes, empty if there are no
+       * changes
+       */
+      static std::string makeWriteBackQuery(
+          const InMemoryWsvState::Changes &changes);
+
+     private:
+      soci::session &sql_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_WSV_STATE_STORAGE_HPP
@@ -8,6 +8,9 @@
 #include <soci/postgresql/soci-postgresql.h>
 #include <boost/format.hpp>
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/in_memory_command_executor.hpp"
+#include "ametsuchi/impl/in_memory_temporary_wsv.hpp"
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
@@ -15,6 +18,7 @@
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_query_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_state_storage.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "common/bind.hpp"
@@ -65,6 +69,7 @@ namespace iroha {
             perm_converter,
         size_t pool_size,
         bool enable_prepared_blocks,
+        WsvEngine wsv_engine,
         logger::Logger log)
         : block_store_dir_(std::move(block_store_dir)),
           postgres_options_(std::move(postgres_options)),
@@ -76,6 +81,7 @@ namespace iroha {
           log_(std::move(log)),
           pool_size_(pool_size),
           prepared_blocks_enabled_(enable_prepared_blocks),
+          wsv_engine_(wsv_engine),
           block_is_prepared(false) {
       prepared_block_name_ =
           "prepared_block" + postgres_options_.dbname().value_or("");
@@ -107,6 +113,10 @@ namespace iroha {
         rollbackPrepared(*sql);
       }
 
+      if (wsv_engine_ == WsvEngine::kInMemory) {
+        return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+            std::make_unique<InMemoryTemporaryWsv>(std::move(sql)));
+      }
       return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
           std::make_unique<TemporaryWsvImpl>(
               std::move(sql), factory_, perm_converter_));
@@ -128,6 +138,16 @@ namespace iroha {
       if (block_is_prepared) {
         rollbackPrepared(*sql);
       }
+      std::shared_ptr<InMemoryWsvState> wsv_state;
+      std::shared_ptr<CommandExecutor> command_executor;
+      if (wsv_engine_ == WsvEngine::kInMemory) {
+        wsv_state = std::make_shared<InMemoryWsvState>(
+            std::make_shared<PostgresWsvStateStorage>(*sql));
+        command_executor = std::make_shared<InMemoryCommandExecutor>(wsv_state);
+      } else {
+        command_executor =
+            std::make_shared<PostgresCommandExecutor>(*sql, perm_converter_);
+      }
       auto block_result = getBlockQuery()->getTopBlock();
       return expected::makeValue<std::unique_ptr<MutableStorage>>(
           std::make_unique<MutableStorageImpl>(
@@ -139,7 +159,8 @@ namespace iroha {
                   [](expected::Error<std::string> &) {
                     return shared_model::interface::types::HashType("");
                   }),
-              std::make_shared<PostgresCommandExecutor>(*sql, perm_converter_),
+              std::move(command_executor),
+              std::move(wsv_state),
               std::move(sql),
               factory_));
     }
@@ -356,7 +377,8 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::BlockJsonConverter> converter,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
-        size_t pool_size) {
+        size_t pool_size,
+        WsvEngine wsv_engine) {
       boost::optional<std::string> string_res = boost::none;
 
       PostgresOptions options(postgres_options);
@@ -394,7 +416,8 @@ namespace iroha {
                                       converter,
                                       perm_converter,
                                       pool_size,
-                                      enable_prepared_transactions)));
+                                      enable_prepared_transactions,
+                                      wsv_engine)));
                 },
                 [&](expected::Error<std::string> &error) { storage = error; });
           },
@@ -495,14 +518,20 @@ namespace iroha {
     }
 
     void StorageImpl::prepareBlock(std::unique_ptr<TemporaryWsv> wsv) {
-      auto &wsv_impl = static_cast<TemporaryWsvImpl &>(*wsv);
       if (not prepared_blocks_enabled_) {
         log_->warn("prepared block are not enabled");
         return;
       }
       if (not block_is_prepared) {
-        soci::session &sql = *wsv_impl.sql_;
+        auto in_memory_wsv = dynamic_cast<InMemoryTemporaryWsv *>(wsv.get());
+        soci::session &sql = in_memory_wsv
+            ? *in_memory_wsv->sql_
+            : *static_cast<TemporaryWsvImpl &>(*wsv).sql_;
         try {
+          // in-memory state has to reach the transaction before it is prepared
+          if (in_memory_wsv) {
+            in_memory_wsv->writeBack();
+          }
           sql << "PREPARE TRANSACTION '" + prepared_block_name_ + "';";
           block_is_prepared = true;
         } catch (const std::exception &e) {
@@ -530,7 +559,24 @@ namespace iroha {
       auto json_result = converter_->serialize(block);
       return json_result.match(
           [this, &block](const expected::Value<std::string> &v) {
-            block_store_->add(block.height(), stringToBytes(v.value));
+            // positions of transactions let queries read them without the
+            // rest of the block
+            converter_->transactionPositions(v.value).match(
+                [&](const auto &positions) {
+                  KeyValueStorage::Parts parts;
+                  parts.reserve(positions.value.size());
+                  for (const auto &position : positions.value) {
+                    parts.push_back({position.offset, position.size});
+                  }
+                  block_store_->add(
+                      block.height(), stringToBytes(v.value), parts);
+                },
+                [&](const auto &error) {
+                  log_->warn("Cannot find transactions of block {}: {}",
+                             block.height(),
+                             error.error);
+                  block_store_->add(block.height(), stringToBytes(v.value));
+                });
             notifier_.get_subscriber().on_next(clone(block));
             return true;
           },
@@ -553,6 +599,8 @@ DROP TABLE IF EXISTS signatory;
 DROP TABLE IF EXISTS peer;
 DROP TABLE IF EXISTS role;
 DROP TABLE IF EXISTS height_by_hash;
+DROP INDEX IF EXISTS position_by_hash_hash_index;
+DROP TABLE IF EXISTS position_by_hash;
 DROP INDEX IF EXISTS tx_status_by_hash_hash_index;
 DROP TABLE IF EXISTS tx_status_by_hash;
 DROP TABLE IF EXISTS height_by_account_set;
@@ -646,15 +694,33 @@ CREATE TABLE IF NOT EXISTS account_has_grantable_permissions (
     PRIMARY KEY (permittee_account_id, account_id)
 );
 CREATE TABLE IF NOT EXISTS position_by_hash (
-    hash varchar,
+    hash bytea,
     height text,
     index text
 );
-
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
-    hash varchar,
+    hash bytea,
     status boolean
 );
+-- databases created before hashes were stored as bytea keep hex varchar
+DO $$
+BEGIN
+    IF EXISTS (SELECT 1 FROM information_schema.columns
+               WHERE table_schema = current_schema()
+                   AND table_name = 'position_by_hash'
+                   AND column_name = 'hash' AND data_type <> 'bytea') THEN
+        ALTER TABLE position_by_hash
+            ALTER COLUMN hash TYPE bytea USING decode(hash, 'hex');
+    END IF;
+    IF EXISTS (SELECT 1 FROM information_schema.columns
+               WHERE table_schema = current_schema()
+                   AND table_name = 'tx_status_by_hash'
+                   AND column_name = 'hash' AND data_type <> 'bytea') THEN
+        ALTER TABLE tx_status_by_hash
+            ALTER COLUMN hash TYPE bytea USING decode(hash, 'hex');
+    END IF;
+END $$;
+CREATE INDEX IF NOT EXISTS position_by_hash_hash_index ON position_by_hash USING hash (hash);
 CREATE INDEX IF NOT EXISTS tx_status_by_hash_hash_index ON tx_status_by_hash USING hash (hash);
 
 CREATE TABLE IF NOT EXISTS height_by_account_set (
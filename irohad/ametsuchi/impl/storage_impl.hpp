@@ -17,6 +17,7 @@
 
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "ametsuchi/key_value_storage.hpp"
+#include "ametsuchi/wsv_engine.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "interfaces/iroha_internal/block_json_converter.hpp"
 #include "interfaces/permission_to_string.hpp"
@@ -47,6 +48,9 @@ namespace iroha {
       initPostgresConnection(std::string &options_str, size_t pool_size);
 
      public:
+      /// number of Postgres connections kept by the storage by default
+      static constexpr size_t kDefaultPoolSize = 10;
+
       static expected::Result<std::shared_ptr<StorageImpl>, std::string> create(
           std::string block_store_dir,
           std::string postgres_connection,
@@ -56,7 +60,8 @@ namespace iroha {
               converter,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
-          size_t pool_size = 10);
+          size_t pool_size = kDefaultPoolSize,
+          WsvEngine wsv_engine = WsvEngine::kPostgres);
 
       expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() override;
@@ -127,6 +132,7 @@ namespace iroha {
                       perm_converter,
                   size_t pool_size,
                   bool enable_prepared_blocks,
+                  WsvEngine wsv_engine,
                   logger::Logger log = logger::log("StorageImpl"));
 
       /**
@@ -170,6 +176,8 @@ namespace iroha {
 
       bool prepared_blocks_enabled_;
 
+      WsvEngine wsv_engine_;
+
       std::atomic<bool> block_is_prepared;
 
       std::string prepared_block_name_;
@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 
+#include <unordered_map>
+
 #include "common/bind.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -17,19 +19,87 @@ namespace iroha {
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::check(
         const shared_model::crypto::Hash &hash) const {
+      std::shared_ptr<BlockQuery> block_query;
+      return checkHash(hash, block_query);
+    }
+
+    boost::optional<TxPresenceCache::BatchStatusCollectionType>
+    TxPresenceCacheImpl::check(
+        const shared_model::interface::TransactionBatch &batch) const {
+      std::shared_ptr<BlockQuery> block_query;
+      return checkBatch(batch, block_query);
+    }
+
+    std::vector<boost::optional<TxPresenceCache::BatchStatusCollectionType>>
+    TxPresenceCacheImpl::check(const BatchesType &batches) const {
+      using shared_model::crypto::Hash;
+      // statuses from the memory cache of all the transactions in order
+      std::vector<boost::optional<TxCacheStatusType>> cached;
+      // transactions, which are not in the memory cache, are checked in the
+      // storage at once
+      std::vector<Hash> queried;
+      std::unordered_map<Hash, size_t, Hash::Hasher> positions;
+      for (const auto &batch : batches) {
+        for (const auto &tx : batch->transactions()) {
+          const auto &hash = tx->hash();
+          cached.push_back(memory_cache_.findItem(hash));
+          if (not cached.back()
+              and positions.emplace(hash, queried.size()).second) {
+            queried.push_back(hash);
+          }
+        }
+      }
+
+      boost::optional<std::vector<TxCacheStatusType>> stored;
+      if (not queried.empty()) {
+        stored = checkInStorage(queried);
+      }
+
+      std::vector<boost::optional<BatchStatusCollectionType>> statuses;
+      statuses.reserve(batches.size());
+      auto status = cached.begin();
+      for (const auto &batch : batches) {
+        BatchStatusCollectionType batch_statuses;
+        bool checked = true;
+        for (const auto &tx : batch->transactions()) {
+          if (*status) {
+            batch_statuses.push_back(**status);
+          } else if (stored) {
+            batch_statuses.push_back((*stored)[positions.at(tx->hash())]);
+          } else {
+            checked = false;
+          }
+          ++status;
+        }
+        statuses.push_back(
+            boost::make_optional(checked, std::move(batch_statuses)));
+      }
+      return statuses;
+    }
+
+    boost::optional<TxCacheStatusType> TxPresenceCacheImpl::checkHash(
+        const shared_model::crypto::Hash &hash,
+        std::shared_ptr<BlockQuery> &block_query) const {
       auto res = memory_cache_.findItem(hash);
       if (res) {
         return *res;
       }
-      return checkInStorage(hash);
+      if (not block_query) {
+        block_query = storage_->getBlockQuery();
+        if (not block_query) {
+          return boost::none;
+        }
+      }
+      return checkInStorage(hash, *block_query);
     }
 
     boost::optional<TxPresenceCache::BatchStatusCollectionType>
-    TxPresenceCacheImpl::check(
-        const shared_model::interface::TransactionBatch &batch) const {
+    TxPresenceCacheImpl::checkBatch(
+        const shared_model::interface::TransactionBatch &batch,
+        std::shared_ptr<BlockQuery> &block_query) const {
       TxPresenceCache::BatchStatusCollectionType batch_statuses;
       for (const auto &tx : batch.transactions()) {
-        if (auto status = check(tx->hash())) {
+        if (auto status = checkHash(tx->hash(), block_query)) {
           batch_statuses.emplace_back(*status);
         } else {
           return boost::none;
@@ -39,12 +109,9 @@ namespace iroha {
     }
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::checkInStorage(
-        const shared_model::crypto::Hash &hash) const {
-      auto block_query = storage_->getBlockQuery();
-      if (not block_query) {
-        return boost::none;
-      }
-      return block_query->checkTxPresence(hash) |
+        const shared_model::crypto::Hash &hash,
+        BlockQuery &block_query) const {
+      return block_query.checkTxPresence(hash) |
           [this, &hash](const auto &status) {
             visit_in_place(status,
                            [](const tx_cache_status_responses::Missing &) {
@@ -57,5 +124,28 @@ namespace iroha {
             return status;
           };
     }
+
+    boost::optional<std::vector<TxCacheStatusType>>
+    TxPresenceCacheImpl::checkInStorage(
+        const std::vector<shared_model::crypto::Hash> &hashes) const {
+      auto block_query = storage_->getBlockQuery();
+      if (not block_query) {
+        return boost::none;
+      }
+      auto statuses = block_query->checkTxPresence(hashes);
+      if (statuses) {
+        for (const auto &status : *statuses) {
+          visit_in_place(status,
+                         [](const tx_cache_status_responses::Missing &) {
+                           // don't put this hash into cache since "Missing"
+                           // can become "Committed" or "Rejected" later
+                         },
+                         [this](const auto &status) {
+                           memory_cache_.addItem(status.hash, status);
+                         });
+        }
+      }
+      return statuses;
+    }
   }  // namespace ametsuchi
 }  // namespace iroha
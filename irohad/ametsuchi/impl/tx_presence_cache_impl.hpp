@@ -24,15 +24,57 @@ namespace iroha {
           const shared_model::interface::TransactionBatch &batch)
           const override;
 
+      /**
+       * Check statuses of several batches with one storage query for all the
+       * transactions, which are not in the memory cache
+       */
+      std::vector<boost::optional<BatchStatusCollectionType>> check(
+          const BatchesType &batches) const override;
+
      private:
+      /**
+       * Check hash status in the memory cache and then in the storage
+       * @param hash to check
+       * @param block_query - query to the storage, it is created on the first
+       * request if empty
+       * @return hash status if storage query was successful, boost::none
+       * otherwise
+       */
+      boost::optional<TxCacheStatusType> checkHash(
+          const shared_model::crypto::Hash &hash,
+          std::shared_ptr<BlockQuery> &block_query) const;
+
+      /**
+       * Check statuses of the transactions of the batch
+       * @param batch to check
+       * @param block_query - query to the storage, it is created on the first
+       * request if empty
+       * @return transaction statuses if storage queries were successful,
+       * boost::none otherwise
+       */
+      boost::optional<BatchStatusCollectionType> checkBatch(
+          const shared_model::interface::TransactionBatch &batch,
+          std::shared_ptr<BlockQuery> &block_query) const;
+
       /**
        * Performs an actual storage request about hash status
        * @param hash to check
+       * @param block_query - query to the storage
        * @return hash status if storage query was successful, boost::none
        * otherwise
        */
       boost::optional<TxCacheStatusType> checkInStorage(
-          const shared_model::crypto::Hash &hash) const;
+          const shared_model::crypto::Hash &hash,
+          BlockQuery &block_query) const;
+
+      /**
+       * Performs one storage request about statuses of several hashes
+       * @param hashes to check
+       * @return hash statuses in the same order if storage query was
+       * successful, boost::none otherwise
+       */
+      boost::optional<std::vector<TxCacheStatusType>> checkInStorage(
+          const std::vector<shared_model::crypto::Hash> &hashes) const;
 
       std::shared_ptr<Storage> storage_;
       mutable cache::Cache<shared_model::crypto::Hash,
@@ -25,6 +25,15 @@ namespace iroha {
       using Identifier = uint32_t;
       using Bytes = std::vector<uint8_t>;
 
+      /**
+       * Position of a part of the entity data
+       */
+      struct Part {
+        uint64_t offset;
+        uint64_t size;
+      };
+      using Parts = std::vector<Part>;
+
       /**
        * Add entity with binary data
        * @param id - reference key
@@ -32,6 +41,17 @@ namespace iroha {
        */
       virtual bool add(Identifier id, const Bytes &blob) = 0;
 
+      /**
+       * Add entity with binary data along with positions of its parts, so
+       * that the parts can be read without reading the whole entity
+       * @param id - reference key
+       * @param blob - data associated with key
+       * @param parts - positions of the parts in the data
+       */
+      virtual bool add(Identifier id,
+                       const Bytes &blob,
+                       const Parts &parts) = 0;
+
       /**
        * Get data associated with
        * @param id - reference key
@@ -39,6 +59,22 @@ namespace iroha {
        */
       virtual boost::optional<Bytes> get(Identifier id) const = 0;
 
+      /**
+       * Get positions of parts of the data associated with
+       * @param id - reference key
+       * @return - positions, if the entity was added along with them
+       */
+      virtual boost::optional<Parts> parts(Identifier id) const = 0;
+
+      /**
+       * Get a part of the data associated with
+       * @param id - reference key
+       * @param part - position of the part
+       * @return - bytes of the part, if the entity exists and contains it
+       */
+      virtual boost::optional<Bytes> get(Identifier id,
+                                         const Part &part) const = 0;
+
       /**
        * @return folder of storage
        */
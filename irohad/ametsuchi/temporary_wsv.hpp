@@ -7,8 +7,10 @@
 #define IROHA_TEMPORARYWSV_HPP
 
 #include <functional>
+#include <vector>
 
 #include "common/result.hpp"
+#include "interfaces/common_objects/range_types.hpp"
 #include "validation/stateful_validator_common.hpp"
 
 namespace shared_model {
@@ -55,6 +57,27 @@ namespace iroha {
       virtual std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
           const std::string &name) = 0;
 
+      /**
+       * Take over state changes of another temporary wsv, which applied
+       * transactions independent of the ones applied to this temporary wsv
+       * @param other - temporary wsv created by the same factory
+       * @return true if the changes were taken over, false if transactions of
+       * the other temporary wsv have to be applied to this one again
+       */
+      virtual bool merge(TemporaryWsv &other) {
+        return false;
+      }
+
+      /**
+       * Load the state, which the transactions are going to read, at once
+       * instead of on the first access to each entity
+       * @param batches - transactions to be applied
+       */
+      virtual void prefetch(
+          const std::vector<
+              shared_model::interface::types::TransactionsCollectionType>
+              &batches) {}
+
       virtual ~TemporaryWsv() = default;
     };
   }  // namespace ametsuchi
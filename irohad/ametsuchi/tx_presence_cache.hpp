@@ -6,6 +6,7 @@
 #ifndef IROHA_TX_PRESENCE_CACHE_HPP
 #define IROHA_TX_PRESENCE_CACHE_HPP
 
+#include <memory>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -48,8 +49,24 @@ namespace iroha {
       virtual boost::optional<BatchStatusCollectionType> check(
           const shared_model::interface::TransactionBatch &batch) const = 0;
 
-      // TODO: 09/11/2018 @muratovv add method for processing collection of
-      // batches IR-1857
+      /// batches, whose statuses are checked at once
+      using BatchesType = std::vector<
+          std::shared_ptr<shared_model::interface::TransactionBatch>>;
+
+      /**
+       * Check statuses of several batches at once
+       * @return a collection with answers about each batch in the same order,
+       * an answer is boost::none if storage queries for the batch failed
+       */
+      virtual std::vector<boost::optional<BatchStatusCollectionType>> check(
+          const BatchesType &batches) const {
+        std::vector<boost::optional<BatchStatusCollectionType>> statuses;
+        statuses.reserve(batches.size());
+        for (const auto &batch : batches) {
+          statuses.push_back(check(*batch));
+        }
+        return statuses;
+      }
 
       virtual ~TxPresenceCache() = default;
     };
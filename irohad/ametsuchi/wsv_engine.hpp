@@ -0,0 +1,46 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMETSUCHI_WSV_ENGINE_HPP
+#define IROHA_AMETSUCHI_WSV_ENGINE_HPP
+
+#include <string>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Engine which executes commands of transactions and blocks
+     */
+    enum class WsvEngine {
+      /// commands are executed by Postgres statements
+      kPostgres,
+      /// commands are executed on an in-memory copy of the touched state,
+      /// whose net changes are written to Postgres once per block
+      kInMemory
+    };
+
+    /**
+     * Parse engine name as it is written in the configuration file
+     * @param name - "postgres" or "memory"
+     * @return engine, none if the name is unknown
+     */
+    inline boost::optional<WsvEngine> wsvEngineFromString(
+        const std::string &name) {
+      if (name == "postgres") {
+        return WsvEngine::kPostgres;
+      }
+      if (name == "memory") {
+        return WsvEngine::kInMemory;
+      }
+      return boost::none;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMETSUCHI_WSV_ENGINE_HPP
@@ -7,10 +7,12 @@
 #define IROHA_CLUSTER_ORDER_HPP
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/optional.hpp>
 #include "consensus/yac/yac_types.hpp"
+#include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -36,6 +38,16 @@ namespace iroha {
             const std::vector<std::shared_ptr<shared_model::interface::Peer>>
                 &order);
 
+        /**
+         * Creates cluster ordering of the same peers in another order. The
+         * lookup of peers by public key is shared with this ordering.
+         * @param order - permutation of peers of this ordering
+         * @return ordering which starts from the first peer of the order
+         */
+        ClusterOrdering reordered(
+            std::vector<std::shared_ptr<shared_model::interface::Peer>> order)
+            const;
+
         /**
          * Provide current leader peer
          */
@@ -52,7 +64,16 @@ namespace iroha {
          */
         bool hasNext() const;
 
-        std::vector<std::shared_ptr<shared_model::interface::Peer>> getPeers()
+        const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+            &getPeers() const;
+
+        /**
+         * Find peer of the ordering by its public key
+         * @param public_key - key of the peer
+         * @return peer if it is in the ordering, boost::none otherwise
+         */
+        boost::optional<std::shared_ptr<shared_model::interface::Peer>>
+        findPeer(const shared_model::interface::types::PubkeyType &public_key)
             const;
 
         PeersNumberType getNumberOfPeers() const;
@@ -62,11 +83,18 @@ namespace iroha {
         ClusterOrdering() = delete;
 
        private:
+        /// peers by hex of their public keys
+        using PeersByKey = std::unordered_map<
+            std::string,
+            std::shared_ptr<shared_model::interface::Peer>>;
+
         // prohibit creation of the object not from create method
-        explicit ClusterOrdering(
-            std::vector<std::shared_ptr<shared_model::interface::Peer>> order);
+        ClusterOrdering(
+            std::vector<std::shared_ptr<shared_model::interface::Peer>> order,
+            std::shared_ptr<const PeersByKey> peers_by_key);
 
         std::vector<std::shared_ptr<shared_model::interface::Peer>> order_;
+        std::shared_ptr<const PeersByKey> peers_by_key_;
         PeersNumberType index_ = 0;
       };
     }  // namespace yac
@@ -5,6 +5,9 @@
 
 #include "consensus/yac/cluster_order.hpp"
 
+#include "cryptography/public_key.hpp"
+#include "interfaces/common_objects/peer.hpp"
+
 namespace iroha {
   namespace consensus {
     namespace yac {
@@ -15,12 +18,23 @@ namespace iroha {
         if (order.empty()) {
           return boost::none;
         }
-        return ClusterOrdering(order);
+        auto peers_by_key = std::make_shared<PeersByKey>();
+        for (const auto &peer : order) {
+          peers_by_key->emplace(peer->pubkey().hex(), peer);
+        }
+        return ClusterOrdering(order, std::move(peers_by_key));
       }
 
       ClusterOrdering::ClusterOrdering(
+          std::vector<std::shared_ptr<shared_model::interface::Peer>> order,
+          std::shared_ptr<const PeersByKey> peers_by_key)
+          : order_(std::move(order)), peers_by_key_(std::move(peers_by_key)) {}
+
+      ClusterOrdering ClusterOrdering::reordered(
           std::vector<std::shared_ptr<shared_model::interface::Peer>> order)
-          : order_(std::move(order)) {}
+          const {
+        return ClusterOrdering(std::move(order), peers_by_key_);
+      }
 
       // TODO :  24/03/2018 x3medima17: make it const, IR-1164
       const shared_model::interface::Peer &ClusterOrdering::currentLeader() {
@@ -39,11 +53,21 @@ namespace iroha {
         return *this;
       }
 
-      std::vector<std::shared_ptr<shared_model::interface::Peer>>
-      ClusterOrdering::getPeers() const {
+      const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+          &ClusterOrdering::getPeers() const {
         return order_;
       }
 
+      boost::optional<std::shared_ptr<shared_model::interface::Peer>>
+      ClusterOrdering::findPeer(
+          const shared_model::interface::types::PubkeyType &public_key) const {
+        auto it = peers_by_key_->find(public_key.hex());
+        if (it == peers_by_key_->end()) {
+          return boost::none;
+        }
+        return it->second;
+      }
+
       size_t ClusterOrdering::getNumberOfPeers() const {
         return order_.size();
       }
@@ -5,37 +5,82 @@
 
 #include "consensus/yac/impl/peer_orderer_impl.hpp"
 
+#include <algorithm>
 #include <random>
 
 #include "common/bind.hpp"
+#include "common/visitor.hpp"
 #include "consensus/yac/cluster_order.hpp"
 #include "consensus/yac/yac_hash_provider.hpp"
+#include "interfaces/commands/command_variant.hpp"
 #include "interfaces/common_objects/peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  /**
+   * @return true if the block contains commands which change ledger peers
+   */
+  bool changesPeers(const shared_model::interface::Block &block) {
+    for (const auto &tx : block.transactions()) {
+      for (const auto &command : tx.commands()) {
+        if (iroha::visit_in_place(
+                command.get(),
+                [](const shared_model::interface::AddPeer &) { return true; },
+                [](const auto &) { return false; })) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+}  // namespace
 
 namespace iroha {
   namespace consensus {
     namespace yac {
       PeerOrdererImpl::PeerOrdererImpl(
-          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory)
-          : peer_query_factory_(peer_query_factory) {}
+          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              committed_blocks)
+          : peer_query_factory_(peer_query_factory) {
+        committed_blocks.subscribe(
+            committed_blocks_subscription_, [this](const auto &block) {
+              if (changesPeers(*block)) {
+                std::lock_guard<std::mutex> lock(ledger_peers_mutex_);
+                ledger_peers_ = boost::none;
+              }
+            });
+      }
+
+      PeerOrdererImpl::~PeerOrdererImpl() {
+        committed_blocks_subscription_.unsubscribe();
+      }
 
       boost::optional<ClusterOrdering> PeerOrdererImpl::getInitialOrdering() {
-        return peer_query_factory_->createPeerQuery() |
-            [](const auto &query) { return query->getLedgerPeers(); } |
-            [](const auto &peers) { return ClusterOrdering::create(peers); };
+        return ledgerPeers();
       }
 
       boost::optional<ClusterOrdering> PeerOrdererImpl::getOrdering(
           const YacHash &hash) {
-        return peer_query_factory_->createPeerQuery() |
-            [](const auto &query) { return query->getLedgerPeers(); } |
-            [&hash](auto peers) {
-              std::seed_seq seed(hash.vote_hashes.block_hash.begin(),
-                                 hash.vote_hashes.block_hash.end());
-              std::default_random_engine gen(seed);
-              std::shuffle(peers.begin(), peers.end(), gen);
-              return ClusterOrdering::create(peers);
-            };
+        return ledgerPeers() | [&hash](const auto &order) {
+          auto peers = order.getPeers();
+          std::seed_seq seed(hash.vote_hashes.block_hash.begin(),
+                             hash.vote_hashes.block_hash.end());
+          std::default_random_engine gen(seed);
+          std::shuffle(peers.begin(), peers.end(), gen);
+          return boost::make_optional(order.reordered(std::move(peers)));
+        };
+      }
+
+      boost::optional<ClusterOrdering> PeerOrdererImpl::ledgerPeers() {
+        std::lock_guard<std::mutex> lock(ledger_peers_mutex_);
+        if (not ledger_peers_) {
+          ledger_peers_ = peer_query_factory_->createPeerQuery() |
+              [](const auto &query) { return query->getLedgerPeers(); } |
+              [](const auto &peers) { return ClusterOrdering::create(peers); };
+        }
+        return ledger_peers_;
       }
     }  // namespace yac
   }    // namespace consensus
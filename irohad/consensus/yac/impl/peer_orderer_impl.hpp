@@ -7,10 +7,18 @@
 #define IROHA_PEER_ORDERER_IMPL_HPP
 
 #include <memory>
+#include <mutex>
 
+#include <rxcpp/rx.hpp>
 #include "ametsuchi/peer_query_factory.hpp"
 #include "consensus/yac/yac_peer_orderer.hpp"
 
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
 namespace iroha {
 
   namespace consensus {
@@ -19,10 +27,23 @@ namespace iroha {
       class ClusterOrdering;
       class YacHash;
 
+      /**
+       * Orders peers of the ledger. Peers are loaded from the storage once and
+       * are loaded again only after a commit of a block which changes them,
+       * so voting does not access the storage.
+       */
       class PeerOrdererImpl : public YacPeerOrderer {
        public:
-        explicit PeerOrdererImpl(
-            std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory);
+        /**
+         * @param peer_query_factory - factory of queries of ledger peers
+         * @param committed_blocks - blocks committed to the ledger
+         */
+        PeerOrdererImpl(
+            std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+            rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+                committed_blocks);
+
+        ~PeerOrdererImpl() override;
 
         boost::optional<ClusterOrdering> getInitialOrdering() override;
 
@@ -30,7 +51,19 @@ namespace iroha {
             const YacHash &hash) override;
 
        private:
+        /**
+         * @return peers in the order of the ledger, which are loaded from the
+         * storage if the snapshot is missing
+         */
+        boost::optional<ClusterOrdering> ledgerPeers();
+
         std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
+
+        std::mutex ledger_peers_mutex_;
+        /// snapshot of ledger peers, none until loaded or after a change
+        boost::optional<ClusterOrdering> ledger_peers_;
+
+        rxcpp::composite_subscription committed_blocks_subscription_;
       };
 
     }  // namespace yac
@@ -67,7 +67,7 @@ namespace iroha {
                    logger::to_string(order.getPeers(),
                                      [](auto val) { return val->address(); }));
 
-        cluster_order_ = order;
+        cluster_order_ = std::move(order);
         auto vote = crypto_->getVote(hash);
         // TODO 10.06.2018 andrei: IR-1407 move YAC propagation strategy to a
         // separate entity
@@ -118,13 +118,7 @@ namespace iroha {
 
       boost::optional<std::shared_ptr<shared_model::interface::Peer>>
       Yac::findPeer(const VoteMessage &vote) {
-        auto peers = cluster_order_.getPeers();
-        auto it =
-            std::find_if(peers.begin(), peers.end(), [&](const auto &peer) {
-              return peer->pubkey() == vote.signature->publicKey();
-            });
-        return it != peers.end() ? boost::make_optional(std::move(*it))
-                                 : boost::none;
+        return cluster_order_.findPeer(vote.signature->publicKey());
       }
 
       // ------|Apply data|------
@@ -160,7 +154,9 @@ namespace iroha {
           auto processing_state =
               vote_storage_.getProcessingState(proposal_round);
 
-          auto votes = [](const auto &state) { return state.votes; };
+          auto votes = [](const auto &state) -> const auto & {
+            return state.votes;
+          };
 
           switch (processing_state) {
             case ProposalState::kNotSentNotProcessed:
@@ -19,11 +19,19 @@ namespace iroha {
           : keypair_(keypair), factory_(std::move(factory)) {}
 
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
+        // votes of a commit have the same round and hashes, which are
+        // serialized once for all of them
+        const YacHash *header_hash = nullptr;
+        std::string header;
         return std::all_of(
-            std::begin(msg), std::end(msg), [](const auto &vote) {
-              auto serialized =
-                  PbConverters::serializeVote(vote).hash().SerializeAsString();
-              auto blob = shared_model::crypto::Blob(serialized);
+            std::begin(msg), std::end(msg), [&](const auto &vote) {
+              if (header_hash == nullptr or *header_hash != vote.hash) {
+                header_hash = &vote.hash;
+                header = PbConverters::serializeHashHeader(vote.hash);
+              }
+              auto blob = shared_model::crypto::Blob(
+                  header
+                  + PbConverters::serializeHashBlockSignature(vote.hash));
 
               return shared_model::crypto::CryptoVerifier<>::verify(
                   vote.signature->signedData(),
@@ -28,7 +28,7 @@ namespace iroha {
          * @return rounds to be removed, if any.
          */
         boost::optional<CleanupStrategy::RoundsType> finalize(
-            RoundType consensus_round, Answer answer) override;
+            RoundType consensus_round, const Answer &answer) override;
 
         bool shouldCreateRound(const RoundType &round) override;
 
@@ -29,8 +29,8 @@ namespace iroha {
          * @param answer - outcome of round
          * @return a collection of rounds for removing from the state
          */
-        virtual boost::optional<RoundsType> finalize(Round round,
-                                                     Answer answer) = 0;
+        virtual boost::optional<RoundsType> finalize(
+            Round round, const Answer &answer) = 0;
 
         /**
          * The method checks whether we should add a new round
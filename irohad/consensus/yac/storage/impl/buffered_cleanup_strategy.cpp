@@ -10,7 +10,7 @@
 using namespace iroha::consensus::yac;
 
 boost::optional<CleanupStrategy::RoundsType> BufferedCleanupStrategy::finalize(
-    RoundType consensus_round, Answer answer) {
+    RoundType consensus_round, const Answer &answer) {
   using OptRefRoundType = boost::optional<RoundType> &;
   auto &target_round = iroha::visit_in_place(
       answer,
@@ -5,6 +5,8 @@
 
 #include "consensus/yac/storage/yac_block_storage.hpp"
 
+#include "cryptography/public_key.hpp"
+
 using namespace logger;
 
 namespace iroha {
@@ -24,30 +26,19 @@ namespace iroha {
       }
 
       boost::optional<Answer> YacBlockStorage::insert(VoteMessage msg) {
-        if (validScheme(msg) and uniqueVote(msg)) {
-          votes_.push_back(msg);
-
-          log_->info(
-              "Vote with round {} and hashes ({}, {}) inserted, votes in "
-              "storage [{}/{}]",
-              msg.hash.vote_round,
-              msg.hash.vote_hashes.proposal_hash,
-              msg.hash.vote_hashes.block_hash,
-              votes_.size(),
-              peers_in_round_);
-        }
+        tryInsert(std::move(msg));
         return getState();
       }
 
       boost::optional<Answer> YacBlockStorage::insert(
           std::vector<VoteMessage> votes) {
-        std::for_each(votes.begin(), votes.end(), [this](auto vote) {
-          this->insert(vote);
-        });
+        for (auto &vote : votes) {
+          tryInsert(std::move(vote));
+        }
         return getState();
       }
 
-      std::vector<VoteMessage> YacBlockStorage::getVotes() const {
+      const std::vector<VoteMessage> &YacBlockStorage::getVotes() const {
         return votes_;
       }
 
@@ -65,23 +56,38 @@ namespace iroha {
       }
 
       bool YacBlockStorage::isContains(const VoteMessage &msg) const {
-        return std::count(votes_.begin(), votes_.end(), msg) != 0;
+        return validScheme(msg) and not uniqueVote(msg);
       }
 
-      YacHash YacBlockStorage::getStorageKey() const {
+      const YacHash &YacBlockStorage::getStorageKey() const {
         return storage_key_;
       }
 
       // --------| private api |--------
 
-      bool YacBlockStorage::uniqueVote(VoteMessage &msg) {
-        // lookup take O(n) times
-        return std::all_of(votes_.begin(), votes_.end(), [&msg](auto vote) {
-          return vote != msg;
-        });
+      void YacBlockStorage::tryInsert(VoteMessage msg) {
+        if (not validScheme(msg) or not uniqueVote(msg)) {
+          return;
+        }
+        voters_.insert(msg.signature->publicKey().hex());
+        votes_.push_back(std::move(msg));
+        const auto &vote = votes_.back();
+
+        log_->info(
+            "Vote with round {} and hashes ({}, {}) inserted, votes in "
+            "storage [{}/{}]",
+            vote.hash.vote_round,
+            vote.hash.vote_hashes.proposal_hash,
+            vote.hash.vote_hashes.block_hash,
+            votes_.size(),
+            peers_in_round_);
+      }
+
+      bool YacBlockStorage::uniqueVote(const VoteMessage &msg) const {
+        return voters_.count(msg.signature->publicKey().hex()) == 0;
       }
 
-      bool YacBlockStorage::validScheme(VoteMessage &vote) {
+      bool YacBlockStorage::validScheme(const VoteMessage &vote) const {
         return getStorageKey() == vote.hash;
       }
 
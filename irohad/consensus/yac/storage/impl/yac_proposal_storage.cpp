@@ -13,26 +13,23 @@ namespace iroha {
 
       // --------| private api |--------
 
-      auto YacProposalStorage::findStore(const YacHash &store_hash) {
-        // find exist
-        auto iter = std::find_if(block_storages_.begin(),
-                                 block_storages_.end(),
-                                 [&store_hash](auto block_storage) {
-                                   auto storage_key =
-                                       block_storage.getStorageKey();
-                                   return storage_key == store_hash;
-                                 });
-        if (iter != block_storages_.end()) {
-          return iter;
+      YacBlockStorage &YacProposalStorage::findStore(
+          const YacHash &store_hash) {
+        auto inserted = block_storage_index_.emplace(
+            std::make_pair(store_hash.vote_hashes.proposal_hash,
+                           store_hash.vote_hashes.block_hash),
+            block_storages_.size());
+        if (not inserted.second) {
+          return block_storages_.at(inserted.first->second);
         }
         // insert and return new
-        return block_storages_.emplace(
-            block_storages_.end(),
+        block_storages_.emplace_back(
             YacHash(store_hash.vote_round,
                     store_hash.vote_hashes.proposal_hash,
                     store_hash.vote_hashes.block_hash),
             peers_in_round_,
             supermajority_checker_);
+        return block_storages_.back();
       }
 
       // --------| public api |--------
@@ -49,39 +46,15 @@ namespace iroha {
       }
 
       boost::optional<Answer> YacProposalStorage::insert(VoteMessage msg) {
-        if (shouldInsert(msg)) {
-          // insert to block store
-
-          log_->info("Vote with {} and hashes [{}, {}] looks valid",
-                     msg.hash.vote_round,
-                     msg.hash.vote_hashes.proposal_hash,
-                     msg.hash.vote_hashes.block_hash);
-
-          auto iter = findStore(msg.hash);
-          auto block_state = iter->insert(msg);
-
-          // Single BlockStorage always returns CommitMessage because it
-          // aggregates votes for a single hash.
-          if (block_state) {
-            // supermajority on block achieved
-            current_state_ = std::move(block_state);
-          } else {
-            // try to find reject case
-            auto reject_state = findRejectProof();
-            if (reject_state) {
-              log_->info("Found reject proof");
-              current_state_ = std::move(reject_state);
-            }
-          }
-        }
+        tryInsert(std::move(msg));
         return getState();
       }
 
       boost::optional<Answer> YacProposalStorage::insert(
           std::vector<VoteMessage> messages) {
-        std::for_each(messages.begin(), messages.end(), [this](auto vote) {
-          this->insert(std::move(vote));
-        });
+        for (auto &vote : messages) {
+          tryInsert(std::move(vote));
+        }
         return getState();
       }
 
@@ -89,7 +62,7 @@ namespace iroha {
         return storage_key_;
       }
 
-      boost::optional<Answer> YacProposalStorage::getState() const {
+      const boost::optional<Answer> &YacProposalStorage::getState() const {
         return current_state_;
       }
 
@@ -100,19 +73,44 @@ namespace iroha {
             and checkPeerUniqueness(msg);
       }
 
+      void YacProposalStorage::tryInsert(VoteMessage msg) {
+        if (not shouldInsert(msg)) {
+          return;
+        }
+        // insert to block store
+
+        log_->info("Vote with {} and hashes [{}, {}] looks valid",
+                   msg.hash.vote_round,
+                   msg.hash.vote_hashes.proposal_hash,
+                   msg.hash.vote_hashes.block_hash);
+
+        auto block_state = findStore(msg.hash).insert(std::move(msg));
+
+        // Single BlockStorage always returns CommitMessage because it
+        // aggregates votes for a single hash.
+        if (block_state) {
+          // supermajority on block achieved
+          current_state_ = std::move(block_state);
+        } else {
+          // try to find reject case
+          auto reject_state = findRejectProof();
+          if (reject_state) {
+            log_->info("Found reject proof");
+            current_state_ = std::move(reject_state);
+          }
+        }
+      }
+
       bool YacProposalStorage::checkProposalRound(const Round &vote_round) {
         return vote_round == storage_key_;
       }
 
       bool YacProposalStorage::checkPeerUniqueness(const VoteMessage &msg) {
-        return std::all_of(block_storages_.begin(),
-                           block_storages_.end(),
-                           [&msg](YacBlockStorage &storage) {
-                             if (storage.getStorageKey() != msg.hash) {
-                               return true;
-                             }
-                             return not storage.isContains(msg);
-                           });
+        auto position = block_storage_index_.find(
+            std::make_pair(msg.hash.vote_hashes.proposal_hash,
+                           msg.hash.vote_hashes.block_hash));
+        return position == block_storage_index_.end()
+            or not block_storages_.at(position->second).isContains(msg);
       }
 
       boost::optional<Answer> YacProposalStorage::findRejectProof() {
@@ -141,10 +139,9 @@ namespace iroha {
           std::for_each(block_storages_.begin(),
                         block_storages_.end(),
                         [&result](auto &storage) {
-                          auto votes_from_block_storage = storage.getVotes();
-                          std::move(votes_from_block_storage.begin(),
-                                    votes_from_block_storage.end(),
-                                    std::back_inserter(result));
+                          const auto &votes = storage.getVotes();
+                          result.insert(
+                              result.end(), votes.begin(), votes.end());
                         });
 
           return Answer(RejectMessage(std::move(result)));
@@ -17,42 +17,30 @@ namespace iroha {
 
       // --------| private api |--------
 
-      auto YacVoteStorage::getProposalStorage(const Round &round) {
-        return std::find_if(proposal_storages_.begin(),
-                            proposal_storages_.end(),
-                            [&round](const auto &storage) {
-                              return storage.getStorageKey() == round;
-                            });
-      }
-
-      boost::optional<std::vector<YacProposalStorage>::iterator>
+      boost::optional<YacProposalStorage &>
       YacVoteStorage::findProposalStorage(const VoteMessage &msg,
                                           PeersNumberType peers_in_round) {
         const auto &round = msg.hash.vote_round;
-        auto val = getProposalStorage(round);
+        auto val = proposal_storages_.find(round);
         if (val != proposal_storages_.end()) {
-          return val;
+          return val->second;
         }
         if (strategy_->shouldCreateRound(round)) {
-          return proposal_storages_.emplace(
-              proposal_storages_.end(),
-              msg.hash.vote_round,
-              peers_in_round,
-              std::make_shared<SupermajorityCheckerImpl>());
+          return proposal_storages_
+              .emplace(round,
+                       YacProposalStorage(
+                           round,
+                           peers_in_round,
+                           std::make_shared<SupermajorityCheckerImpl>()))
+              .first->second;
         } else {
           return boost::none;
         }
       }
 
       void YacVoteStorage::remove(const iroha::consensus::Round &round) {
-        auto val = getProposalStorage(round);
-        if (val != proposal_storages_.end()) {
-          proposal_storages_.erase(val);
-        }
-        auto state = processing_state_.find(round);
-        if (state != processing_state_.end()) {
-          processing_state_.erase(state);
-        }
+        proposal_storages_.erase(round);
+        processing_state_.erase(round);
       }
 
       // --------| public api |--------
@@ -65,8 +53,8 @@ namespace iroha {
           std::vector<VoteMessage> state, PeersNumberType peers_in_round) {
         return findProposalStorage(state.at(0), peers_in_round) |
             [this, &state](auto &&storage) {
-              const auto &round = storage->getStorageKey();
-              return storage->insert(state) |
+              const auto &round = storage.getStorageKey();
+              return storage.insert(std::move(state)) |
                          [this, &round](
                              auto &&insert_outcome) -> boost::optional<Answer> {
                 this->strategy_->finalize(round, insert_outcome) |
@@ -82,11 +70,11 @@ namespace iroha {
       }
 
       bool YacVoteStorage::isCommitted(const Round &round) {
-        auto iter = getProposalStorage(round);
+        auto iter = proposal_storages_.find(round);
         if (iter == proposal_storages_.end()) {
           return false;
         }
-        return bool(iter->getState());
+        return bool(iter->second.getState());
       }
 
       ProposalState YacVoteStorage::getProcessingState(const Round &round) {
@@ -19,6 +19,8 @@
 #define IROHA_YAC_BLOCK_VOTE_STORAGE_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -43,6 +45,12 @@ namespace iroha {
          */
         std::vector<VoteMessage> votes_;
 
+        /**
+         * Public keys of the peers, whose votes are stored, for constant time
+         * lookup of duplicates
+         */
+        std::unordered_set<std::string> voters_;
+
        public:
         YacBlockStorage(
             YacHash hash,
@@ -67,9 +75,9 @@ namespace iroha {
         boost::optional<Answer> insert(std::vector<VoteMessage> votes);
 
         /**
-         * @return votes attached to storage
+         * @return votes attached to storage in the order of insertion
          */
-        std::vector<VoteMessage> getVotes() const;
+        const std::vector<VoteMessage> &getVotes() const;
 
         /**
          * @return number of votes attached to storage
@@ -82,7 +90,7 @@ namespace iroha {
         boost::optional<Answer> getState();
 
         /**
-         * Verify that passed vote contains in storage
+         * Verify that the peer of passed vote has already voted in storage
          * @param msg  - vote for finding
          * @return true, if contains
          */
@@ -91,24 +99,30 @@ namespace iroha {
         /**
          * Provide key attached to this storage
          */
-        YacHash getStorageKey() const;
+        const YacHash &getStorageKey() const;
 
        private:
         // --------| private api |--------
 
+        /**
+         * Store the vote if it is valid and its peer has not voted yet
+         * @param msg - vote for insertion
+         */
+        void tryInsert(VoteMessage msg);
+
         /**
          * Verify uniqueness of vote in storage
          * @param msg - vote for verification
          * @return true if vote doesn't appear in storage
          */
-        bool uniqueVote(VoteMessage &vote);
+        bool uniqueVote(const VoteMessage &msg) const;
 
         /**
          * Verify that vote has the same hash attached as the storage
          * @param vote - vote to be checked
          * @return true, if validation passed
          */
-        bool validScheme(VoteMessage &vote);
+        bool validScheme(const VoteMessage &vote) const;
 
         // --------| fields |--------
 
@@ -7,8 +7,11 @@
 #define IROHA_YAC_PROPOSAL_STORAGE_HPP
 
 #include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <boost/functional/hash.hpp>
 #include <boost/optional.hpp>
 #include "consensus/yac/impl/supermajority_checker_impl.hpp"
 #include "consensus/yac/storage/storage_result.hpp"
@@ -32,12 +35,12 @@ namespace iroha {
         // --------| private api |--------
 
         /**
-         * Find block index with provided parameters,
+         * Find block storage with provided parameters,
          * if those store absent - create new
          * @param store_hash - hash of store of interest
-         * @return iterator to storage
+         * @return storage for the hash
          */
-        auto findStore(const YacHash &store_hash);
+        YacBlockStorage &findStore(const YacHash &store_hash);
 
        public:
         // --------| public api |--------
@@ -73,7 +76,7 @@ namespace iroha {
         /**
          * @return current state of storage
          */
-        boost::optional<Answer> getState() const;
+        const boost::optional<Answer> &getState() const;
 
        private:
         // --------| private api |--------
@@ -85,6 +88,12 @@ namespace iroha {
          */
         bool shouldInsert(const VoteMessage &msg);
 
+        /**
+         * Insert the vote if possible and update the state of storage
+         * @param msg - vote for insertion
+         */
+        void tryInsert(VoteMessage msg);
+
         /**
          * Is this vote valid for insertion in proposal storage
          * @param vote_round - round for verification
@@ -114,10 +123,20 @@ namespace iroha {
         boost::optional<Answer> current_state_;
 
         /**
-         * Vector of block storages based on this proposal
+         * Vector of block storages based on this proposal in the order of
+         * their creation
          */
         std::vector<YacBlockStorage> block_storages_;
 
+        /**
+         * Positions of block storages in block_storages_ by proposal and
+         * block hashes of their keys, the round of which is storage_key_
+         */
+        std::unordered_map<std::pair<ProposalHash, BlockHash>,
+                           size_t,
+                           boost::hash<std::pair<ProposalHash, BlockHash>>>
+            block_storage_index_;
+
         /**
          * Key of the storage
          */
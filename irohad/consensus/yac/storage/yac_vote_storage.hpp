@@ -61,24 +61,16 @@ namespace iroha {
        private:
         // --------| private api |--------
 
-        /**
-         * Retrieve iterator for storage with specified key
-         * @param round - key of that storage
-         * @return iterator to proposal storage
-         */
-        auto getProposalStorage(const Round &round);
-
         /**
          * Find existed proposal storage or create new if required
          * @param msg - vote for finding
          * @param peers_in_round - number of peer required
          * for verify supermajority;
          * This parameter used on creation of proposal storage
-         * @return - iter for required proposal storage
+         * @return - required proposal storage
          */
-        boost::optional<std::vector<YacProposalStorage>::iterator>
-        findProposalStorage(const VoteMessage &msg,
-                            PeersNumberType peers_in_round);
+        boost::optional<YacProposalStorage &> findProposalStorage(
+            const VoteMessage &msg, PeersNumberType peers_in_round);
 
         /**
          * Remove proposal storage by round
@@ -135,9 +127,10 @@ namespace iroha {
         // processing_state_ with separate entity IR-360
 
         /**
-         * Active proposal storages
+         * Active proposal storages by their rounds
          */
-        std::vector<YacProposalStorage> proposal_storages_;
+        std::unordered_map<Round, YacProposalStorage, RoundTypeHasher>
+            proposal_storages_;
 
         /**
          * Processing set provide user flags about processing some
@@ -36,9 +36,17 @@ namespace iroha {
         createPeerConnection(to);
 
         proto::State request;
-        for (const auto &vote : state) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
+        // votes of a commit share the round and hashes, which are sent once
+        auto certificate = state.size() > 1
+            ? PbConverters::serializeCertificate(state)
+            : boost::none;
+        if (certificate) {
+          *request.mutable_certificate() = std::move(*certificate);
+        } else {
+          for (const auto &vote : state) {
+            auto pb_vote = request.add_votes();
+            *pb_vote = PbConverters::serializeVote(vote);
+          }
         }
 
         async_call_->Call([&](auto context, auto cq) {
@@ -54,9 +62,13 @@ namespace iroha {
           const ::iroha::consensus::yac::proto::State *request,
           ::google::protobuf::Empty *response) {
         std::vector<VoteMessage> state;
-        for (const auto &pb_vote : request->votes()) {
-          auto vote = *PbConverters::deserializeVote(pb_vote);
-          state.push_back(vote);
+        if (request->has_certificate()) {
+          state = PbConverters::deserializeCertificate(request->certificate());
+        } else {
+          state.reserve(request->votes_size());
+          for (const auto &pb_vote : request->votes()) {
+            state.push_back(*PbConverters::deserializeVote(pb_vote));
+          }
         }
         if (not sameKeys(state)) {
           async_call_->log_->info(
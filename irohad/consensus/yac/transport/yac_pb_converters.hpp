@@ -6,6 +6,8 @@
 #ifndef IROHA_YAC_PB_CONVERTERS_HPP
 #define IROHA_YAC_PB_CONVERTERS_HPP
 
+#include <algorithm>
+
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
 #include "common/byteutils.hpp"
 #include "consensus/yac/outcome_messages.hpp"
@@ -49,6 +51,35 @@ namespace iroha {
           return vote;
         }
 
+        /**
+         * Create signature from its serialized key and data
+         * @param pubkey - public key of the signature
+         * @param signature - signed data
+         * @param val - signature to set, it is not changed on failure
+         * @param msg - error message format with a reason of failure
+         */
+        static void deserializeSignature(
+            const std::string &pubkey,
+            const std::string &signature,
+            std::shared_ptr<shared_model::interface::Signature> &val,
+            const char *msg) {
+          static shared_model::proto::ProtoCommonObjectsFactory<
+              shared_model::validation::FieldValidator>
+              factory_;
+
+          factory_
+              .createSignature(shared_model::crypto::PublicKey(pubkey),
+                               shared_model::crypto::Signed(signature))
+              .match(
+                  [&](iroha::expected::Value<
+                      std::unique_ptr<shared_model::interface::Signature>>
+                          &sig) { val = std::move(sig.value); },
+                  [&](iroha::expected::Error<std::string> &reason) {
+                    logger::log("YacPbConverter::deserializeVote")
+                        ->error(msg, reason.error);
+                  });
+        }
+
        public:
         static proto::Vote serializeVotePayload(const VoteMessage &vote) {
           auto pb_vote = serializeRoundAndHashes(vote);
@@ -65,6 +96,37 @@ namespace iroha {
           return pb_vote;
         }
 
+        /**
+         * Serialize round and hashes of the signed vote payload. Votes with
+         * equal hashes share it, and the payload is its concatenation with
+         * serializeHashBlockSignature
+         * @param hash - hash of the vote
+         * @return serialized proto::Hash without block signature
+         */
+        static std::string serializeHashHeader(const YacHash &hash) {
+          VoteMessage vote;
+          vote.hash.vote_round = hash.vote_round;
+          vote.hash.vote_hashes = hash.vote_hashes;
+          return serializeRoundAndHashes(vote).hash().SerializeAsString();
+        }
+
+        /**
+         * Serialize block signature of the signed vote payload
+         * @param hash - hash of the vote
+         * @return serialized proto::Hash with block signature only
+         */
+        static std::string serializeHashBlockSignature(const YacHash &hash) {
+          proto::Hash pb_hash;
+          if (hash.block_signature) {
+            auto block_signature = pb_hash.mutable_block_signature();
+            block_signature->set_signature(shared_model::crypto::toBinaryString(
+                hash.block_signature->signedData()));
+            block_signature->set_pubkey(shared_model::crypto::toBinaryString(
+                hash.block_signature->publicKey()));
+          }
+          return pb_hash.SerializeAsString();
+        }
+
         static proto::Vote serializeVote(const VoteMessage &vote) {
           auto pb_vote = serializeRoundAndHashes(vote);
 
@@ -89,41 +151,105 @@ namespace iroha {
 
         static boost::optional<VoteMessage> deserializeVote(
             const proto::Vote &pb_vote) {
-          static shared_model::proto::ProtoCommonObjectsFactory<
-              shared_model::validation::FieldValidator>
-              factory_;
-
           auto vote = deserealizeRoundAndHashes(pb_vote);
 
-          auto deserialize =
-              [&](auto &pubkey, auto &signature, auto &val, const auto &msg) {
-                factory_
-                    .createSignature(shared_model::crypto::PublicKey(pubkey),
-                                     shared_model::crypto::Signed(signature))
-                    .match(
-                        [&](iroha::expected::Value<
-                            std::unique_ptr<shared_model::interface::Signature>>
-                                &sig) { val = std::move(sig.value); },
-                        [&](iroha::expected::Error<std::string> &reason) {
-                          logger::log("YacPbConverter::deserializeVote")
-                              ->error(msg, reason.error);
-                        });
-              };
-
           if (pb_vote.hash().has_block_signature()) {
-            deserialize(pb_vote.hash().block_signature().pubkey(),
-                        pb_vote.hash().block_signature().signature(),
-                        vote.hash.block_signature,
-                        "Cannot build vote hash block signature: {}");
+            deserializeSignature(pb_vote.hash().block_signature().pubkey(),
+                                 pb_vote.hash().block_signature().signature(),
+                                 vote.hash.block_signature,
+                                 "Cannot build vote hash block signature: {}");
           }
 
-          deserialize(pb_vote.signature().pubkey(),
-                      pb_vote.signature().signature(),
-                      vote.signature,
-                      "Cannot build vote signature: {}");
+          deserializeSignature(pb_vote.signature().pubkey(),
+                               pb_vote.signature().signature(),
+                               vote.signature,
+                               "Cannot build vote signature: {}");
 
           return vote;
         }
+
+        /**
+         * Serialize votes as a certificate, which contains their round and
+         * hashes once
+         * @param votes - votes of a commit
+         * @return certificate, or none if there are no votes, they have
+         * different rounds or hashes, or a block signature of some vote is
+         * empty or made by another key than the vote
+         */
+        static boost::optional<proto::Certificate> serializeCertificate(
+            const std::vector<VoteMessage> &votes) {
+          if (votes.empty()) {
+            return boost::none;
+          }
+          const auto &hash = votes.front().hash;
+          auto compatible = [&hash](const VoteMessage &vote) {
+            const auto &block_signature = vote.hash.block_signature;
+            return vote.hash == hash
+                and (not block_signature
+                     or (block_signature->publicKey()
+                             == vote.signature->publicKey()
+                         and not block_signature->signedData().blob().empty()));
+          };
+          if (not std::all_of(votes.begin(), votes.end(), compatible)) {
+            return boost::none;
+          }
+
+          proto::Certificate certificate;
+          certificate.mutable_vote_round()->set_block_round(
+              hash.vote_round.block_round);
+          certificate.mutable_vote_round()->set_reject_round(
+              hash.vote_round.reject_round);
+          certificate.mutable_vote_hashes()->set_proposal(
+              hash.vote_hashes.proposal_hash);
+          certificate.mutable_vote_hashes()->set_block(
+              hash.vote_hashes.block_hash);
+          certificate.mutable_votes()->Reserve(votes.size());
+          for (const auto &vote : votes) {
+            auto pb_vote = certificate.add_votes();
+            pb_vote->set_pubkey(shared_model::crypto::toBinaryString(
+                vote.signature->publicKey()));
+            if (vote.hash.block_signature) {
+              pb_vote->set_block_signature(shared_model::crypto::toBinaryString(
+                  vote.hash.block_signature->signedData()));
+            }
+            pb_vote->set_signature(shared_model::crypto::toBinaryString(
+                vote.signature->signedData()));
+          }
+          return certificate;
+        }
+
+        /**
+         * Restore votes from a certificate
+         * @param certificate - certificate to deserialize
+         * @return votes in the order of the certificate
+         */
+        static std::vector<VoteMessage> deserializeCertificate(
+            const proto::Certificate &certificate) {
+          YacHash hash(Round{certificate.vote_round().block_round(),
+                             certificate.vote_round().reject_round()},
+                       certificate.vote_hashes().proposal(),
+                       certificate.vote_hashes().block());
+
+          std::vector<VoteMessage> votes;
+          votes.reserve(certificate.votes_size());
+          for (const auto &pb_vote : certificate.votes()) {
+            VoteMessage vote;
+            vote.hash = hash;
+            if (not pb_vote.block_signature().empty()) {
+              deserializeSignature(
+                  pb_vote.pubkey(),
+                  pb_vote.block_signature(),
+                  vote.hash.block_signature,
+                  "Cannot build vote hash block signature: {}");
+            }
+            deserializeSignature(pb_vote.pubkey(),
+                                 pb_vote.signature(),
+                                 vote.signature,
+                                 "Cannot build vote signature: {}");
+            votes.push_back(std::move(vote));
+          }
+          return votes;
+        }
       };
     }  // namespace yac
   }    // namespace consensus
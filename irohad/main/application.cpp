@@ -5,6 +5,9 @@
 
 #include "main/application.hpp"
 
+#include <algorithm>
+#include <thread>
+
 #include "ametsuchi/impl/storage_impl.hpp"
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
@@ -18,6 +21,7 @@
 #include "common/bind.hpp"
 #include "consensus/yac/impl/supermajority_checker_impl.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "main/server_runner.hpp"
@@ -38,6 +42,7 @@
 #include "torii/impl/command_service_impl.hpp"
 #include "torii/impl/command_service_transport_grpc.hpp"
 #include "torii/impl/status_bus_impl.hpp"
+#include "torii/impl/transaction_intake.hpp"
 #include "torii/processor/query_processor_impl.hpp"
 #include "torii/processor/transaction_processor_impl.hpp"
 #include "torii/query_service.hpp"
@@ -77,7 +82,15 @@ Irohad::Irohad(const std::string &block_store_dir,
                std::chrono::milliseconds max_rounds_delay,
                size_t stale_stream_max_rounds,
                const boost::optional<GossipPropagationStrategyParams>
-                   &opt_mst_gossip_params)
+                   &opt_mst_gossip_params,
+               ametsuchi::WsvEngine wsv_engine,
+               size_t stateful_validation_workers,
+               size_t transaction_intake_capacity,
+               size_t transaction_intake_workers,
+               size_t max_proposal_bytes,
+               double max_account_share,
+               size_t max_backlog_transactions,
+               std::chrono::milliseconds max_backlog_age)
     : block_store_dir_(block_store_dir),
       pg_conn_(pg_conn),
       listen_ip_(listen_ip),
@@ -91,6 +104,14 @@ Irohad::Irohad(const std::string &block_store_dir,
       max_rounds_delay_(max_rounds_delay),
       stale_stream_max_rounds_(stale_stream_max_rounds),
       opt_mst_gossip_params_(opt_mst_gossip_params),
+      wsv_engine_(wsv_engine),
+      stateful_validation_workers_(stateful_validation_workers),
+      transaction_intake_capacity_(transaction_intake_capacity),
+      transaction_intake_workers_(transaction_intake_workers),
+      max_proposal_bytes_(max_proposal_bytes),
+      max_account_share_(max_account_share),
+      max_backlog_transactions_(max_backlog_transactions),
+      max_backlog_age_(max_backlog_age),
       keypair(keypair) {
   log_ = logger::log("IROHAD");
   log_->info("created");
@@ -155,7 +176,9 @@ void Irohad::initStorage() {
                                            pg_conn_,
                                            common_objects_factory_,
                                            std::move(block_converter),
-                                           perm_converter);
+                                           perm_converter,
+                                           StorageImpl::kDefaultPoolSize,
+                                           wsv_engine_);
   storageResult.match(
       [&](expected::Value<std::shared_ptr<ametsuchi::StorageImpl>> &_storage) {
         storage = _storage.value;
@@ -198,7 +221,10 @@ void Irohad::initValidators() {
   auto factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
       shared_model::validation::DefaultProposalValidator>>();
   stateful_validator =
-      std::make_shared<StatefulValidatorImpl>(std::move(factory), batch_parser);
+      std::make_shared<StatefulValidatorImpl>(std::move(factory),
+                                              batch_parser,
+                                              storage,
+                                              stateful_validation_workers_);
   chain_validator = std::make_shared<ChainValidatorImpl>(
       std::make_shared<consensus::yac::SupermajorityCheckerImpl>());
 
@@ -335,7 +361,15 @@ void Irohad::initOrderingGate() {
     return reject_delay;
   };
 
-  ordering_gate = ordering_init.initOrderingGate(max_proposal_size_,
+  ordering::ProposalLimits proposal_limits{max_proposal_size_};
+  if (max_proposal_bytes_ != 0) {
+    proposal_limits.max_bytes = max_proposal_bytes_;
+  }
+  ordering::BacklogLimits backlog_limits{max_backlog_transactions_,
+                                        max_backlog_age_};
+  ordering_gate = ordering_init.initOrderingGate(proposal_limits,
+                                                 max_account_share_,
+                                                 backlog_limits,
                                                  proposal_delay_,
                                                  std::move(hashes),
                                                  storage,
@@ -400,6 +434,7 @@ void Irohad::initBlockLoader() {
  */
 void Irohad::initConsensusGate() {
   consensus_gate = yac_init.initConsensusGate(storage,
+                                              storage->on_commit(),
                                               simulator,
                                               block_loader,
                                               keypair,
@@ -449,8 +484,38 @@ void Irohad::initPeerCommunicationService() {
       default:
         break;
     }
+    auto signature_cache =
+        shared_model::crypto::CryptoVerifier<>::cacheMetrics();
+    log_->info("Signature cache: {} hits, {} misses, {} signatures",
+               signature_cache.hits,
+               signature_cache.misses,
+               signature_cache.size);
   });
 
+  pcs->on_commit().subscribe(
+      [this,
+       service = std::weak_ptr<ordering::OnDemandOrderingServiceImpl>(
+           ordering_init.ordering_service)](const auto &) {
+        if (auto ordering_service = service.lock()) {
+          auto metrics = ordering_service->metrics();
+          log_->info(
+              "Ordering service: backlog of {} batches with {} transactions, "
+              "{} carried over, {} dropped, {} evicted, {} replayed batches",
+              metrics.backlog_batches,
+              metrics.backlog_transactions,
+              metrics.carried_over,
+              metrics.dropped,
+              metrics.evicted,
+              metrics.replayed);
+          log_->info(
+              "Ordering service lock: packing held {} us, max {} us, storing "
+              "batches held max {} us",
+              metrics.last_packing_lock_hold_us,
+              metrics.max_packing_lock_hold_us,
+              metrics.max_batches_lock_hold_us);
+        }
+      });
+
   log_->info("[Init] => pcs");
 }
 
@@ -511,9 +576,34 @@ void Irohad::initTransactionCommandService() {
                                                     status_factory,
                                                     cs_cache,
                                                     persistent_cache);
+  // gRPC handlers only enqueue the received batches, and a request which does
+  // not fit the intake is answered with RESOURCE_EXHAUSTED
+  const auto intake_workers = transaction_intake_workers_ > 0
+      ? transaction_intake_workers_
+      : std::max<size_t>(std::thread::hardware_concurrency() / 2, 1);
+  auto transaction_intake = std::make_shared<::torii::TransactionIntake>(
+      command_service, transaction_intake_capacity_, intake_workers);
+  pcs->on_commit().subscribe(
+      [this,
+       intake = std::weak_ptr<::torii::TransactionIntake>(transaction_intake)](
+          const auto &) {
+        if (auto transaction_intake = intake.lock()) {
+          auto metrics = transaction_intake->metrics();
+          log_->info(
+              "Transaction intake: {} of {} batches, max {}, {} accepted, "
+              "{} rejected, {} handled in place",
+              metrics.occupancy,
+              metrics.capacity,
+              metrics.max_occupancy,
+              metrics.accepted,
+              metrics.rejected,
+              metrics.handled_in_place);
+        }
+      });
   command_service_transport =
       std::make_shared<::torii::CommandServiceTransportGrpc>(
           command_service,
+          std::move(transaction_intake),
           status_bus_,
           status_factory,
           transaction_factory,
@@ -532,10 +622,19 @@ void Irohad::initTransactionCommandService() {
  */
 void Irohad::initQueryService() {
   auto query_processor = std::make_shared<QueryProcessorImpl>(
-      storage, storage, pending_txs_storage_, query_response_factory_);
-
-  query_service =
-      std::make_shared<::torii::QueryService>(query_processor, query_factory);
+      storage, pending_txs_storage_, query_response_factory_);
+
+  // blocks, which do not fit the queue of a slow client, are read from the
+  // block store when the client reaches them
+  const size_t kBlocksQueueSize = 64;
+  auto blocks_broadcast = std::make_shared<BlocksBroadcast>(
+      storage->on_commit(),
+      storage,
+      kBlocksQueueSize,
+      BlocksBroadcast::OverflowPolicy::kDropOldest);
+
+  query_service = std::make_shared<::torii::QueryService>(
+      query_processor, query_factory, std::move(blocks_broadcast));
 
   log_->info("[Init] => query service");
 }
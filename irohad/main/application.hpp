@@ -6,6 +6,7 @@
 #ifndef IROHA_APPLICATION_HPP
 #define IROHA_APPLICATION_HPP
 
+#include "ametsuchi/wsv_engine.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
 #include "interfaces/queries/query.hpp"
@@ -87,6 +88,21 @@ class Irohad {
    * consecutive status emissions
    * @param opt_mst_gossip_params - parameters for Gossip MST propagation
    * (optional). If not provided, disables mst processing support
+   * @param wsv_engine - engine which executes commands of transactions
+   * @param stateful_validation_workers - maximal number of groups of
+   * independent transactions of a proposal validated concurrently
+   * @param transaction_intake_capacity - maximal number of received batches,
+   * which wait for or are being handled by the command service
+   * @param transaction_intake_workers - number of threads passing received
+   * batches to the command service, zero for a half of hardware threads
+   * @param max_proposal_bytes - maximum total size of the transactions of one
+   * proposal in bytes, zero for no limit
+   * @param max_account_share - share of the transactions of a proposal, which
+   * the batches of one creator account may take, one for no limit
+   * @param max_backlog_transactions - maximum number of transactions, which
+   * did not fit the proposals of their rounds and wait for the next ones
+   * @param max_backlog_age - time after which the waiting transactions are
+   * evicted from the backlog
    * TODO mboldyrev 03.11.2018 IR-1844 Refactor the constructor.
    */
   Irohad(const std::string &block_store_dir,
@@ -102,7 +118,16 @@ class Irohad {
          std::chrono::milliseconds max_rounds_delay,
          size_t stale_stream_max_rounds,
          const boost::optional<iroha::GossipPropagationStrategyParams>
-             &opt_mst_gossip_params = boost::none);
+             &opt_mst_gossip_params = boost::none,
+         iroha::ametsuchi::WsvEngine wsv_engine =
+             iroha::ametsuchi::WsvEngine::kPostgres,
+         size_t stateful_validation_workers = 1,
+         size_t transaction_intake_capacity = 4096,
+         size_t transaction_intake_workers = 0,
+         size_t max_proposal_bytes = 0,
+         double max_account_share = 1.,
+         size_t max_backlog_transactions = 10000,
+         std::chrono::milliseconds max_backlog_age = std::chrono::minutes(1));
 
   /**
    * Initialization of whole objects in system
@@ -189,6 +214,14 @@ class Irohad {
   size_t stale_stream_max_rounds_;
   boost::optional<iroha::GossipPropagationStrategyParams>
       opt_mst_gossip_params_;
+  iroha::ametsuchi::WsvEngine wsv_engine_;
+  size_t stateful_validation_workers_;
+  size_t transaction_intake_capacity_;
+  size_t transaction_intake_workers_;
+  size_t max_proposal_bytes_;
+  double max_account_share_;
+  size_t max_backlog_transactions_;
+  std::chrono::milliseconds max_backlog_age_;
 
   // ------------------------| internal dependencies |-------------------------
  public:
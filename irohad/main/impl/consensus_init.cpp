@@ -18,8 +18,11 @@ namespace iroha {
     namespace yac {
 
       auto YacInit::createPeerOrderer(
-          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory) {
-        return std::make_shared<PeerOrdererImpl>(peer_query_factory);
+          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              committed_blocks) {
+        return std::make_shared<PeerOrdererImpl>(peer_query_factory,
+                                                 committed_blocks);
       }
 
       auto YacInit::createNetwork(
@@ -83,6 +86,8 @@ namespace iroha {
 
       std::shared_ptr<YacGate> YacInit::initConsensusGate(
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              committed_blocks,
           std::shared_ptr<simulator::BlockCreator> block_creator,
           std::shared_ptr<network::BlockLoader> block_loader,
           const shared_model::crypto::Keypair &keypair,
@@ -94,7 +99,8 @@ namespace iroha {
               async_call,
           std::shared_ptr<shared_model::interface::CommonObjectsFactory>
               common_objects_factory) {
-        auto peer_orderer = createPeerOrderer(peer_query_factory);
+        auto peer_orderer =
+            createPeerOrderer(peer_query_factory, std::move(committed_blocks));
 
         auto yac = createYac(peer_orderer->getInitialOrdering().value(),
                              keypair,
@@ -33,7 +33,9 @@ namespace iroha {
         // ----------| Yac dependencies |----------
 
         auto createPeerOrderer(
-            std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory);
+            std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+            rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+                committed_blocks);
 
         auto createNetwork(std::shared_ptr<iroha::network::AsyncGrpcClient<
                                google::protobuf::Empty>> async_call);
@@ -68,6 +70,8 @@ namespace iroha {
        public:
         std::shared_ptr<YacGate> initConsensusGate(
             std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+            rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+                committed_blocks,
             std::shared_ptr<simulator::BlockCreator> block_creator,
             std::shared_ptr<network::BlockLoader> block_loader,
             const shared_model::crypto::Keypair &keypair,
@@ -18,8 +18,12 @@
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 #include "ordering/impl/ordering_gate_cache/on_demand_cache.hpp"
+#include "ordering/impl/proposal_packing_policies.hpp"
 
 namespace {
+  /// number of proposals stored by the ordering service
+  constexpr size_t kNumberOfProposals = 3;
+
   /// match event and call corresponding lambda depending on sync_outcome
   template <typename OnBlocks, typename OnNothing>
   auto matchEvent(const iroha::synchronizer::SynchronizationEvent &event,
@@ -239,12 +243,22 @@ namespace iroha {
     }
 
     auto OnDemandOrderingInit::createService(
-        size_t max_size,
+        ordering::ProposalLimits proposal_limits,
+        double max_account_share,
+        ordering::BacklogLimits backlog_limits,
         std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
             proposal_factory,
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache) {
+      // accounts, which send many transactions, do not delay the
+      // transactions of other accounts
       return std::make_shared<ordering::OnDemandOrderingServiceImpl>(
-          max_size, std::move(proposal_factory), std::move(tx_cache));
+          std::make_shared<ordering::FairPackingPolicy>(proposal_limits,
+                                                        max_account_share),
+          std::move(proposal_factory),
+          std::move(tx_cache),
+          kNumberOfProposals,
+          consensus::Round{2, ordering::kFirstRejectRound},
+          backlog_limits);
     }
 
     OnDemandOrderingInit::~OnDemandOrderingInit() {
@@ -253,7 +267,9 @@ namespace iroha {
 
     std::shared_ptr<iroha::network::OrderingGate>
     OnDemandOrderingInit::initOrderingGate(
-        size_t max_size,
+        ordering::ProposalLimits proposal_limits,
+        double max_account_share,
+        ordering::BacklogLimits backlog_limits,
         std::chrono::milliseconds delay,
         std::vector<shared_model::interface::types::HashType> initial_hashes,
         std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
@@ -273,8 +289,11 @@ namespace iroha {
         consensus::Round initial_round,
         std::function<std::chrono::milliseconds(
             const synchronizer::SynchronizationEvent &)> delay_func) {
-      auto ordering_service =
-          createService(max_size, proposal_factory, tx_cache);
+      ordering_service = createService(proposal_limits,
+                                       max_account_share,
+                                       backlog_limits,
+                                       proposal_factory,
+                                       tx_cache);
       service = std::make_shared<ordering::transport::OnDemandOsServerGrpc>(
           ordering_service,
           std::move(transaction_factory),
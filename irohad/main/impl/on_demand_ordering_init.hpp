@@ -16,10 +16,12 @@
 #include "network/ordering_gate.hpp"
 #include "network/peer_communication_service.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
 #include "ordering/on_demand_ordering_service.hpp"
 #include "ordering/on_demand_os_transport.hpp"
+#include "ordering/proposal_packing_policy.hpp"
 
 namespace iroha {
   namespace network {
@@ -78,7 +80,9 @@ namespace iroha {
        * parameters
        */
       auto createService(
-          size_t max_size,
+          ordering::ProposalLimits proposal_limits,
+          double max_account_share,
+          ordering::BacklogLimits backlog_limits,
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache);
@@ -89,7 +93,13 @@ namespace iroha {
       /**
        * Initializes on-demand ordering gate and ordering sevice components
        *
-       * @param max_size maximum number of transaction in a proposal
+       * @param proposal_limits maximum number of transactions and bytes in a
+       * proposal
+       * @param max_account_share share of the transactions of a proposal,
+       * which the batches of one creator account may take
+       * @param backlog_limits maximum number of transactions and time, for
+       * which the batches, which did not fit the proposals of their rounds,
+       * wait for the next proposals
        * @param delay timeout for ordering service response on proposal request
        * @param initial_hashes seeds for peer list permutations for first k
        * rounds they are required since hash of block i defines round i + k
@@ -110,7 +120,9 @@ namespace iroha {
        * @return initialized ordering gate
        */
       std::shared_ptr<network::OrderingGate> initOrderingGate(
-          size_t max_size,
+          ordering::ProposalLimits proposal_limits,
+          double max_account_share,
+          ordering::BacklogLimits backlog_limits,
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes,
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
@@ -134,6 +146,9 @@ namespace iroha {
       /// gRPC service for ordering service
       std::shared_ptr<ordering::proto::OnDemandOrdering::Service> service;
 
+      /// ordering service, whose metrics are reported by the application
+      std::shared_ptr<ordering::OnDemandOrderingServiceImpl> ordering_service;
+
       /// commit notifier from peer communication service
       rxcpp::subjects::subject<decltype(
           std::declval<PeerCommunicationService>().on_commit())::value_type>
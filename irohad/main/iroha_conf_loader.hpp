@@ -14,6 +14,7 @@
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/rapidjson.h>
 
+#include "ametsuchi/wsv_engine.hpp"
 #include "main/assert_config.hpp"
 
 namespace config_members {
@@ -29,6 +30,14 @@ namespace config_members {
   const char *MstExpirationTime = "mst_expiration_time";
   const char *MaxRoundsDelay = "max_rounds_delay";
   const char *StaleStreamMaxRounds = "stale_stream_max_rounds";
+  const char *WsvEngine = "wsv_engine";
+  const char *StatefulValidationWorkers = "stateful_validation_workers";
+  const char *TransactionIntakeCapacity = "transaction_intake_capacity";
+  const char *TransactionIntakeWorkers = "transaction_intake_workers";
+  const char *MaxProposalBytes = "max_proposal_bytes";
+  const char *MaxAccountShare = "max_account_share";
+  const char *MaxBacklogTransactions = "max_backlog_transactions";
+  const char *MaxBacklogAge = "max_backlog_age";
 }  // namespace config_members
 
 static constexpr size_t kBadJsonPrintLength = 15;
@@ -64,6 +73,7 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
   const std::string kStrType = "string";
   const std::string kUintType = "uint";
   const std::string kBoolType = "bool";
+  const std::string kShareType = "a number in (0, 1]";
   doc.ParseStream(isw);
   auto &allocator = doc.GetAllocator();
   ac::assert_fatal(not doc.HasParseError(),
@@ -114,6 +124,18 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
   const auto kMaxRoundsDelayDefault = 3000u;
   const auto kStaleStreamMaxRoundsDefault = 2u;
   const auto kMstExpirationTimeDefault = 1440u;
+  const auto kWsvEngineDefault = "postgres";
+  const auto kStatefulValidationWorkersDefault = 1u;
+  const auto kTransactionIntakeCapacityDefault = 4096u;
+  // zero stands for a half of hardware threads
+  const auto kTransactionIntakeWorkersDefault = 0u;
+  // zero stands for no limit
+  const auto kMaxProposalBytesDefault = 0u;
+  // one stands for no limit
+  const auto kMaxAccountShareDefault = 1.;
+  const auto kMaxBacklogTransactionsDefault = 10000u;
+  // in milliseconds
+  const auto kMaxBacklogAgeDefault = 60000u;
 
   if (not doc.HasMember(mbr::MstExpirationTime)) {
     rapidjson::Value key(mbr::MstExpirationTime, allocator);
@@ -139,6 +161,82 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
                      ac::type_error(mbr::StaleStreamMaxRounds, kUintType));
   }
 
+  if (not doc.HasMember(mbr::WsvEngine)) {
+    rapidjson::Value key(mbr::WsvEngine, allocator);
+    doc.AddMember(key, rapidjson::StringRef(kWsvEngineDefault), allocator);
+  } else {
+    ac::assert_fatal(doc[mbr::WsvEngine].IsString(),
+                     ac::type_error(mbr::WsvEngine, kStrType));
+    ac::assert_fatal(static_cast<bool>(iroha::ametsuchi::wsvEngineFromString(
+                         doc[mbr::WsvEngine].GetString())),
+        std::string(mbr::WsvEngine)
+            + " must be either \"postgres\" or \"memory\"");
+  }
+
+  if (not doc.HasMember(mbr::StatefulValidationWorkers)) {
+    rapidjson::Value key(mbr::StatefulValidationWorkers, allocator);
+    doc.AddMember(key, kStatefulValidationWorkersDefault, allocator);
+  } else {
+    ac::assert_fatal(
+        doc[mbr::StatefulValidationWorkers].IsUint()
+            and doc[mbr::StatefulValidationWorkers].GetUint() > 0,
+        std::string(mbr::StatefulValidationWorkers)
+            + " must be a positive integer");
+  }
+
+  if (not doc.HasMember(mbr::TransactionIntakeCapacity)) {
+    rapidjson::Value key(mbr::TransactionIntakeCapacity, allocator);
+    doc.AddMember(key, kTransactionIntakeCapacityDefault, allocator);
+  } else {
+    ac::assert_fatal(
+        doc[mbr::TransactionIntakeCapacity].IsUint()
+            and doc[mbr::TransactionIntakeCapacity].GetUint() > 0,
+        std::string(mbr::TransactionIntakeCapacity)
+            + " must be a positive integer");
+  }
+
+  if (not doc.HasMember(mbr::TransactionIntakeWorkers)) {
+    rapidjson::Value key(mbr::TransactionIntakeWorkers, allocator);
+    doc.AddMember(key, kTransactionIntakeWorkersDefault, allocator);
+  } else {
+    ac::assert_fatal(doc[mbr::TransactionIntakeWorkers].IsUint(),
+                     ac::type_error(mbr::TransactionIntakeWorkers, kUintType));
+  }
+
+  if (not doc.HasMember(mbr::MaxProposalBytes)) {
+    rapidjson::Value key(mbr::MaxProposalBytes, allocator);
+    doc.AddMember(key, kMaxProposalBytesDefault, allocator);
+  } else {
+    ac::assert_fatal(doc[mbr::MaxProposalBytes].IsUint(),
+                     ac::type_error(mbr::MaxProposalBytes, kUintType));
+  }
+
+  if (not doc.HasMember(mbr::MaxAccountShare)) {
+    rapidjson::Value key(mbr::MaxAccountShare, allocator);
+    doc.AddMember(key, kMaxAccountShareDefault, allocator);
+  } else {
+    const auto &share = doc[mbr::MaxAccountShare];
+    ac::assert_fatal(
+        share.IsNumber() and share.GetDouble() > 0. and share.GetDouble() <= 1.,
+        ac::type_error(mbr::MaxAccountShare, kShareType));
+  }
+
+  if (not doc.HasMember(mbr::MaxBacklogTransactions)) {
+    rapidjson::Value key(mbr::MaxBacklogTransactions, allocator);
+    doc.AddMember(key, kMaxBacklogTransactionsDefault, allocator);
+  } else {
+    ac::assert_fatal(doc[mbr::MaxBacklogTransactions].IsUint(),
+                     ac::type_error(mbr::MaxBacklogTransactions, kUintType));
+  }
+
+  if (not doc.HasMember(mbr::MaxBacklogAge)) {
+    rapidjson::Value key(mbr::MaxBacklogAge, allocator);
+    doc.AddMember(key, kMaxBacklogAgeDefault, allocator);
+  } else {
+    ac::assert_fatal(doc[mbr::MaxBacklogAge].IsUint(),
+                     ac::type_error(mbr::MaxBacklogAge, kUintType));
+  }
+
   return doc;
 }
 
@@ -134,7 +134,16 @@ int main(int argc, char *argv[]) {
       std::chrono::milliseconds(config[mbr::MaxRoundsDelay].GetUint()),
       config[mbr::StaleStreamMaxRounds].GetUint(),
       boost::make_optional(config[mbr::MstSupport].GetBool(),
-                           iroha::GossipPropagationStrategyParams{}));
+                           iroha::GossipPropagationStrategyParams{}),
+      *iroha::ametsuchi::wsvEngineFromString(
+          config[mbr::WsvEngine].GetString()),
+      config[mbr::StatefulValidationWorkers].GetUint(),
+      config[mbr::TransactionIntakeCapacity].GetUint(),
+      config[mbr::TransactionIntakeWorkers].GetUint(),
+      config[mbr::MaxProposalBytes].GetUint(),
+      config[mbr::MaxAccountShare].GetDouble(),
+      config[mbr::MaxBacklogTransactions].GetUint(),
+      std::chrono::milliseconds(config[mbr::MaxBacklogAge].GetUint()));
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad.storage) {
@@ -10,6 +10,7 @@
 
 #include <boost/functional/hash.hpp>
 #include "cryptography/blob.hpp"
+#include "cryptography/fixed_hash.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -18,11 +19,15 @@ namespace iroha {
   namespace model {
 
     size_t PointerBatchHasher::operator()(const DataType &batch) const {
-      return std::hash<std::string>{}(batch->reducedHash().hex());
+      return shared_model::crypto::Hash::Hasher{}(batch->reducedHash());
     }
 
     std::size_t BlobHasher::operator()(
         const shared_model::crypto::Blob &blob) const {
+      if (blob.size() <= shared_model::crypto::FixedHash::kMaxSize) {
+        return shared_model::crypto::FixedHash::Hasher{}(
+            shared_model::crypto::FixedHash(blob));
+      }
       return boost::hash_value(blob.blob());
     }
 
@@ -5,11 +5,11 @@
 
 #include "multi_sig_transactions/state/mst_state.hpp"
 
+#include <algorithm>
 #include <utility>
 
 #include <boost/range/algorithm/find.hpp>
 #include <boost/range/combine.hpp>
-#include "common/set.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 
@@ -67,8 +67,13 @@ namespace iroha {
   }
 
   MstState MstState::operator-(const MstState &rhs) const {
-    return MstState(this->completer_,
-                    set_difference(this->internal_state_, rhs.internal_state_));
+    MstState difference = MstState::empty(completer_);
+    for (const auto &batch : internal_state_) {
+      if (not rhs.contains(batch)) {
+        difference.rawInsert(batch);
+      }
+    }
+    return difference;
   }
 
   bool MstState::operator==(const MstState &rhs) const {
@@ -91,22 +96,30 @@ namespace iroha {
 
   MstState MstState::eraseByTime(const TimeType &time) {
     MstState out = MstState::empty(completer_);
-    while (not index_.empty() and (*completer_)(index_.top(), time)) {
-      auto iter = internal_state_.find(index_.top());
-
-      out += *iter;
-      internal_state_.erase(iter);
-      index_.pop();
+    // a batch expires with its oldest transaction, so the sweep stops at the
+    // first batch in the index, which is not expired yet
+    while (not index_.empty()
+           and (*completer_)(index_.begin()->second, time)) {
+      auto batch = index_.begin()->second;
+      index_.erase(index_.begin());
+      internal_state_.erase(batch);
+      out.rawInsert(batch);
     }
     return out;
   }
 
   // ------------------------------| private api |------------------------------
 
-  bool MstState::Less::operator()(const DataType &left,
-                                  const DataType &right) const {
-    return left->transactions().at(0)->createdTime()
-        < right->transactions().at(0)->createdTime();
+  MstState::IndexType::value_type MstState::indexEntry(const DataType &batch) {
+    const auto &transactions = batch->transactions();
+    auto oldest = std::min_element(
+        transactions.begin(),
+        transactions.end(),
+        [](const auto &left, const auto &right) {
+          return left->createdTime() < right->createdTime();
+        });
+    return {oldest == transactions.end() ? 0 : (*oldest)->createdTime(),
+            batch};
   }
 
   /**
@@ -135,15 +148,7 @@ namespace iroha {
   }
 
   MstState::MstState(const CompleterType &completer, logger::Logger log)
-      : MstState(completer, InternalStateType{}, std::move(log)) {}
-
-  MstState::MstState(const CompleterType &completer,
-                     const InternalStateType &transactions,
-                     logger::Logger log)
-      : completer_(completer),
-        internal_state_(transactions.begin(), transactions.end()),
-        index_(transactions.begin(), transactions.end()),
-        log_(std::move(log)) {}
+      : completer_(completer), log_(std::move(log)) {}
 
   void MstState::insertOne(StateUpdateResult &state_update,
                            const DataType &rhs_batch) {
@@ -163,7 +168,7 @@ namespace iroha {
     if ((*completer_)(found)) {
       // state already has completed transaction,
       // remove from state and return it
-      internal_state_.erase(internal_state_.find(found));
+      erase(corresponding);
       state_update.completed_state_->rawInsert(found);
       return;
     }
@@ -176,8 +181,14 @@ namespace iroha {
   }
 
   void MstState::rawInsert(const DataType &rhs_batch) {
-    internal_state_.insert(rhs_batch);
-    index_.push(rhs_batch);
+    if (internal_state_.insert(rhs_batch).second) {
+      index_.insert(indexEntry(rhs_batch));
+    }
+  }
+
+  void MstState::erase(InternalStateType::const_iterator iter) {
+    index_.erase(indexEntry(*iter));
+    internal_state_.erase(iter);
   }
 
   bool MstState::contains(const DataType &element) const {
@@ -6,9 +6,9 @@
 #ifndef IROHA_MST_STATE_HPP
 #define IROHA_MST_STATE_HPP
 
-#include <queue>
+#include <set>
 #include <unordered_set>
-#include <vector>
+#include <utility>
 
 #include "logger/logger.hpp"
 #include "multi_sig_transactions/hash.hpp"
@@ -148,28 +148,27 @@ namespace iroha {
    private:
     // --------------------------| private api |------------------------------
 
-    /**
-     * Class provides operator < for batches
-     */
-    class Less {
-     public:
-      bool operator()(const DataType &left, const DataType &right) const;
-    };
-
     using InternalStateType =
         std::unordered_set<DataType,
                            iroha::model::PointerBatchHasher,
                            BatchHashEquality>;
 
-    using IndexType =
-        std::priority_queue<DataType, std::vector<DataType>, Less>;
+    /**
+     * Expiry index: batches ordered by the creation time of their oldest
+     * transaction, so that the batches which expire first are at the
+     * beginning. The batch pointer makes the entries unique and lets a batch
+     * be found in the index without a search by hash
+     */
+    using IndexType = std::set<std::pair<TimeType, DataType>>;
 
     explicit MstState(const CompleterType &completer,
                       logger::Logger log = logger::log("MstState"));
 
-    MstState(const CompleterType &completer,
-             const InternalStateType &transactions,
-             logger::Logger log = logger::log("MstState"));
+    /**
+     * @param batch - batch of the state
+     * @return entry of the batch in the expiry index
+     */
+    static IndexType::value_type indexEntry(const DataType &batch);
 
     /**
      * Insert batch in own state and push it in out_completed_state or
@@ -185,6 +184,12 @@ namespace iroha {
      */
     void rawInsert(const DataType &rhs_tx);
 
+    /**
+     * Remove the batch from the state and from the index
+     * @param iter - position of the batch in the state
+     */
+    void erase(InternalStateType::const_iterator iter);
+
     // -----------------------------| fields |------------------------------
 
     CompleterType completer_;
@@ -41,6 +41,11 @@ namespace iroha {
   auto MstStorageStateImpl::getExpiredTransactionsImpl(
       const TimeType &current_time)
       -> decltype(getExpiredTransactions(current_time)) {
+    // states of the peers are swept as well, otherwise they keep expired
+    // batches forever
+    for (auto &peer_state : peer_states_) {
+      peer_state.second.eraseByTime(current_time);
+    }
     return own_state_.eraseByTime(current_time);
   }
 
@@ -11,6 +11,7 @@
 #include <boost/range/adaptor/transformed.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "backend/protobuf/util.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 #include "validators/field_validator.hpp"
@@ -49,7 +50,12 @@ MstTransportGrpc::deserializeTransactions(const transport::MstState *request) {
       shared_model::interface::types::SharedTxsCollectionType>(
       request->transactions()
       | boost::adaptors::transformed(
-            [&](const auto &tx) { return transaction_factory_->build(tx); })
+            [&](const auto &tx) {
+              // pending transactions may live long, so each of them gets its
+              // own arena instead of pinning the whole request
+              return transaction_factory_->build(
+                  shared_model::proto::makeArenaCopy(tx));
+            })
       | boost::adaptors::filtered([&](const auto &result) {
           return result.match(
               [](const iroha::expected::Value<
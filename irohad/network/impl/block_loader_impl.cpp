@@ -5,6 +5,7 @@
 
 #include "network/impl/block_loader_impl.hpp"
 
+#include <google/protobuf/arena.h>
 #include <grpc++/create_channel.h>
 
 #include "backend/protobuf/block.hpp"
@@ -46,15 +47,24 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
 
         proto::BlocksRequest request;
         grpc::ClientContext context;
-        protocol::Block block;
 
         // request next block to our top
         request.set_height(height + 1);
 
         auto reader =
             this->getPeerStub(**peer).retrieveBlocks(&context, request);
-        while (reader->Read(&block)) {
-          auto proto_block = block_factory_.createBlock(std::move(block));
+        while (true) {
+          // every block is read into its own arena, which is then owned by
+          // the created block and freed together with it
+          auto arena = std::make_shared<google::protobuf::Arena>();
+          auto block =
+              google::protobuf::Arena::CreateMessage<protocol::Block>(
+                  arena.get());
+          if (not reader->Read(block)) {
+            break;
+          }
+          auto proto_block = block_factory_.createBlock(
+              std::shared_ptr<protocol::Block>(arena, block));
           proto_block.match(
               [&subscriber](
                   iroha::expected::Value<std::unique_ptr<Block>> &result) {
@@ -0,0 +1,140 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batch_backlog.hpp"
+
+#include <algorithm>
+
+#include <boost/range/size.hpp>
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+using shared_model::crypto::FixedHash;
+
+BatchBacklog::BatchBacklog(BacklogLimits limits) : limits_(limits) {}
+
+bool BatchBacklog::add(TransactionBatchType batch, Clock::time_point now) {
+  FixedHash hash(batch->reducedHash());
+  if (hashes_.count(hash) != 0) {
+    return true;
+  }
+  const size_t txs = boost::size(batch->transactions());
+  std::string account = batch->transactions().front()->creatorAccountId();
+
+  while (transactions_ + txs > limits_.max_transactions) {
+    auto largest = std::max_element(
+        accounts_.begin(),
+        accounts_.end(),
+        [](const auto &lhs, const auto &rhs) {
+          return lhs.second.transactions < rhs.second.transactions;
+        });
+    auto own = accounts_.find(account);
+    const auto own_txs =
+        txs + (own == accounts_.end() ? 0 : own->second.transactions);
+    if (largest == accounts_.end()
+        or own_txs >= largest->second.transactions) {
+      dropped_ += txs;
+      return false;
+    }
+    dropNewest(largest);
+  }
+
+  entries_.push_back(Entry{std::move(batch), hash, account, txs, now});
+  auto &own = accounts_[account];
+  own.entries.push_back(std::prev(entries_.end()));
+  own.transactions += txs;
+  hashes_.insert(hash);
+  transactions_ += txs;
+  carried_over_ += txs;
+  return true;
+}
+
+void BatchBacklog::evictExpired(Clock::time_point now) {
+  while (not entries_.empty()
+         and now - entries_.front().since >= limits_.max_age) {
+    auto entry = entries_.begin();
+    // the batches of an account are in arrival order as well
+    auto account = accounts_.find(entry->account);
+    account->second.entries.pop_front();
+    account->second.transactions -= entry->transactions;
+    if (account->second.entries.empty()) {
+      accounts_.erase(account);
+    }
+    evicted_ += entry->transactions;
+    erase(entry);
+  }
+}
+
+void BatchBacklog::remove(const HashSetType &hashes) {
+  if (hashes.empty()) {
+    return;
+  }
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    auto entry = it++;
+    if (hashes.count(entry->hash) != 0) {
+      erase(entry);
+    }
+  }
+
+  accounts_.clear();
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    auto &account = accounts_[it->account];
+    account.entries.push_back(it);
+    account.transactions += it->transactions;
+  }
+}
+
+bool BatchBacklog::contains(const FixedHash &hash) const {
+  return hashes_.count(hash) != 0;
+}
+
+std::vector<BatchBacklog::TransactionBatchType> BatchBacklog::batches()
+    const {
+  std::vector<TransactionBatchType> batches;
+  batches.reserve(entries_.size());
+  for (const auto &entry : entries_) {
+    batches.push_back(entry.batch);
+  }
+  return batches;
+}
+
+size_t BatchBacklog::size() const {
+  return entries_.size();
+}
+
+size_t BatchBacklog::transactions() const {
+  return transactions_;
+}
+
+uint64_t BatchBacklog::carriedOver() const {
+  return carried_over_;
+}
+
+uint64_t BatchBacklog::dropped() const {
+  return dropped_;
+}
+
+uint64_t BatchBacklog::evicted() const {
+  return evicted_;
+}
+
+void BatchBacklog::erase(EntryIterator entry) {
+  hashes_.erase(entry->hash);
+  transactions_ -= entry->transactions;
+  entries_.erase(entry);
+}
+
+void BatchBacklog::dropNewest(
+    std::unordered_map<std::string, Account>::iterator account) {
+  auto entry = account->second.entries.back();
+  account->second.entries.pop_back();
+  account->second.transactions -= entry->transactions;
+  if (account->second.entries.empty()) {
+    accounts_.erase(account);
+  }
+  dropped_ += entry->transactions;
+  erase(entry);
+}
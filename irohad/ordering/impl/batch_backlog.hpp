@@ -0,0 +1,136 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BATCH_BACKLOG_HPP
+#define IROHA_BATCH_BACKLOG_HPP
+
+#include <chrono>
+#include <deque>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "cryptography/fixed_hash.hpp"
+#include "ordering/on_demand_os_transport.hpp"
+
+namespace iroha {
+  namespace ordering {
+    /**
+     * Limits of the backlog of batches, which did not fit the proposals of
+     * their rounds and are carried over to the next proposals
+     */
+    struct BacklogLimits {
+      /// maximum number of transactions in the backlog, the batches which do
+      /// not fit are dropped
+      size_t max_transactions = 10000;
+      /// batches, which have waited in the backlog for so long, are evicted
+      std::chrono::milliseconds max_age = std::chrono::minutes(1);
+    };
+
+    /**
+     * Batches, which did not fit the proposals of their rounds, in arrival
+     * order. When the backlog is full, the newest batch of the creator
+     * account with the most transactions in the backlog is dropped, so an
+     * account, which sends more than the proposals fit, does not push the
+     * batches of other accounts out of the backlog.
+     * Note: the class is not thread-safe
+     */
+    class BatchBacklog {
+     public:
+      using TransactionBatchType =
+          transport::OdOsNotification::TransactionBatchType;
+      using Clock = std::chrono::steady_clock;
+      using HashSetType =
+          std::unordered_set<shared_model::crypto::FixedHash,
+                             shared_model::crypto::FixedHash::Hasher>;
+
+      explicit BatchBacklog(BacklogLimits limits);
+
+      /**
+       * Append the batch, if it is not in the backlog yet, and drop the
+       * newest batches of the largest accounts while the backlog is over
+       * the limit. The given batch is dropped instead, when its account is
+       * the largest one.
+       * @param batch - batch to append
+       * @param now - time of appending, from which the age of the batch is
+       * counted
+       * @return true if the batch is in the backlog
+       */
+      bool add(TransactionBatchType batch, Clock::time_point now);
+
+      /**
+       * Remove the batches, which have waited for the maximum age or longer
+       * @param now - current time
+       */
+      void evictExpired(Clock::time_point now);
+
+      /**
+       * Remove the batches with the given reduced hashes
+       */
+      void remove(const HashSetType &hashes);
+
+      /**
+       * @return true if the batch with the given reduced hash is in the
+       * backlog
+       */
+      bool contains(const shared_model::crypto::FixedHash &hash) const;
+
+      /// @return batches in arrival order
+      std::vector<TransactionBatchType> batches() const;
+
+      /// @return number of batches
+      size_t size() const;
+
+      /// @return number of transactions of the batches
+      size_t transactions() const;
+
+      /// @return number of transactions, which were appended
+      uint64_t carriedOver() const;
+
+      /// @return number of transactions dropped for the lack of room
+      uint64_t dropped() const;
+
+      /// @return number of transactions evicted for their age
+      uint64_t evicted() const;
+
+     private:
+      struct Entry {
+        TransactionBatchType batch;
+        shared_model::crypto::FixedHash hash;
+        std::string account;
+        size_t transactions;
+        /// time when the batch was appended
+        Clock::time_point since;
+      };
+      using EntryIterator = std::list<Entry>::iterator;
+
+      /// batches of an account in arrival order
+      struct Account {
+        std::deque<EntryIterator> entries;
+        size_t transactions = 0;
+      };
+
+      /// remove the entry, whose account is already updated
+      void erase(EntryIterator entry);
+
+      /// remove the newest batch of the account
+      void dropNewest(
+          std::unordered_map<std::string, Account>::iterator account);
+
+      BacklogLimits limits_;
+      std::list<Entry> entries_;
+      std::unordered_map<std::string, Account> accounts_;
+      HashSetType hashes_;
+      size_t transactions_ = 0;
+      uint64_t carried_over_ = 0;
+      uint64_t dropped_ = 0;
+      uint64_t evicted_ = 0;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_BATCH_BACKLOG_HPP
@@ -5,10 +5,10 @@
 
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
+#include <iterator>
 #include <unordered_set>
 
 #include <boost/optional.hpp>
-#include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indirected.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm/for_each.hpp>
@@ -16,14 +16,26 @@
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "ametsuchi/tx_presence_cache_utils.hpp"
 #include "common/visitor.hpp"
+#include "cryptography/fixed_hash.hpp"
 #include "datetime/time.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
+#include "ordering/impl/proposal_packing_policies.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 using TransactionBatchType = transport::OdOsNotification::TransactionBatchType;
+using shared_model::crypto::FixedHash;
+
+namespace {
+  /// @return microseconds since the given time
+  uint64_t microsecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  }
+}  // namespace
 
 OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     size_t transaction_limit,
@@ -32,9 +44,30 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     size_t number_of_proposals,
     const consensus::Round &initial_round,
+    BacklogLimits backlog_limits,
     logger::Logger log)
-    : transaction_limit_(transaction_limit),
+    : OnDemandOrderingServiceImpl(
+          std::make_shared<FifoPackingPolicy>(
+              ProposalLimits{transaction_limit}),
+          std::move(proposal_factory),
+          std::move(tx_cache),
+          number_of_proposals,
+          initial_round,
+          backlog_limits,
+          std::move(log)) {}
+
+OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
+    std::shared_ptr<ProposalPackingPolicy> packing_policy,
+    std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
+        proposal_factory,
+    std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
+    size_t number_of_proposals,
+    const consensus::Round &initial_round,
+    BacklogLimits backlog_limits,
+    logger::Logger log)
+    : packing_policy_(std::move(packing_policy)),
       number_of_proposals_(number_of_proposals),
+      backlog_(backlog_limits),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
       log_(std::move(log)) {
@@ -46,50 +79,46 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
 void OnDemandOrderingServiceImpl::onCollaborationOutcome(
     consensus::Round round) {
   log_->info("onCollaborationOutcome => {}", round);
+  // storage is queried before the exclusive lock is taken, as in onBatches
+  auto processed = findProcessedInBacklog();
+
   // exclusive write lock
   std::lock_guard<std::shared_timed_mutex> guard(lock_);
   log_->debug("onCollaborationOutcome => write lock is acquired");
+  const auto locked = std::chrono::steady_clock::now();
 
+  backlog_.remove(processed);
   packNextProposals(round);
   tryErase();
+
+  metrics_.last_packing_lock_hold_us = microsecondsSince(locked);
+  metrics_.max_packing_lock_hold_us = std::max(
+      metrics_.max_packing_lock_hold_us, metrics_.last_packing_lock_hold_us);
+  log_->debug("onCollaborationOutcome => write lock is held for {} us",
+              metrics_.last_packing_lock_hold_us);
 }
 
 // ----------------------------| OdOsNotification |-----------------------------
 
 void OnDemandOrderingServiceImpl::onBatches(consensus::Round round,
                                             CollectionType batches) {
+  log_->info("onBatches => collection size = {}, {}", batches.size(), round);
+  // storage is queried before the lock is taken, so packing of proposals
+  // never waits for it
+  auto unprocessed_batches = removeProcessed(std::move(batches));
+
   // read lock
   std::shared_lock<std::shared_timed_mutex> guard(lock_);
-  log_->info("onBatches => collection size = {}, {}", batches.size(), round);
+  const auto locked = std::chrono::steady_clock::now();
 
-  auto unprocessed_batches =
-      boost::adaptors::filter(batches, [this](const auto &batch) {
-        log_->info("check batch {} for already processed transactions",
-                   batch->reducedHash().hex());
-        return not this->batchAlreadyProcessed(*batch);
-      });
-  auto it = current_proposals_.find(round);
-  if (it == current_proposals_.end()) {
-    it =
-        std::find_if(current_proposals_.begin(),
-                     current_proposals_.end(),
-                     [&round](const auto &p) {
-                       auto request_reject_round = round.reject_round;
-                       auto reject_round = p.first.reject_round;
-                       return request_reject_round == reject_round
-                           or (request_reject_round >= 2 and reject_round >= 2);
-                     });
-    if (it == current_proposals_.end()) {
-      log_->critical("No place to store the batches!");
-      assert(false);  // terminate if in debug build
-      return;
-    }
-    log_->debug("onBatches => collection will be inserted to {}", it->first);
+  insertBatches(round, std::move(unprocessed_batches));
+
+  const auto held = microsecondsSince(locked);
+  auto max_held = max_batches_lock_hold_us_.load();
+  while (max_held < held
+         and not max_batches_lock_hold_us_.compare_exchange_weak(max_held,
+                                                                 held)) {
   }
-  std::for_each(unprocessed_batches.begin(),
-                unprocessed_batches.end(),
-                [&it](auto &obj) { it->second.push(std::move(obj)); });
-  log_->debug("onBatches => collection is inserted");
 }
 
 boost::optional<
@@ -104,63 +133,108 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
               round,
               (proposal == proposal_map_.end()) ? "NOT " : "");
   if (proposal != proposal_map_.end()) {
+    // the carried over batches of the proposal leave the backlog with the
+    // next packing
+    served_rounds_.push(round);
     return proposal->second;
   } else {
     return boost::none;
   }
 }
 
+OnDemandOrderingServiceImpl::Metrics OnDemandOrderingServiceImpl::metrics()
+    const {
+  // read lock
+  std::shared_lock<std::shared_timed_mutex> guard(lock_);
+  auto metrics = metrics_;
+  metrics.backlog_batches = backlog_.size();
+  metrics.backlog_transactions = backlog_.transactions();
+  metrics.carried_over = backlog_.carriedOver();
+  metrics.dropped = backlog_.dropped();
+  metrics.evicted = backlog_.evicted();
+  metrics.replayed = replayed_;
+  metrics.max_batches_lock_hold_us = max_batches_lock_hold_us_;
+  return metrics;
+}
+
 // ---------------------------------| Private |---------------------------------
 
 /**
- * Get transactions from the given batches queue. Does not break batches -
- * continues getting all the transactions from the ongoing batch until the
- * required amount is collected.
- * @param requested_tx_amount - amount of transactions to get
- * @param tx_batches_queue - the queue to get transactions from
- * @param discarded_txs_amount - the amount of discarded txs
-
- * @return transactions
+ * Get the batches, which the policy chooses among the carried over batches
+ * and the batches of the given queue in one pass, so that the batches of an
+ * account are weighed against the batches of other accounts regardless of
+ * where they wait. Carried over batches are offered first.
+ * @param packing_policy - chooses the batches
+ * @param backlog - backlog, whose batches are not overflow
+ * @param carried_over - batches of the backlog in arrival order
+ * @param tx_batches_queue - the queue to get batches from
+ * @param overflow - batches from the queue, which were not chosen
+ * @return chosen batches
  */
-static std::vector<std::shared_ptr<shared_model::interface::Transaction>>
-getTransactions(size_t requested_tx_amount,
-                tbb::concurrent_queue<TransactionBatchType> &tx_batches_queue,
-                boost::optional<size_t &> discarded_txs_amount) {
+static std::vector<TransactionBatchType> getBatches(
+    const ProposalPackingPolicy &packing_policy,
+    const BatchBacklog &backlog,
+    const std::vector<TransactionBatchType> &carried_over,
+    tbb::concurrent_queue<TransactionBatchType> &tx_batches_queue,
+    std::vector<TransactionBatchType> &overflow) {
+  std::unordered_set<FixedHash, FixedHash::Hasher> inserted;
+  for (const auto &batch : carried_over) {
+    inserted.emplace(batch->reducedHash());
+  }
+  auto candidates = carried_over;
   TransactionBatchType batch;
-  std::vector<std::shared_ptr<shared_model::interface::Transaction>> collection;
-  std::unordered_set<std::string> inserted;
-
-  while (collection.size() < requested_tx_amount
-         and tx_batches_queue.try_pop(batch)
-         and inserted.insert(batch->reducedHash().hex()).second) {
-    collection.insert(
-        std::end(collection),
-        std::make_move_iterator(std::begin(batch->transactions())),
-        std::make_move_iterator(std::end(batch->transactions())));
+  while (tx_batches_queue.try_pop(batch)) {
+    if (inserted.emplace(batch->reducedHash()).second) {
+      candidates.push_back(std::move(batch));
+    }
   }
 
-  if (discarded_txs_amount) {
-    *discarded_txs_amount = 0;
-    while (tx_batches_queue.try_pop(batch)) {
-      *discarded_txs_amount += boost::size(batch->transactions());
+  std::vector<TransactionBatchType> batches;
+  packing_policy.pack(batches, candidates);
+  for (auto &batch : candidates) {
+    if (not backlog.contains(FixedHash(batch->reducedHash()))) {
+      overflow.push_back(std::move(batch));
     }
   }
-
-  return collection;
+  return batches;
 }
 
 void OnDemandOrderingServiceImpl::packNextProposals(
     const consensus::Round &round) {
-  auto close_round = [this](consensus::Round round) {
+  const auto now = std::chrono::steady_clock::now();
+  backlog_.evictExpired(now);
+  backlog_.remove(takeServedBatches());
+
+  // the proposals, which are packed now, are requested by the peers of their
+  // rounds, which are chosen by a permutation of the ledger peers, so any of
+  // them may be requested from this peer or none. Every one of them is
+  // offered the batches from the backlog, which are kept there until one of
+  // the proposals with them is requested.
+  const auto carried_over = backlog_.batches();
+  std::vector<TransactionBatchType> overflow;
+
+  auto close_round = [this, &carried_over, &overflow](consensus::Round round) {
     log_->debug("close {}", round);
 
     auto it = current_proposals_.find(round);
     if (it != current_proposals_.end()) {
       log_->debug("proposal found");
-      if (not it->second.empty()) {
+      if (not it->second.empty() or not carried_over.empty()) {
         log_->debug("Mutable proposal generation for round {}", round);
-        size_t discarded_txs_amount;
-        auto txs = getTransactions(transaction_limit_, it->second, discarded_txs_amount);
+        auto batches = getBatches(
+            *packing_policy_, backlog_, carried_over, it->second, overflow);
+        std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+            txs;
+        std::vector<FixedHash> carried_hashes;
+        for (const auto &batch : batches) {
+          txs.insert(std::end(txs),
+                     std::begin(batch->transactions()),
+                     std::end(batch->transactions()));
+          FixedHash hash(batch->reducedHash());
+          if (backlog_.contains(hash)) {
+            carried_hashes.push_back(hash);
+          }
+        }
         if (not txs.empty()) {
           log_->debug("Number of transactions in proposal = {}", txs.size());
           auto proposal = proposal_factory_->unsafeCreateProposal(
@@ -168,11 +242,11 @@ void OnDemandOrderingServiceImpl::packNextProposals(
               iroha::time::now(),
               std::move(txs) | boost::adaptors::indirected);
           proposal_map_.emplace(round, std::move(proposal));
-          log_->debug(
-              "packNextProposal: data has been fetched for {}. "
-              "Discarded {} transactions.",
-              round,
-              discarded_txs_amount);
+          if (not carried_hashes.empty()) {
+            carried_over_by_round_[round] = std::move(carried_hashes);
+          }
+          log_->debug("packNextProposal: data has been fetched for {}.",
+                      round);
           round_queue_.push(round);
         }
       }
@@ -233,34 +307,135 @@ void OnDemandOrderingServiceImpl::packNextProposals(
   // new reject round
   open_round(
       {round.block_round, currentRejectRoundConsumer(round.reject_round)});
+
+  for (auto &batch : overflow) {
+    backlog_.add(std::move(batch), now);
+  }
+  if (backlog_.size() != 0) {
+    log_->info(
+        "packNextProposals: {} transactions in backlog, dropped {}, "
+        "evicted {} in total",
+        backlog_.transactions(),
+        backlog_.dropped(),
+        backlog_.evicted());
+  }
 }
 
 void OnDemandOrderingServiceImpl::tryErase() {
   while (round_queue_.size() > number_of_proposals_) {
     auto &round = round_queue_.front();
     proposal_map_.erase(round);
+    carried_over_by_round_.erase(round);
     log_->info("tryErase: erased {}", round);
     round_queue_.pop();
   }
 }
 
-bool OnDemandOrderingServiceImpl::batchAlreadyProcessed(
-    const shared_model::interface::TransactionBatch &batch) {
-  auto tx_statuses = tx_cache_->check(batch);
-  if (not tx_statuses) {
-    // TODO andrei 30.11.18 IR-51 Handle database error
-    log_->warn("Check tx presence database error. Batch: {}", batch);
-    return true;
+OnDemandOrderingServiceImpl::HashSetType
+OnDemandOrderingServiceImpl::takeServedBatches() {
+  HashSetType served;
+  consensus::Round round;
+  while (served_rounds_.try_pop(round)) {
+    auto it = carried_over_by_round_.find(round);
+    if (it != carried_over_by_round_.end()) {
+      served.insert(it->second.begin(), it->second.end());
+      carried_over_by_round_.erase(it);
+    }
   }
-  // if any transaction is commited or rejected, batch was already processed
-  // Note: any_of returns false for empty sequence
-  return std::any_of(
-      tx_statuses->begin(), tx_statuses->end(), [this](const auto &tx_status) {
-        if (iroha::ametsuchi::isAlreadyProcessed(tx_status)) {
-          log_->warn("Duplicate transaction: {}",
-                     iroha::ametsuchi::getHash(tx_status).hex());
-          return true;
-        }
-        return false;
-      });
+  return served;
+}
+
+OnDemandOrderingServiceImpl::HashSetType
+OnDemandOrderingServiceImpl::findProcessedInBacklog() const {
+  CollectionType batches;
+  {
+    // read lock
+    std::shared_lock<std::shared_timed_mutex> guard(lock_);
+    batches = backlog_.batches();
+  }
+  HashSetType processed;
+  if (batches.empty()) {
+    return processed;
+  }
+
+  auto statuses = tx_cache_->check(batches);
+  for (size_t i = 0; i < batches.size(); ++i) {
+    // the batch, whose check has failed, is checked with the next outcome
+    if (not statuses[i]) {
+      log_->warn(
+          "Check tx presence database error. Backlog batch {} is not checked",
+          batches[i]->reducedHash().hex());
+      continue;
+    }
+    if (std::any_of(statuses[i]->begin(),
+                    statuses[i]->end(),
+                    [](const auto &tx_status) {
+                      return iroha::ametsuchi::isAlreadyProcessed(tx_status);
+                    })) {
+      processed.emplace(batches[i]->reducedHash());
+    }
+  }
+  return processed;
+}
+
+OnDemandOrderingServiceImpl::CollectionType
+OnDemandOrderingServiceImpl::removeProcessed(CollectionType batches) {
+  auto statuses = tx_cache_->check(batches);
+
+  CollectionType unprocessed;
+  for (size_t i = 0; i < batches.size(); ++i) {
+    log_->info("check batch {} for already processed transactions",
+               batches[i]->reducedHash().hex());
+    if (not statuses[i]) {
+      // TODO andrei 30.11.18 IR-51 Handle database error
+      log_->warn("Check tx presence database error. Batch {} is dropped",
+                 batches[i]->reducedHash().hex());
+      continue;
+    }
+    // if any transaction is commited or rejected, batch was already processed
+    // Note: any_of returns false for empty sequence
+    auto processed = std::any_of(
+        statuses[i]->begin(),
+        statuses[i]->end(),
+        [this](const auto &tx_status) {
+          if (iroha::ametsuchi::isAlreadyProcessed(tx_status)) {
+            log_->warn("Duplicate transaction: {}",
+                       iroha::ametsuchi::getHash(tx_status).hex());
+            return true;
+          }
+          return false;
+        });
+    if (processed) {
+      ++replayed_;
+    } else {
+      unprocessed.push_back(std::move(batches[i]));
+    }
+  }
+  return unprocessed;
+}
+
+void OnDemandOrderingServiceImpl::insertBatches(const consensus::Round &round,
+                                                CollectionType batches) {
+  auto it = current_proposals_.find(round);
+  if (it == current_proposals_.end()) {
+    it =
+        std::find_if(current_proposals_.begin(),
+                     current_proposals_.end(),
+                     [&round](const auto &p) {
+                       auto request_reject_round = round.reject_round;
+                       auto reject_round = p.first.reject_round;
+                       return request_reject_round == reject_round
+                           or (request_reject_round >= 2 and reject_round >= 2);
+                     });
+    if (it == current_proposals_.end()) {
+      log_->critical("No place to store the batches!");
+      assert(false);  // terminate if in debug build
+      return;
+    }
+    log_->debug("onBatches => collection will be inserted to {}", it->first);
+  }
+  for (auto &batch : batches) {
+    it->second.push(std::move(batch));
+  }
+  log_->debug("onBatches => collection is inserted");
 }
@@ -8,14 +8,18 @@
 
 #include "ordering/on_demand_ordering_service.hpp"
 
+#include <atomic>
 #include <queue>
 #include <shared_mutex>
 #include <unordered_map>
 
 #include <tbb/concurrent_queue.h>
+#include "cryptography/fixed_hash.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger.hpp"
+#include "ordering/impl/batch_backlog.hpp"
 #include "ordering/impl/on_demand_common.hpp"
+#include "ordering/proposal_packing_policy.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -24,8 +28,34 @@ namespace iroha {
   namespace ordering {
     class OnDemandOrderingServiceImpl : public OnDemandOrderingService {
      public:
+      /// state and counters of the backlog, replay filtering and locking
+      struct Metrics {
+        /// number of batches in the backlog
+        size_t backlog_batches;
+        /// number of transactions in the backlog
+        size_t backlog_transactions;
+        /// number of transactions, which were carried over to the backlog
+        uint64_t carried_over;
+        /// number of transactions dropped for the lack of room in the backlog
+        uint64_t dropped;
+        /// number of transactions evicted from the backlog for their age
+        uint64_t evicted;
+        /// number of batches filtered out as already processed
+        uint64_t replayed;
+        /// time in microseconds, for which the exclusive lock was held by
+        /// the last packing of proposals
+        uint64_t last_packing_lock_hold_us;
+        /// the longest time in microseconds, for which the exclusive lock was
+        /// held to pack proposals
+        uint64_t max_packing_lock_hold_us;
+        /// the longest time in microseconds, for which the shared lock was
+        /// held to store received batches
+        uint64_t max_batches_lock_hold_us;
+      };
+
       /**
-       * Create on_demand ordering service with following options:
+       * Create on_demand ordering service, which packs batches in arrival
+       * order, with following options:
        * @param transaction_limit - number of maximum transactions in one
        * proposal
        * @param proposal_factory - used to generate proposals
@@ -34,6 +64,8 @@ namespace iroha {
        * removed. Default value is 3
        * @param initial_round - first round of agreement.
        * Default value is {2, kFirstRejectRound} since genesis block height is 1
+       * @param backlog_limits - limits of the batches, which are carried over
+       * to the next proposals
        * @param log to print progress
        */
       OnDemandOrderingServiceImpl(
@@ -43,6 +75,30 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           size_t number_of_proposals = 3,
           const consensus::Round &initial_round = {2, kFirstRejectRound},
+          BacklogLimits backlog_limits = {},
+          logger::Logger log = logger::log("OnDemandOrderingServiceImpl"));
+
+      /**
+       * Create on_demand ordering service with following options:
+       * @param packing_policy - chooses the batches of proposals
+       * @param proposal_factory - used to generate proposals
+       * @param tx_cache - cache of transactions
+       * @param number_of_proposals - number of stored proposals, older will be
+       * removed. Default value is 3
+       * @param initial_round - first round of agreement.
+       * Default value is {2, kFirstRejectRound} since genesis block height is 1
+       * @param backlog_limits - limits of the batches, which are carried over
+       * to the next proposals
+       * @param log to print progress
+       */
+      OnDemandOrderingServiceImpl(
+          std::shared_ptr<ProposalPackingPolicy> packing_policy,
+          std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
+              proposal_factory,
+          std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
+          size_t number_of_proposals = 3,
+          const consensus::Round &initial_round = {2, kFirstRejectRound},
+          BacklogLimits backlog_limits = {},
           logger::Logger log = logger::log("OnDemandOrderingServiceImpl"));
 
       // --------------------- | OnDemandOrderingService |_---------------------
@@ -56,7 +112,12 @@ namespace iroha {
       boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
           consensus::Round round) override;
 
+      /// @return current state and counters, which are logged on each commit
+      Metrics metrics() const;
+
      private:
+      using HashSetType = BatchBacklog::HashSetType;
+
       /**
        * Packs new proposals and creates new rounds
        * Note: method is not thread-safe
@@ -71,15 +132,40 @@ namespace iroha {
       void tryErase();
 
       /**
-       * Check if batch was already processed by the peer
+       * Collects the batches of the proposals, which were served since the
+       * last call, to remove them from the backlog
+       * Note: method is not thread-safe
+       * @return reduced hashes of the carried over batches of the proposals
        */
-      bool batchAlreadyProcessed(
-          const shared_model::interface::TransactionBatch &batch);
+      HashSetType takeServedBatches();
 
       /**
-       * Max number of transaction in one proposal
+       * Finds the batches of the backlog, which were already processed by
+       * the peer. The storage is queried without the lock, which is taken
+       * only to copy the backlog.
+       * @return reduced hashes of the processed batches
        */
-      size_t transaction_limit_;
+      HashSetType findProcessedInBacklog() const;
+
+      /**
+       * Removes the batches, which were already processed by the peer, and
+       * the batches, whose check has failed. All the batches are checked at
+       * once, and the lock is not required.
+       * @return the rest of the batches in the same order
+       */
+      CollectionType removeProcessed(CollectionType batches);
+
+      /**
+       * Stores the batches for the round
+       * Note: method requires the shared lock
+       */
+      void insertBatches(const consensus::Round &round,
+                         CollectionType batches);
+
+      /**
+       * Chooses the batches of proposals
+       */
+      std::shared_ptr<ProposalPackingPolicy> packing_policy_;
 
       /**
        * Max number of available proposals in one OS
@@ -107,10 +193,43 @@ namespace iroha {
                          consensus::RoundTypeHasher>
           current_proposals_;
 
+      /**
+       * Batches, which did not fit the proposals of their rounds. They are
+       * offered to the next proposals along with the batches of the rounds,
+       * and stay in the backlog until a proposal with them is requested,
+       * they are processed by the peer, or they expire.
+       */
+      BatchBacklog backlog_;
+
+      /**
+       * Reduced hashes of the backlog batches of the available proposals
+       */
+      std::unordered_map<consensus::Round,
+                         std::vector<shared_model::crypto::FixedHash>,
+                         consensus::RoundTypeHasher>
+          carried_over_by_round_;
+
+      /**
+       * Rounds, whose proposals were requested since the last packing. They
+       * are pushed under the shared lock.
+       */
+      tbb::concurrent_queue<consensus::Round> served_rounds_;
+
+      /**
+       * Packing lock times, which are read by metrics()
+       */
+      Metrics metrics_{};
+
+      /**
+       * Counters, which are updated without the exclusive lock
+       */
+      std::atomic<uint64_t> replayed_{0};
+      std::atomic<uint64_t> max_batches_lock_hold_us_{0};
+
       /**
        * Read write mutex for public methods
        */
-      std::shared_timed_mutex lock_;
+      mutable std::shared_timed_mutex lock_;
 
       std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
           proposal_factory_;
@@ -5,6 +5,7 @@
 
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
 
+#include <google/protobuf/arena.h>
 #include "backend/protobuf/proposal.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "interfaces/common_objects/peer.hpp"
@@ -57,16 +58,23 @@ OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
   proto::ProposalRequest request;
   request.mutable_round()->set_block_round(round.block_round);
   request.mutable_round()->set_reject_round(round.reject_round);
-  proto::ProposalResponse response;
-  auto status = stub_->RequestProposal(&context, request, &response);
+  // the whole proposal with its transactions is allocated in a single arena,
+  // which is shared by the created proposal and freed together with it
+  auto arena = std::make_shared<google::protobuf::Arena>();
+  auto response =
+      google::protobuf::Arena::CreateMessage<proto::ProposalResponse>(
+          arena.get());
+  auto status = stub_->RequestProposal(&context, request, response);
   if (not status.ok()) {
     log_->warn("RPC failed: {}", status.error_message());
     return boost::none;
   }
-  if (not response.has_proposal()) {
+  if (not response->has_proposal()) {
     return boost::none;
   }
-  return proposal_factory_->build(response.proposal())
+  return proposal_factory_
+      ->build(std::shared_ptr<protocol::Proposal>(arena,
+                                                  response->mutable_proposal()))
       .match(
           [&](iroha::expected::Value<
               std::unique_ptr<shared_model::interface::Proposal>> &v) {
@@ -0,0 +1,157 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_packing_policies.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+namespace {
+  /// size of a proposal, which is being packed
+  class ProposalSize {
+   public:
+    explicit ProposalSize(const ProposalLimits &limits) : limits_(limits) {}
+
+    void add(const shared_model::interface::TransactionBatch &batch) {
+      transactions_ += batch.transactions().size();
+      // blobs are built only if the size in bytes is limited
+      if (limits_.max_bytes != std::numeric_limits<size_t>::max()) {
+        for (const auto &tx : batch.transactions()) {
+          bytes_ += tx->blob().size();
+        }
+      }
+    }
+
+    bool full() const {
+      return transactions_ >= limits_.max_transactions
+          or bytes_ >= limits_.max_bytes;
+    }
+
+   private:
+    const ProposalLimits &limits_;
+    size_t transactions_ = 0;
+    size_t bytes_ = 0;
+  };
+
+  const std::string &creatorOf(
+      const shared_model::interface::TransactionBatch &batch) {
+    return batch.transactions().front()->creatorAccountId();
+  }
+}  // namespace
+
+FifoPackingPolicy::FifoPackingPolicy(ProposalLimits limits)
+    : limits_(limits) {}
+
+void FifoPackingPolicy::pack(BatchesType &proposal,
+                             BatchesType &candidates) const {
+  ProposalSize size(limits_);
+  for (const auto &batch : proposal) {
+    size.add(*batch);
+  }
+
+  auto it = candidates.begin();
+  for (; it != candidates.end() and not size.full(); ++it) {
+    size.add(**it);
+    proposal.push_back(std::move(*it));
+  }
+  candidates.erase(candidates.begin(), it);
+}
+
+FairPackingPolicy::FairPackingPolicy(ProposalLimits limits,
+                                     double max_account_share)
+    : limits_(limits),
+      max_account_transactions_(
+          max_account_share >= 1.
+              ? std::numeric_limits<size_t>::max()
+              : static_cast<size_t>(max_account_share
+                                    * limits.max_transactions)) {}
+
+void FairPackingPolicy::pack(BatchesType &proposal,
+                             BatchesType &candidates) const {
+  ProposalSize size(limits_);
+  // transactions of every account in the proposal
+  std::unordered_map<std::string, size_t> used;
+  for (const auto &batch : proposal) {
+    size.add(*batch);
+    used[creatorOf(*batch)] += batch->transactions().size();
+  }
+
+  /// candidates of an account in arrival order
+  struct AccountQueue {
+    std::deque<size_t> batches;
+    size_t used;
+    size_t deficit;
+  };
+  // accounts are served in order of their first candidates
+  std::vector<AccountQueue> queues;
+  std::unordered_map<std::string, size_t> queue_indices;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    const auto &account = creatorOf(*candidates[i]);
+    auto index = queue_indices.emplace(account, queues.size());
+    if (index.second) {
+      queues.push_back(AccountQueue{{}, used[account], 0});
+    }
+    queues[index.first->second].batches.push_back(i);
+  }
+
+  auto cost = [&candidates](size_t i) {
+    return candidates[i]->transactions().size();
+  };
+  std::vector<bool> taken(candidates.size(), false);
+  std::vector<AccountQueue *> active;
+  for (auto &queue : queues) {
+    active.push_back(&queue);
+  }
+  while (not active.empty() and not size.full()) {
+    // instead of one transaction per turn, every account gets at once the
+    // deficit, which the closest account lacks for its next batch
+    auto step = std::numeric_limits<size_t>::max();
+    for (auto queue : active) {
+      auto next = cost(queue->batches.front());
+      step = std::min(step, next - std::min(next, queue->deficit));
+    }
+
+    std::vector<AccountQueue *> next_active;
+    for (auto queue : active) {
+      queue->deficit += step;
+      while (not queue->batches.empty() and not size.full()) {
+        auto i = queue->batches.front();
+        if (queue->deficit < cost(i)) {
+          break;
+        }
+        if (queue->used != 0
+            and queue->used + cost(i) > max_account_transactions_) {
+          // the account has taken its share of the proposal
+          queue->batches.clear();
+          break;
+        }
+        queue->deficit -= cost(i);
+        queue->used += cost(i);
+        size.add(*candidates[i]);
+        proposal.push_back(candidates[i]);
+        taken[i] = true;
+        queue->batches.pop_front();
+      }
+      if (not queue->batches.empty()) {
+        next_active.push_back(queue);
+      }
+    }
+    active = std::move(next_active);
+  }
+
+  BatchesType rest;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (not taken[i]) {
+      rest.push_back(std::move(candidates[i]));
+    }
+  }
+  candidates = std::move(rest);
+}
@@ -0,0 +1,56 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_PACKING_POLICIES_HPP
+#define IROHA_PROPOSAL_PACKING_POLICIES_HPP
+
+#include "ordering/proposal_packing_policy.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Takes the batches in arrival order until the proposal is full
+     */
+    class FifoPackingPolicy : public ProposalPackingPolicy {
+     public:
+      explicit FifoPackingPolicy(ProposalLimits limits);
+
+      void pack(BatchesType &proposal, BatchesType &candidates) const override;
+
+     private:
+      ProposalLimits limits_;
+    };
+
+    /**
+     * Shares a proposal among the creator accounts of the batches with
+     * deficit round robin, so an account, which sends many batches, does not
+     * delay the batches of other accounts until it is served. Batches of an
+     * account keep their order, and the cost of a batch is the number of its
+     * transactions.
+     */
+    class FairPackingPolicy : public ProposalPackingPolicy {
+     public:
+      /**
+       * @param limits - limits of a proposal
+       * @param max_account_share - share of the transactions of a proposal,
+       * which one account may take even if the proposal is not full, the rest
+       * of its batches are left for the next proposals. The first batch of an
+       * account is always taken. 1 means no limit
+       */
+      explicit FairPackingPolicy(ProposalLimits limits,
+                                 double max_account_share = 1.);
+
+      void pack(BatchesType &proposal, BatchesType &candidates) const override;
+
+     private:
+      ProposalLimits limits_;
+      size_t max_account_transactions_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_PACKING_POLICIES_HPP
@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_PACKING_POLICY_HPP
+#define IROHA_PROPOSAL_PACKING_POLICY_HPP
+
+#include <limits>
+
+#include "ordering/on_demand_os_transport.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Limits of a proposal. Batches are never broken, so a batch is added
+     * while the proposal is below both limits, and the last batch may exceed
+     * them.
+     */
+    struct ProposalLimits {
+      /// number of transactions in a proposal
+      size_t max_transactions;
+      /// total size of the transactions of a proposal in bytes
+      size_t max_bytes = std::numeric_limits<size_t>::max();
+    };
+
+    /**
+     * Policy, which chooses the batches of a proposal among the batches
+     * received for it
+     */
+    class ProposalPackingPolicy {
+     public:
+      using TransactionBatchType =
+          transport::OdOsNotification::TransactionBatchType;
+      using BatchesType = std::vector<TransactionBatchType>;
+
+      /**
+       * Add the chosen batches to the proposal
+       * @param proposal - batches of the proposal, the chosen batches are
+       * appended to them
+       * @param candidates - batches in arrival order, the chosen ones are
+       * removed and the rest keep their order
+       */
+      virtual void pack(BatchesType &proposal,
+                        BatchesType &candidates) const = 0;
+
+      virtual ~ProposalPackingPolicy() = default;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_PACKING_POLICY_HPP
@@ -13,7 +13,8 @@ namespace iroha {
   PendingTransactionStorageImpl::PendingTransactionStorageImpl(
       StateObservable updated_batches,
       BatchObservable prepared_batch,
-      BatchObservable expired_batch) {
+      BatchObservable expired_batch)
+      : next_number_(0) {
     updated_batches_subscription_ =
         updated_batches.subscribe([this](const SharedState &batches) {
           this->updatedBatchesHandler(batches);
@@ -37,22 +38,74 @@ namespace iroha {
   PendingTransactionStorageImpl::SharedTxsCollectionType
   PendingTransactionStorageImpl::getPendingTransactions(
       const AccountIdType &account_id) const {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    auto creator_it = storage_.index.find(account_id);
-    if (storage_.index.end() != creator_it) {
-      auto &batch_hashes = creator_it->second;
-      SharedTxsCollectionType result;
-      auto &batches = storage_.batches;
-      for (const auto &batch_hash : batch_hashes) {
-        auto batch_it = batches.find(batch_hash);
-        if (batches.end() != batch_it) {
-          auto &txs = batch_it->second->transactions();
-          result.insert(result.end(), txs.begin(), txs.end());
-        }
+    auto &account_shard = shard(account_id);
+    std::shared_lock<std::shared_timed_mutex> lock(account_shard.mutex);
+    auto account_it = account_shard.accounts.find(account_id);
+    if (account_shard.accounts.end() == account_it) {
+      return {};
+    }
+    const auto &account = account_it->second;
+    SharedTxsCollectionType result;
+    result.reserve(account.transactions_count);
+    for (const auto &batch : account.batches) {
+      auto &txs = batch.second->transactions();
+      result.insert(result.end(), txs.begin(), txs.end());
+    }
+    return result;
+  }
+
+  expected::Result<PendingTransactionStorage::Response,
+                   PendingTransactionStorage::ErrorCode>
+  PendingTransactionStorageImpl::getPendingTransactions(
+      const AccountIdType &account_id,
+      TransactionsNumberType page_size,
+      const boost::optional<HashType> &first_tx_hash) const {
+    auto &account_shard = shard(account_id);
+    std::shared_lock<std::shared_timed_mutex> lock(account_shard.mutex);
+    auto account_it = account_shard.accounts.find(account_id);
+    if (account_shard.accounts.end() == account_it) {
+      if (first_tx_hash) {
+        return expected::makeError(ErrorCode::kNotFound);
+      }
+      return expected::makeValue(Response{{}, 0, boost::none});
+    }
+    const auto &account = account_it->second;
+
+    auto batch_it = account.batches.begin();
+    if (first_tx_hash) {
+      auto number_it = account.by_tx.find(FixedHash(*first_tx_hash));
+      if (account.by_tx.end() == number_it) {
+        return expected::makeError(ErrorCode::kNotFound);
+      }
+      batch_it = account.batches.find(number_it->second);
+    }
+
+    Response response;
+    response.all_transactions_size =
+        static_cast<TransactionsNumberType>(account.transactions_count);
+    for (; account.batches.end() != batch_it; ++batch_it) {
+      auto &txs = batch_it->second->transactions();
+      // batches are not split, but the first one is taken anyway, so that
+      // the client can make progress
+      if (not response.transactions.empty()
+          and response.transactions.size() + txs.size() > page_size) {
+        response.next_tx_hash = txs.front()->hash();
+        break;
       }
-      return result;
+      response.transactions.insert(
+          response.transactions.end(), txs.begin(), txs.end());
     }
-    return {};
+    return expected::makeValue(std::move(response));
+  }
+
+  const PendingTransactionStorageImpl::Shard &
+  PendingTransactionStorageImpl::shard(const AccountIdType &account_id) const {
+    return shards_[std::hash<AccountIdType>{}(account_id) % kShardsCount];
+  }
+
+  PendingTransactionStorageImpl::Shard &PendingTransactionStorageImpl::shard(
+      const AccountIdType &account_id) {
+    return shards_[std::hash<AccountIdType>{}(account_id) % kShardsCount];
   }
 
   std::set<PendingTransactionStorageImpl::AccountIdType>
@@ -66,37 +119,52 @@ namespace iroha {
 
   void PendingTransactionStorageImpl::updatedBatchesHandler(
       const SharedState &updated_batches) {
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
     for (auto &batch : updated_batches->getBatches()) {
-      auto hash = batch->reducedHash();
-      auto it = storage_.batches.find(hash);
-      if (storage_.batches.end() == it) {
-        for (const auto &creator : batchCreators(*batch)) {
-          storage_.index[creator].insert(hash);
+      const auto &hash = batch->reducedHash();
+      for (const auto &creator : batchCreators(*batch)) {
+        auto &account_shard = shard(creator);
+        std::unique_lock<std::shared_timed_mutex> lock(account_shard.mutex);
+        auto &account = account_shard.accounts[creator];
+        auto number_it = account.by_batch.find(hash);
+        if (account.by_batch.end() != number_it) {
+          // the batch got new signatures
+          account.batches[number_it->second] = batch;
+          continue;
+        }
+        const auto number = next_number_++;
+        account.batches.emplace(number, batch);
+        account.by_batch.emplace(hash, number);
+        for (const auto &tx : batch->transactions()) {
+          account.by_tx.emplace(FixedHash(tx->hash()), number);
         }
+        account.transactions_count += batch->transactions().size();
       }
-      storage_.batches[hash] = batch;
     }
   }
 
   void PendingTransactionStorageImpl::removeBatch(const SharedBatch &batch) {
-    auto creators = batchCreators(*batch);
-    auto hash = batch->reducedHash();
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    auto &batches = storage_.batches;
-    auto batch_it = batches.find(hash);
-    if (batches.end() != batch_it) {
-      batches.erase(batch_it);
-    }
-    for (const auto &creator : creators) {
-      auto &index = storage_.index;
-      auto index_it = index.find(creator);
-      if (index.end() != index_it) {
-        auto &creator_set = index_it->second;
-        auto creator_it = creator_set.find(hash);
-        if (creator_set.end() != creator_it) {
-          creator_set.erase(creator_it);
-        }
+    const auto &hash = batch->reducedHash();
+    for (const auto &creator : batchCreators(*batch)) {
+      auto &account_shard = shard(creator);
+      std::unique_lock<std::shared_timed_mutex> lock(account_shard.mutex);
+      auto account_it = account_shard.accounts.find(creator);
+      if (account_shard.accounts.end() == account_it) {
+        continue;
+      }
+      auto &account = account_it->second;
+      auto number_it = account.by_batch.find(hash);
+      if (account.by_batch.end() == number_it) {
+        continue;
+      }
+      auto batch_it = account.batches.find(number_it->second);
+      for (const auto &tx : batch_it->second->transactions()) {
+        account.by_tx.erase(FixedHash(tx->hash()));
+      }
+      account.transactions_count -= batch_it->second->transactions().size();
+      account.batches.erase(batch_it);
+      account.by_batch.erase(number_it);
+      if (account.batches.empty()) {
+        account_shard.accounts.erase(account_it);
       }
     }
   }
@@ -6,12 +6,15 @@
 #ifndef IROHA_PENDING_TXS_STORAGE_IMPL_HPP
 #define IROHA_PENDING_TXS_STORAGE_IMPL_HPP
 
+#include <array>
+#include <atomic>
+#include <map>
 #include <set>
 #include <shared_mutex>
 #include <unordered_map>
-#include <unordered_set>
 
 #include <rxcpp/rx.hpp>
+#include "cryptography/fixed_hash.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "pending_txs_storage/pending_txs_storage.hpp"
 
@@ -25,6 +28,8 @@ namespace iroha {
     using HashType = shared_model::interface::types::HashType;
     using SharedTxsCollectionType =
         shared_model::interface::types::SharedTxsCollectionType;
+    using TransactionsNumberType =
+        shared_model::interface::types::TransactionsNumberType;
     using TransactionBatch = shared_model::interface::TransactionBatch;
     using SharedState = std::shared_ptr<MstState>;
     using SharedBatch = std::shared_ptr<TransactionBatch>;
@@ -40,7 +45,49 @@ namespace iroha {
     SharedTxsCollectionType getPendingTransactions(
         const AccountIdType &account_id) const override;
 
+    expected::Result<Response, ErrorCode> getPendingTransactions(
+        const AccountIdType &account_id,
+        TransactionsNumberType page_size,
+        const boost::optional<HashType> &first_tx_hash) const override;
+
    private:
+    using FixedHash = shared_model::crypto::FixedHash;
+
+    /**
+     * Pending batches of a single account. Batches are numbered in order of
+     * their arrival, so that pages are stable while batches come and go.
+     */
+    struct AccountBatches {
+      /// batches by their arrival numbers
+      std::map<uint64_t, SharedBatch> batches;
+      /// arrival numbers by reduced hashes of batches, which are longer than
+      /// a single hash for batches of several transactions
+      std::unordered_map<HashType, uint64_t, HashType::Hasher> by_batch;
+      /// arrival numbers by hashes of transactions of the batches
+      std::unordered_map<FixedHash, uint64_t, FixedHash::Hasher> by_tx;
+      /// number of transactions in all the batches
+      size_t transactions_count = 0;
+    };
+
+    /**
+     * Part of the storage with accounts, which have the same hash of the
+     * identifier. Each shard has its own lock, so that queries and updates of
+     * different accounts rarely contend.
+     */
+    struct Shard {
+      /**
+       * Mutex for single-write multiple-read shard access
+       */
+      mutable std::shared_timed_mutex mutex;
+      std::unordered_map<AccountIdType, AccountBatches> accounts;
+    };
+
+    static constexpr size_t kShardsCount = 16;
+
+    const Shard &shard(const AccountIdType &account_id) const;
+
+    Shard &shard(const AccountIdType &account_id);
+
     void updatedBatchesHandler(const SharedState &updated_batches);
 
     void removeBatch(const SharedBatch &batch);
@@ -55,28 +102,14 @@ namespace iroha {
     rxcpp::composite_subscription expired_batch_subscription_;
 
     /**
-     * Mutex for single-write multiple-read storage access
+     * Storage is split into shards by account identifiers. A batch is stored
+     * in the shard of each account, which has created at least one of its
+     * transactions.
      */
-    mutable std::shared_timed_mutex mutex_;
+    std::array<Shard, kShardsCount> shards_;
 
-    /**
-     * Storage is composed of two maps:
-     * Indices map contains relations of accounts and batch hashes. For each
-     * account there are listed hashes of batches, where the account has created
-     * at least one transaction.
-     *
-     * Batches map is used for storing and fast access to batches via batch
-     * hashes.
-     */
-    struct {
-      std::unordered_map<AccountIdType,
-                         std::unordered_set<HashType, HashType::Hasher>>
-          index;
-      std::unordered_map<HashType,
-                         std::shared_ptr<TransactionBatch>,
-                         HashType::Hasher>
-          batches;
-    } storage_;
+    /// arrival number of the next batch
+    std::atomic<uint64_t> next_number_;
   };
 
 }  // namespace iroha
@@ -6,7 +6,10 @@
 #ifndef IROHA_PENDING_TXS_STORAGE_HPP
 #define IROHA_PENDING_TXS_STORAGE_HPP
 
+#include <boost/optional.hpp>
 #include <rxcpp/rx.hpp>
+#include "common/result.hpp"
+#include "cryptography/hash.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/common_objects/types.hpp"
 
@@ -17,6 +20,22 @@ namespace iroha {
    */
   class PendingTransactionStorage {
    public:
+    /// page of pending transactions of an account
+    struct Response {
+      /// transactions of the page, batches are never split between pages
+      shared_model::interface::types::SharedTxsCollectionType transactions;
+      /// number of all the pending transactions of the account
+      shared_model::interface::types::TransactionsNumberType
+          all_transactions_size;
+      /// hash of the first transaction of the next page, if there is one
+      boost::optional<shared_model::interface::types::HashType> next_tx_hash;
+    };
+
+    enum class ErrorCode {
+      /// the first requested transaction is not pending
+      kNotFound
+    };
+
     /**
      * Get all the pending transactions associated with request originator
      * @param account_id - query creator
@@ -26,6 +45,23 @@ namespace iroha {
     getPendingTransactions(const shared_model::interface::types::AccountIdType
                                &account_id) const = 0;
 
+    /**
+     * Get a page of pending transactions associated with request originator.
+     * Transactions are ordered by the arrival of their batches. The page
+     * consists of whole batches, which fit into the page size, but has at
+     * least one batch, even if the batch is larger than the page.
+     * @param account_id - query creator
+     * @param page_size - maximum number of transactions in the page
+     * @param first_tx_hash - hash of a transaction of the first batch in the
+     * page, the page starts from the oldest batch if none
+     * @return the page, or kNotFound if the first transaction is not pending
+     */
+    virtual expected::Result<Response, ErrorCode> getPendingTransactions(
+        const shared_model::interface::types::AccountIdType &account_id,
+        shared_model::interface::types::TransactionsNumberType page_size,
+        const boost::optional<shared_model::interface::types::HashType>
+            &first_tx_hash) const = 0;
+
     virtual ~PendingTransactionStorage() = default;
   };
 
@@ -8,6 +8,7 @@
 
 #include <endpoint.grpc.pb.h>
 #include <grpc++/grpc++.h>
+#include <functional>
 #include <memory>
 #include <thread>
 
@@ -56,6 +57,28 @@ namespace torii {
         const iroha::protocol::TxStatusRequest &tx,
         std::vector<iroha::protocol::ToriiResponse> &response) const;
 
+    /**
+     * Acquires stream of statuses of several transactions from the request
+     * moment until all of them are final.
+     * @param request - hashes of transactions to follow.
+     * @param response - vector of all statuses during txs pipeline, in order
+     * of arrival.
+     */
+    void ListStatusStream(
+        const iroha::protocol::TxStatusListRequest &request,
+        std::vector<iroha::protocol::ToriiResponse> &response) const;
+
+    /**
+     * Acquires stream of statuses of several transactions from the request
+     * moment until all of them are final.
+     * @param request - hashes of transactions to follow.
+     * @param on_status - called with every status as soon as it arrives.
+     */
+    void ListStatusStream(
+        const iroha::protocol::TxStatusListRequest &request,
+        const std::function<void(const iroha::protocol::ToriiResponse &)>
+            &on_status) const;
+
    private:
     std::unique_ptr<iroha::protocol::CommandService_v1::StubInterface> stub_;
     logger::Logger log_;
@@ -0,0 +1,213 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/blocks_broadcast.hpp"
+
+#include <algorithm>
+
+#include "ametsuchi/block_query_factory.hpp"
+#include "backend/protobuf/block.hpp"
+#include "common/bind.hpp"
+#include "qry_responses.pb.h"
+
+namespace iroha {
+  namespace torii {
+
+    BlocksBroadcast::Subscriber::Subscriber(
+        const BlocksBroadcast &broadcast,
+        shared_model::interface::types::HeightType start_height)
+        : broadcast_(broadcast),
+          next_height_(start_height),
+          closed_(false),
+          disconnected_(false) {}
+
+    boost::optional<BlocksBroadcast::SerializedBlockPtr>
+    BlocksBroadcast::Subscriber::next(std::chrono::milliseconds timeout) {
+      const auto deadline = std::chrono::steady_clock::now() + timeout;
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        // blocks which were already read from the block store
+        while (not queue_.empty() and queue_.front()->height < next_height_) {
+          queue_.pop_front();
+        }
+        if (disconnected_) {
+          return boost::none;
+        }
+        if (not queue_.empty()
+            and (next_height_ == 0 or queue_.front()->height == next_height_)) {
+          auto block = std::move(queue_.front());
+          queue_.pop_front();
+          next_height_ = block->height + 1;
+          return block;
+        }
+
+        // the next block is committed, but it is not queued: it was either
+        // committed before subscription or dropped from the queue
+        const auto height = next_height_;
+        if (height != 0 and height <= broadcast_.top_height_) {
+          lock.unlock();
+          auto block = broadcast_.load(height);
+          lock.lock();
+          if (not block) {
+            // the stream cannot continue without a gap
+            closed_ = true;
+            queue_.clear();
+            next_height_ = 0;
+            return boost::none;
+          }
+          next_height_ = height + 1;
+          return block;
+        }
+
+        if (closed_
+            or queue_cv_.wait_until(lock, deadline)
+                == std::cv_status::timeout) {
+          return boost::none;
+        }
+      }
+    }
+
+    bool BlocksBroadcast::Subscriber::closed() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const bool caught_up =
+          next_height_ == 0 or next_height_ > broadcast_.top_height_;
+      return disconnected_ or (closed_ and queue_.empty() and caught_up);
+    }
+
+    bool BlocksBroadcast::Subscriber::disconnected() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return disconnected_;
+    }
+
+    void BlocksBroadcast::Subscriber::push(const SerializedBlockPtr &block) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_ or disconnected_) {
+        return;
+      }
+      if (queue_.size() >= broadcast_.queue_size_) {
+        if (broadcast_.overflow_policy_ == OverflowPolicy::kDisconnect) {
+          disconnected_ = true;
+          queue_.clear();
+          queue_cv_.notify_one();
+          return;
+        }
+        if (next_height_ == 0) {
+          // the dropped block is the first one to deliver
+          next_height_ = queue_.front()->height;
+        }
+        queue_.pop_front();
+      }
+      queue_.push_back(block);
+      queue_cv_.notify_one();
+    }
+
+    void BlocksBroadcast::Subscriber::close() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      queue_cv_.notify_one();
+    }
+
+    BlocksBroadcast::BlocksBroadcast(
+        rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+            commits,
+        std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
+        size_t queue_size,
+        OverflowPolicy overflow_policy,
+        logger::Logger log)
+        : block_query_factory_(std::move(block_query_factory)),
+          queue_size_(std::max<size_t>(queue_size, 1)),
+          overflow_policy_(overflow_policy),
+          log_(std::move(log)),
+          top_height_(0),
+          closed_(false) {
+      block_query_factory_->createBlockQuery() |
+          [this](const auto &block_query) {
+            top_height_ = block_query->getTopBlockHeight();
+          };
+      commits.subscribe(
+          subscription_,
+          [this](const std::shared_ptr<shared_model::interface::Block> &block) {
+            this->publish(serialize(*block));
+          },
+          [this] { this->close(); });
+    }
+
+    BlocksBroadcast::~BlocksBroadcast() {
+      subscription_.unsubscribe();
+      close();
+    }
+
+    std::shared_ptr<BlocksBroadcast::Subscriber> BlocksBroadcast::subscribe(
+        shared_model::interface::types::HeightType start_height) {
+      std::shared_ptr<Subscriber> subscriber(
+          new Subscriber(*this, start_height));
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_) {
+        subscriber->close();
+      } else {
+        subscribers_.push_back(subscriber);
+      }
+      return subscriber;
+    }
+
+    BlocksBroadcast::SerializedBlockPtr BlocksBroadcast::serialize(
+        const shared_model::interface::Block &block) {
+      iroha::protocol::BlockResponse response;
+      *response.mutable_block()->mutable_block_v1() =
+          static_cast<const shared_model::proto::Block &>(block)
+              .getTransport();
+      auto serialized = std::make_shared<SerializedBlock>();
+      serialized->height = block.height();
+      response.SerializeToString(&serialized->block_response);
+      return serialized;
+    }
+
+    void BlocksBroadcast::publish(const SerializedBlockPtr &block) {
+      if (block->height > top_height_) {
+        top_height_ = block->height;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      subscribers_.erase(
+          std::remove_if(subscribers_.begin(),
+                         subscribers_.end(),
+                         [&block](const auto &weak_subscriber) {
+                           auto subscriber = weak_subscriber.lock();
+                           if (subscriber) {
+                             subscriber->push(block);
+                           }
+                           return not subscriber;
+                         }),
+          subscribers_.end());
+      log_->debug("Block {} is queued for {} subscribers",
+                  block->height,
+                  subscribers_.size());
+    }
+
+    void BlocksBroadcast::close() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      for (const auto &weak_subscriber : subscribers_) {
+        if (auto subscriber = weak_subscriber.lock()) {
+          subscriber->close();
+        }
+      }
+      subscribers_.clear();
+    }
+
+    boost::optional<BlocksBroadcast::SerializedBlockPtr> BlocksBroadcast::load(
+        shared_model::interface::types::HeightType height) const {
+      auto blocks = block_query_factory_->createBlockQuery() |
+          [height](const auto &block_query) {
+            return boost::make_optional(block_query->getBlocks(height, 1));
+          };
+      if (not blocks or blocks->empty()) {
+        log_->error("Failed to read block {} from the block store", height);
+        return boost::none;
+      }
+      return serialize(*blocks->front());
+    }
+
+  }  // namespace torii
+}  // namespace iroha
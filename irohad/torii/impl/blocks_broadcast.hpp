@@ -0,0 +1,163 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_BLOCKS_BROADCAST_HPP
+#define TORII_BLOCKS_BROADCAST_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <rxcpp/rx.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+    class BlockQueryFactory;
+  }  // namespace ametsuchi
+
+  namespace torii {
+    /**
+     * Fans out committed blocks to FetchCommits streams.
+     *
+     * Every committed block is serialized once, and the same immutable bytes
+     * are queued for all subscribers. Queues are bounded: when a subscriber
+     * does not keep up, either its oldest queued blocks are dropped and later
+     * read from the block store, or the subscriber is disconnected. A
+     * subscriber may also start from a height in the past, then committed
+     * blocks are read from the block store before the new ones.
+     */
+    class BlocksBroadcast {
+     public:
+      /// committed block serialized as protobuf BlockResponse
+      struct SerializedBlock {
+        shared_model::interface::types::HeightType height;
+        std::string block_response;
+      };
+      using SerializedBlockPtr = std::shared_ptr<const SerializedBlock>;
+
+      /// what happens to a subscriber whose queue is full
+      enum class OverflowPolicy {
+        /// drop the oldest queued block, it is read from the block store
+        /// when the subscriber reaches it
+        kDropOldest,
+        /// stop streaming to the subscriber
+        kDisconnect
+      };
+
+      /**
+       * Queue of blocks of one stream. Blocks are delivered in order of
+       * heights without gaps, starting either from the requested height or
+       * from the first block committed after subscription.
+       */
+      class Subscriber {
+       public:
+        /**
+         * Wait for the next block. Must be called from one thread at a time
+         * @param timeout - maximum time of waiting
+         * @return the next block, or none if it did not come in time or the
+         * stream is over
+         */
+        boost::optional<SerializedBlockPtr> next(
+            std::chrono::milliseconds timeout);
+
+        /// @return true if no more blocks will be delivered
+        bool closed() const;
+
+        /// @return true if the subscriber was disconnected for falling behind
+        bool disconnected() const;
+
+       private:
+        friend class BlocksBroadcast;
+
+        Subscriber(const BlocksBroadcast &broadcast,
+                   shared_model::interface::types::HeightType start_height);
+
+        void push(const SerializedBlockPtr &block);
+        void close();
+
+        const BlocksBroadcast &broadcast_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable queue_cv_;
+        std::deque<SerializedBlockPtr> queue_;
+        /// height of the next block to deliver, 0 if it is not known yet
+        shared_model::interface::types::HeightType next_height_;
+        bool closed_;
+        bool disconnected_;
+      };
+
+      /**
+       * @param commits - committed blocks; streams are over when it completes
+       * @param block_query_factory - source of blocks, which are not queued
+       * @param queue_size - maximum number of queued blocks per subscriber
+       * @param overflow_policy - what happens when the queue is full
+       */
+      BlocksBroadcast(
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              commits,
+          std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
+          size_t queue_size,
+          OverflowPolicy overflow_policy,
+          logger::Logger log = logger::log("BlocksBroadcast"));
+
+      ~BlocksBroadcast();
+
+      /**
+       * Subscribe for committed blocks. The broadcast must outlive the
+       * subscriber
+       * @param start_height - height of the first block, 0 for the first block
+       * committed after subscription
+       * @return subscriber, which is forgotten when it is destroyed
+       */
+      std::shared_ptr<Subscriber> subscribe(
+          shared_model::interface::types::HeightType start_height);
+
+      /**
+       * @param block - block to serialize
+       * @return the block as protobuf BlockResponse
+       */
+      static SerializedBlockPtr serialize(
+          const shared_model::interface::Block &block);
+
+     private:
+      void publish(const SerializedBlockPtr &block);
+      void close();
+
+      /// read the block from the block store
+      boost::optional<SerializedBlockPtr> load(
+          shared_model::interface::types::HeightType height) const;
+
+      std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
+      const size_t queue_size_;
+      const OverflowPolicy overflow_policy_;
+      logger::Logger log_;
+
+      /// height of the last block, which is in the block store
+      std::atomic<shared_model::interface::types::HeightType> top_height_;
+
+      std::mutex mutex_;
+      std::vector<std::weak_ptr<Subscriber>> subscribers_;
+      bool closed_;
+
+      rxcpp::composite_subscription subscription_;
+    };
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_BLOCKS_BROADCAST_HPP
@@ -56,4 +56,30 @@ namespace torii {
     reader->Finish();
   }
 
+  void CommandSyncClient::ListStatusStream(
+      const iroha::protocol::TxStatusListRequest &request,
+      std::vector<iroha::protocol::ToriiResponse> &response) const {
+    ListStatusStream(request, [&response](const auto &status) {
+      response.push_back(status);
+    });
+  }
+
+  void CommandSyncClient::ListStatusStream(
+      const iroha::protocol::TxStatusListRequest &request,
+      const std::function<void(const iroha::protocol::ToriiResponse &)>
+          &on_status) const {
+    grpc::ClientContext context;
+    iroha::protocol::ToriiResponseList resp;
+    auto reader = stub_->ListStatusStream(&context, request);
+    while (reader->Read(&resp)) {
+      for (const auto &status : resp.responses()) {
+        log_->debug("received new status: {}, hash {}",
+                    status.tx_status(),
+                    iroha::bytestringToHexstring(status.tx_hash()));
+        on_status(status);
+      }
+    }
+    reader->Finish();
+  }
+
 }  // namespace torii
@@ -9,25 +9,37 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <iterator>
+#include <unordered_map>
 
 #include <boost/format.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/transaction_responses/proto_tx_response.hpp"
+#include "backend/protobuf/util.hpp"
 #include "common/combine_latest_until_first_completed.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "interfaces/transaction.hpp"
+#include "torii/impl/transaction_intake.hpp"
 #include "torii/status_bus.hpp"
 
+namespace {
+  /// how many client connections may have their submissions remembered
+  constexpr size_t kMaxTrackedConnections = 1024;
+  /// how many submitted transactions are remembered for a connection
+  constexpr size_t kMaxTrackedTransactionsPerConnection = 10000;
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
     CommandServiceTransportGrpc::CommandServiceTransportGrpc(
         std::shared_ptr<CommandService> command_service,
+        std::shared_ptr<TransactionIntake> transaction_intake,
         std::shared_ptr<iroha::torii::StatusBus> status_bus,
         std::shared_ptr<shared_model::interface::TxStatusFactory>
             status_factory,
@@ -40,6 +52,7 @@ namespace iroha {
         int maximum_rounds_without_update,
         logger::Logger log)
         : command_service_(std::move(command_service)),
+          transaction_intake_(std::move(transaction_intake)),
           status_bus_(std::move(status_bus)),
           status_factory_(std::move(status_factory)),
           transaction_factory_(std::move(transaction_factory)),
@@ -47,7 +60,9 @@ namespace iroha {
           batch_factory_(std::move(transaction_batch_factory)),
           log_(std::move(log)),
           consensus_gate_objects_(std::move(consensus_gate_objects)),
-          maximum_rounds_without_update_(maximum_rounds_without_update) {}
+          maximum_rounds_without_update_(maximum_rounds_without_update),
+          submitted_transactions_(kMaxTrackedConnections,
+                                  kMaxTrackedTransactionsPerConnection) {}
 
     grpc::Status CommandServiceTransportGrpc::Torii(
         grpc::ServerContext *context,
@@ -94,22 +109,42 @@ namespace iroha {
 
     shared_model::interface::types::SharedTxsCollectionType
     CommandServiceTransportGrpc::deserializeTransactions(
-        const iroha::protocol::TxList *request) {
+        const iroha::protocol::TxList *request, const std::string &connection) {
       shared_model::interface::types::SharedTxsCollectionType tx_collection;
+      std::vector<TransportFactoryType::Error> errors;
       for (const auto &tx : request->transactions()) {
-        transaction_factory_->build(tx).match(
+        // all submessages of a transaction are allocated in a single arena
+        auto transport = shared_model::proto::makeArenaCopy(tx);
+        transaction_factory_->build(std::move(transport)).match(
             [&tx_collection](
                 iroha::expected::Value<
                     std::unique_ptr<shared_model::interface::Transaction>> &v) {
               tx_collection.emplace_back(std::move(v).value);
             },
-            [this](iroha::expected::Error<TransportFactoryType::Error> &error) {
-              status_bus_->publish(status_factory_->makeStatelessFail(
-                  error.error.hash,
-                  shared_model::interface::TxStatusFactory::TransactionError{
-                      error.error.error, 0, 0}));
+            [&errors](
+                iroha::expected::Error<TransportFactoryType::Error> &error) {
+              errors.push_back(std::move(error.error));
             });
       }
+
+      // remember the submissions before any status of them is published, so
+      // that status streams attached to this connection do not miss it
+      std::vector<shared_model::crypto::Hash> hashes;
+      hashes.reserve(tx_collection.size() + errors.size());
+      for (const auto &tx : tx_collection) {
+        hashes.push_back(tx->hash());
+      }
+      for (const auto &error : errors) {
+        hashes.push_back(error.hash);
+      }
+      submitted_transactions_.add(connection, hashes);
+
+      for (const auto &error : errors) {
+        status_bus_->publish(status_factory_->makeStatelessFail(
+            error.hash,
+            shared_model::interface::TxStatusFactory::TransactionError{
+                error.error, 0, 0}));
+      }
       return tx_collection;
     }
 
@@ -117,16 +152,16 @@ namespace iroha {
         grpc::ServerContext *context,
         const iroha::protocol::TxList *request,
         google::protobuf::Empty *response) {
-      auto transactions = deserializeTransactions(request);
+      auto transactions = deserializeTransactions(request, context->peer());
 
       auto batches = batch_parser_->parseBatches(transactions);
 
+      std::vector<TransactionIntake::BatchPtr> valid_batches;
       for (auto &batch : batches) {
         batch_factory_->createTransactionBatch(batch).match(
             [&](iroha::expected::Value<std::unique_ptr<
                     shared_model::interface::TransactionBatch>> &value) {
-              this->command_service_->handleTransactionBatch(
-                  std::move(value).value);
+              valid_batches.push_back(std::move(value).value);
             },
             [&](iroha::expected::Error<std::string> &error) {
               std::vector<shared_model::crypto::Hash> hashes;
@@ -148,6 +183,11 @@ namespace iroha {
             });
       }
 
+      if (not transaction_intake_->push(std::move(valid_batches))) {
+        return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                            "Too many transactions are waiting to be "
+                            "processed, try again later");
+      }
       return grpc::Status::OK;
     }
 
@@ -165,8 +205,17 @@ namespace iroha {
     }
 
     namespace {
+      /**
+       * Execute events scheduled in run loop until it is not empty and the
+       * subscriber is active
+       * @param subscription - tx status subscription
+       * @param run_loop - gRPC thread run loop
+       * @param on_drained - called every time all the events which are due
+       * have been executed, before waiting for the new ones
+       */
       void handleEvents(rxcpp::composite_subscription &subscription,
-                        rxcpp::schedulers::run_loop &run_loop) {
+                        rxcpp::schedulers::run_loop &run_loop,
+                        const std::function<void()> &on_drained = [] {}) {
         std::condition_variable wait_cv;
 
         run_loop.set_notify_earlier_wakeup(
@@ -180,6 +229,8 @@ namespace iroha {
             run_loop.dispatch();
           }
 
+          on_drained();
+
           if (run_loop.empty()) {
             wait_cv.wait(lock, [&run_loop, &subscription]() {
               return not subscription.is_subscribed() or not run_loop.empty();
@@ -189,6 +240,16 @@ namespace iroha {
           }
         }
       }
+
+      /**
+       * Statuses after which a transaction cannot change its status anymore,
+       * the same as CommandServiceImpl uses to complete a status stream
+       */
+      bool isFinalStatus(iroha::protocol::TxStatus status) {
+        return status == iroha::protocol::TxStatus::STATELESS_VALIDATION_FAILED
+            or status == iroha::protocol::TxStatus::COMMITTED
+            or status == iroha::protocol::TxStatus::REJECTED;
+      }
     }  // namespace
 
     grpc::Status CommandServiceTransportGrpc::StatusStream(
@@ -275,5 +336,188 @@ namespace iroha {
       log_->debug("status stream done, {}", client_id);
       return grpc::Status::OK;
     }
+
+    grpc::Status CommandServiceTransportGrpc::ListStatusStream(
+        grpc::ServerContext *context,
+        const iroha::protocol::TxStatusListRequest *request,
+        grpc::ServerWriter<iroha::protocol::ToriiResponseList>
+            *response_writer) {
+      using shared_model::crypto::Hash;
+
+      rxcpp::schedulers::run_loop rl;
+
+      auto current_thread = rxcpp::synchronize_in_one_worker(
+          rxcpp::schedulers::make_run_loop(rl));
+
+      rxcpp::composite_subscription subscription;
+
+      const auto connection = context->peer();
+      const bool follow_connection = request->submitted_on_connection();
+      std::string client_id =
+          (boost::format("Peer: '%s', %d hashes") % connection
+           % request->tx_hashes_size())
+              .str();
+
+      // last status written or pending for every followed transaction
+      std::unordered_map<Hash, boost::optional<iroha::protocol::TxStatus>,
+                         Hash::Hasher>
+          followed;
+      size_t not_final = 0;
+      // followed transactions in order of request, to report current statuses
+      std::vector<Hash> initial;
+      // statuses received since the last write, at most one per transaction
+      iroha::protocol::ToriiResponseList pending;
+      std::unordered_map<Hash, int, Hash::Hasher> pending_positions;
+      bool updated = false;
+      auto rounds_counter{0};
+
+      auto follow = [&](const Hash &hash) {
+        if (followed.emplace(hash, boost::none).second) {
+          ++not_final;
+          initial.push_back(hash);
+        }
+      };
+      for (const auto &hex : request->tx_hashes()) {
+        follow(Hash::fromHexString(hex));
+      }
+      // every stream follows the submissions of its connection on its own,
+      // so other streams of the connection do not miss their statuses
+      SubmittedTransactionsRegistry::StreamId stream{};
+      if (follow_connection) {
+        stream = submitted_transactions_.attach(connection);
+        for (const auto &hash :
+             submitted_transactions_.get(connection, stream)) {
+          follow(hash);
+        }
+      }
+
+      auto on_status = [&](const std::shared_ptr<
+                           shared_model::interface::TransactionResponse>
+                               &response) {
+        const auto &hash = response->transactionHash();
+        auto it = followed.find(hash);
+        if (it == followed.end()) {
+          if (not follow_connection
+              or not submitted_transactions_.contains(
+                     connection, stream, hash)) {
+            return;
+          }
+          it = followed.emplace(hash, boost::none).first;
+          ++not_final;
+        }
+
+        const auto &proto_response =
+            std::static_pointer_cast<shared_model::proto::TransactionResponse>(
+                response)
+                ->getTransport();
+        const auto status = proto_response.tx_status();
+        if (it->second and *it->second == status) {
+          return;
+        }
+        if (it->second and isFinalStatus(*it->second)) {
+          // a transaction does not leave a final status, a repeated
+          // notification about an already processed transaction is omitted
+          return;
+        }
+        it->second = status;
+        updated = true;
+
+        auto position = pending_positions.find(hash);
+        if (position == pending_positions.end()) {
+          pending_positions.emplace(hash, pending.responses_size());
+          *pending.add_responses() = proto_response;
+        } else {
+          *pending.mutable_responses(position->second) = proto_response;
+        }
+
+        if (isFinalStatus(status)) {
+          --not_final;
+          if (follow_connection) {
+            submitted_transactions_.remove(connection, stream, hash);
+          }
+          if (not follow_connection and not_final == 0) {
+            log_->debug("all statuses are final, {}", client_id);
+            subscription.unsubscribe();
+          }
+        }
+      };
+
+      auto flush = [&] {
+        if (pending.responses_size() == 0) {
+          return;
+        }
+        if (context->IsCancelled()) {
+          log_->debug("client unsubscribed, {}", client_id);
+          subscription.unsubscribe();
+        } else if (not response_writer->Write(pending)) {
+          log_->error("write to stream has failed to client {}", client_id);
+          subscription.unsubscribe();
+        } else {
+          log_->debug("{} statuses written, {}",
+                      pending.responses_size(),
+                      client_id);
+        }
+        pending.clear_responses();
+        pending_positions.clear();
+      };
+
+      // current statuses go first, the stream is never empty
+      for (const auto &hash : initial) {
+        on_status(command_service_->getStatus(hash));
+      }
+
+      if (not follow_connection and not_final == 0) {
+        flush();
+        log_->debug("list status stream done, {}", client_id);
+        return grpc::Status::OK;
+      }
+
+      auto on_error = [&](std::exception_ptr) {
+        log_->error("something bad happened, client_id {}", client_id);
+        subscription.unsubscribe();
+      };
+      auto on_completed = [&] { subscription.unsubscribe(); };
+
+      // one subscription serves all followed transactions
+      status_bus_->statuses()
+          .observe_on(current_thread)
+          .subscribe(subscription, on_status, on_error, on_completed);
+
+      consensus_gate_objects_.observe_on(current_thread)
+          .subscribe(subscription,
+                     [&](const auto &) {
+                       // complete the stream if client is disconnected or too
+                       // many rounds have passed without any status change
+                       if (context->IsCancelled()) {
+                         log_->debug("client unsubscribed, {}", client_id);
+                         subscription.unsubscribe();
+                         return;
+                       }
+                       if (updated) {
+                         updated = false;
+                         rounds_counter = 0;
+                         return;
+                       }
+                       if (++rounds_counter >= maximum_rounds_without_update_) {
+                         log_->debug("no updates for {} rounds, {}",
+                                     rounds_counter,
+                                     client_id);
+                         subscription.unsubscribe();
+                       }
+                     },
+                     on_error,
+                     on_completed);
+
+      // run loop while subscription is active or there are pending events in
+      // the queue, writing coalesced updates each time the queue drains
+      handleEvents(subscription, rl, flush);
+      flush();
+      if (follow_connection) {
+        submitted_transactions_.detach(connection, stream);
+      }
+
+      log_->debug("list status stream done, {}", client_id);
+      return grpc::Status::OK;
+    }
   }  // namespace torii
 }  // namespace iroha
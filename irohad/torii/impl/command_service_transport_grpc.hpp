@@ -13,11 +13,13 @@
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger.hpp"
+#include "torii/impl/submitted_transactions_registry.hpp"
 
 namespace iroha {
   namespace torii {
     class StatusBus;
-  }
+    class TransactionIntake;
+  }  // namespace torii
 }  // namespace iroha
 
 namespace shared_model {
@@ -43,6 +45,8 @@ namespace iroha {
       /**
        * Creates a new instance of CommandServiceTransportGrpc
        * @param command_service - to delegate logic work
+       * @param transaction_intake - queue of received batches for the
+       * command service
        * @param status_bus is a common notifier for tx statuses
        * @param status_factory - factory of statuses
        * @param transaction_factory - factory of transactions
@@ -55,6 +59,7 @@ namespace iroha {
        */
       CommandServiceTransportGrpc(
           std::shared_ptr<CommandService> command_service,
+          std::shared_ptr<TransactionIntake> transaction_intake,
           std::shared_ptr<iroha::torii::StatusBus> status_bus,
           std::shared_ptr<shared_model::interface::TxStatusFactory>
               status_factory,
@@ -83,7 +88,8 @@ namespace iroha {
        * @param context - call context (see grpc docs for details)
        * @param request - list of transactions received
        * @param response - no actual response (grpc stub for empty answer)
-       * @return status
+       * @return status, RESOURCE_EXHAUSTED if the batches were not accepted
+       * because too many batches are waiting to be handled
        */
       grpc::Status ListTorii(grpc::ServerContext *context,
                              const iroha::protocol::TxList *request,
@@ -117,14 +123,38 @@ namespace iroha {
           grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
           override;
 
+      /**
+       * ListStatusStream call via grpc
+       * Follows statuses of many transactions within a single call. Updates
+       * which arrive while the previous ones are being written are coalesced
+       * into one message, which contains only the latest status of every
+       * transaction.
+       * @param context - call context
+       * @param request - TxStatusListRequest object with hashes of
+       * transactions to follow and a flag to follow all transactions submitted
+       * from the same connection
+       * @param response_writer - grpc::ServerWriter which can repeatedly send
+       * lists of transaction statuses back to the client
+       * @return status
+       */
+      grpc::Status ListStatusStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::TxStatusListRequest *request,
+          grpc::ServerWriter<iroha::protocol::ToriiResponseList>
+              *response_writer) override;
+
      private:
       /**
        * Flat map transport transactions to shared model
+       * @param request - list of transactions received
+       * @param connection - client connection the transactions came from
        */
       shared_model::interface::types::SharedTxsCollectionType
-      deserializeTransactions(const iroha::protocol::TxList *request);
+      deserializeTransactions(const iroha::protocol::TxList *request,
+                              const std::string &connection);
 
       std::shared_ptr<CommandService> command_service_;
+      std::shared_ptr<TransactionIntake> transaction_intake_;
       std::shared_ptr<iroha::torii::StatusBus> status_bus_;
       std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory_;
       std::shared_ptr<TransportFactoryType> transaction_factory_;
@@ -136,6 +166,8 @@ namespace iroha {
 
       rxcpp::observable<ConsensusGateEvent> consensus_gate_objects_;
       const int maximum_rounds_without_update_;
+
+      SubmittedTransactionsRegistry submitted_transactions_;
     };
   }  // namespace torii
 }  // namespace iroha
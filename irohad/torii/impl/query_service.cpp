@@ -11,15 +11,22 @@
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "validators/default_validator.hpp"
 
+namespace {
+  /// period of checking whether a client cancelled its blocks stream
+  constexpr std::chrono::milliseconds kCancellationCheckPeriod(500);
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
     QueryService::QueryService(
         std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
         std::shared_ptr<QueryFactoryType> query_factory,
+        std::shared_ptr<BlocksBroadcast> blocks_broadcast,
         logger::Logger log)
         : query_processor_{std::move(query_processor)},
           query_factory_{std::move(query_factory)},
+          blocks_broadcast_{std::move(blocks_broadcast)},
           log_{std::move(log)} {}
 
     void QueryService::Find(iroha::protocol::Query const &request,
@@ -77,51 +84,17 @@ namespace iroha {
               [this, context, request, writer](
                   const iroha::expected::Value<shared_model::proto::BlocksQuery>
                       &query) {
-                rxcpp::composite_subscription sub;
-                query_processor_->blocksQueryHandle(query.value)
-                    .as_blocking()
-                    .subscribe(
-                        sub,
-                        [this, context, &sub, request, writer](
-                            const std::shared_ptr<
-                                shared_model::interface::BlockQueryResponse>
-                                response) {
-                          if (context->IsCancelled()) {
-                            log_->debug("Unsubscribed");
-                            sub.unsubscribe();
-                          } else {
-                            iroha::visit_in_place(
-                                response->get(),
-                                [this, writer, request](
-                                    const shared_model::interface::BlockResponse
-                                        &block_response) {
-                                  log_->debug(
-                                      "{} receives committed block",
-                                      request->meta().creator_account_id());
-                                  auto proto_block_response = static_cast<
-                                      const shared_model::proto::BlockResponse
-                                          &>(block_response);
-                                  writer->Write(
-                                      proto_block_response.getTransport());
-                                },
-                                [this, writer, request](
-                                    const shared_model::interface::
-                                        BlockErrorResponse
-                                            &block_error_response) {
-                                  log_->debug(
-                                      "{} received error with message: {}",
-                                      request->meta().creator_account_id(),
-                                      block_error_response.message());
-                                  auto proto_block_error_response =
-                                      static_cast<const shared_model::proto::
-                                                      BlockErrorResponse &>(
-                                          block_error_response);
-                                  writer->WriteLast(
-                                      proto_block_error_response.getTransport(),
-                                      grpc::WriteOptions());
-                                });
-                          }
-                        });
+                if (auto error =
+                        query_processor_->validateBlocksQuery(query.value)) {
+                  log_->debug("{} may not fetch commits",
+                              request->meta().creator_account_id());
+                  const auto &proto_error = static_cast<
+                      const shared_model::proto::BlockQueryResponse &>(*error);
+                  writer->WriteLast(proto_error.getTransport(),
+                                    grpc::WriteOptions());
+                  return;
+                }
+                this->streamBlocks(context, *request, *writer);
               },
               [this, writer](const auto &error) {
                 log_->debug("Stateless invalid: {}", error.error);
@@ -134,5 +107,45 @@ namespace iroha {
       return grpc::Status::OK;
     }
 
+    void QueryService::streamBlocks(
+        grpc::ServerContext *context,
+        const iroha::protocol::BlocksQuery &request,
+        grpc::ServerWriter<iroha::protocol::BlockQueryResponse> &writer) {
+      const auto &creator = request.meta().creator_account_id();
+      auto subscriber = blocks_broadcast_->subscribe(request.start_height());
+
+      // the serialized block response is passed to the stream as is: an
+      // unknown field of the same number is written exactly like the field,
+      // so the block is not serialized again for every stream
+      iroha::protocol::BlockQueryResponse response;
+      auto unknown_fields =
+          response.GetReflection()->MutableUnknownFields(&response);
+      while (not context->IsCancelled()) {
+        if (auto block = subscriber->next(kCancellationCheckPeriod)) {
+          log_->debug(
+              "{} receives committed block {}", creator, (*block)->height);
+          unknown_fields->Clear();
+          unknown_fields->AddLengthDelimited(
+              iroha::protocol::BlockQueryResponse::kBlockResponseFieldNumber,
+              (*block)->block_response);
+          if (not writer.Write(response)) {
+            log_->debug("Stream of {} is closed", creator);
+            return;
+          }
+        } else if (subscriber->disconnected()) {
+          log_->warn("{} does not keep up with commits, disconnecting",
+                     creator);
+          iroha::protocol::BlockQueryResponse error_response;
+          error_response.mutable_block_error_response()->set_message(
+              "client does not keep up with commits");
+          writer.WriteLast(error_response, grpc::WriteOptions());
+          return;
+        } else if (subscriber->closed()) {
+          return;
+        }
+      }
+      log_->debug("Unsubscribed");
+    }
+
   }  // namespace torii
 }  // namespace iroha
@@ -0,0 +1,183 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/submitted_transactions_registry.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace torii {
+
+    SubmittedTransactionsRegistry::SubmittedTransactionsRegistry(
+        size_t max_connections, size_t max_per_connection)
+        : max_connections_(max_connections),
+          max_per_connection_(max_per_connection) {}
+
+    SubmittedTransactionsRegistry::StreamId
+    SubmittedTransactionsRegistry::attach(const std::string &connection) {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      const auto stream = next_stream_++;
+      streams_[connection].push_back(stream);
+      ++attached_;
+      auto it = connections_.find(connection);
+      if (it != connections_.end()) {
+        for (auto &submission : it->second.order) {
+          submission.streams.push_back(stream);
+        }
+      }
+      return stream;
+    }
+
+    void SubmittedTransactionsRegistry::detach(const std::string &connection,
+                                               StreamId stream) {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      auto streams = streams_.find(connection);
+      if (streams == streams_.end()) {
+        return;
+      }
+      auto position =
+          std::find(streams->second.begin(), streams->second.end(), stream);
+      if (position == streams->second.end()) {
+        return;
+      }
+      streams->second.erase(position);
+      --attached_;
+      if (streams->second.empty()) {
+        streams_.erase(streams);
+      }
+
+      auto it = connections_.find(connection);
+      if (it == connections_.end()) {
+        return;
+      }
+      // the connection is erased along with its last submission, so the end
+      // of the submissions is checked before the stream stops following it
+      auto &order = it->second.order;
+      for (auto submission = order.begin(); submission != order.end();) {
+        auto current = submission++;
+        const bool last = submission == order.end();
+        unfollow(it, current, stream);
+        if (last) {
+          break;
+        }
+      }
+    }
+
+    void SubmittedTransactionsRegistry::add(
+        const std::string &connection,
+        const std::vector<shared_model::crypto::Hash> &hashes) {
+      if (hashes.empty() or max_connections_ == 0 or max_per_connection_ == 0
+          or attached_ == 0) {
+        return;
+      }
+
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      auto streams = streams_.find(connection);
+      if (streams == streams_.end()) {
+        return;
+      }
+      auto it = connections_.find(connection);
+      if (it == connections_.end()) {
+        if (connections_.size() >= max_connections_) {
+          connections_.erase(connections_order_.front());
+          connections_order_.pop_front();
+        }
+        it = connections_.emplace(connection, Connection{}).first;
+        it->second.recency =
+            connections_order_.insert(connections_order_.end(), connection);
+      } else {
+        connections_order_.splice(
+            connections_order_.end(), connections_order_, it->second.recency);
+      }
+
+      auto &entry = it->second;
+      for (const auto &hash : hashes) {
+        if (entry.positions.count(hash) != 0) {
+          continue;
+        }
+        if (entry.order.size() >= max_per_connection_) {
+          entry.positions.erase(entry.order.front().hash);
+          entry.order.pop_front();
+        }
+        entry.positions.emplace(
+            hash,
+            entry.order.insert(entry.order.end(),
+                               Submission{hash, streams->second}));
+      }
+    }
+
+    std::vector<shared_model::crypto::Hash> SubmittedTransactionsRegistry::get(
+        const std::string &connection, StreamId stream) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      std::vector<shared_model::crypto::Hash> hashes;
+      auto it = connections_.find(connection);
+      if (it == connections_.end()) {
+        return hashes;
+      }
+      for (const auto &submission : it->second.order) {
+        if (std::find(
+                submission.streams.begin(), submission.streams.end(), stream)
+            != submission.streams.end()) {
+          hashes.push_back(submission.hash);
+        }
+      }
+      return hashes;
+    }
+
+    bool SubmittedTransactionsRegistry::contains(
+        const std::string &connection,
+        StreamId stream,
+        const shared_model::crypto::Hash &hash) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      auto it = connections_.find(connection);
+      if (it == connections_.end()) {
+        return false;
+      }
+      auto position = it->second.positions.find(hash);
+      if (position == it->second.positions.end()) {
+        return false;
+      }
+      const auto &streams = position->second->streams;
+      return std::find(streams.begin(), streams.end(), stream)
+          != streams.end();
+    }
+
+    void SubmittedTransactionsRegistry::remove(
+        const std::string &connection,
+        StreamId stream,
+        const shared_model::crypto::Hash &hash) {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      auto it = connections_.find(connection);
+      if (it == connections_.end()) {
+        return;
+      }
+      auto position = it->second.positions.find(hash);
+      if (position == it->second.positions.end()) {
+        return;
+      }
+      unfollow(it, position->second, stream);
+    }
+
+    void SubmittedTransactionsRegistry::unfollow(
+        ConnectionIterator connection,
+        std::list<Submission>::iterator submission,
+        StreamId stream) {
+      auto &streams = submission->streams;
+      streams.erase(std::remove(streams.begin(), streams.end(), stream),
+                    streams.end());
+      if (not streams.empty()) {
+        return;
+      }
+      auto &entry = connection->second;
+      entry.positions.erase(submission->hash);
+      entry.order.erase(submission);
+      if (entry.order.empty()) {
+        connections_order_.erase(entry.recency);
+        connections_.erase(connection);
+      }
+    }
+
+  }  // namespace torii
+}  // namespace iroha
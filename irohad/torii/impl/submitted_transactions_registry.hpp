@@ -0,0 +1,145 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_SUBMITTED_TRANSACTIONS_REGISTRY_HPP
+#define TORII_SUBMITTED_TRANSACTIONS_REGISTRY_HPP
+
+#include <atomic>
+#include <list>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cryptography/hash.hpp"
+
+namespace iroha {
+  namespace torii {
+    /**
+     * Remembers hashes of transactions submitted through each client
+     * connection, so that a status stream opened on the same connection can
+     * follow all of them without the client listing the hashes.
+     *
+     * Hashes are remembered only for connections with an attached status
+     * stream, so submissions of other connections cost one atomic load. Every
+     * attached stream of a connection follows the hashes on its own, and a
+     * hash is forgotten when no stream of its connection follows it anymore.
+     * Memory is bounded: every connection keeps at most max_per_connection
+     * most recent hashes, and at most max_connections most recently active
+     * connections are kept. The class is thread-safe.
+     */
+    class SubmittedTransactionsRegistry {
+     public:
+      /// identifier of an attached status stream
+      using StreamId = uint64_t;
+
+      SubmittedTransactionsRegistry(size_t max_connections,
+                                    size_t max_per_connection);
+
+      /**
+       * Start remembering hashes submitted through the connection. The
+       * stream follows the hashes, which are already remembered for the
+       * connection, as well.
+       * @param connection - client connection identifier
+       * @return identifier of the attached stream
+       */
+      StreamId attach(const std::string &connection);
+
+      /**
+       * Stop following hashes by the stream. Hashes, which no other stream
+       * follows, are forgotten, and when the last status stream of the
+       * connection is detached, its hashes are not remembered anymore
+       * @param connection - client connection identifier
+       * @param stream - identifier returned by attach
+       */
+      void detach(const std::string &connection, StreamId stream);
+
+      /**
+       * Remember hashes submitted through the connection, if a status stream
+       * is attached to it. They are followed by all the attached streams.
+       * @param connection - client connection identifier
+       * @param hashes - submitted transaction hashes
+       */
+      void add(const std::string &connection,
+               const std::vector<shared_model::crypto::Hash> &hashes);
+
+      /**
+       * @param connection - client connection identifier
+       * @param stream - identifier returned by attach
+       * @return hashes followed by the stream, oldest first
+       */
+      std::vector<shared_model::crypto::Hash> get(const std::string &connection,
+                                                  StreamId stream) const;
+
+      /**
+       * @param connection - client connection identifier
+       * @param stream - identifier returned by attach
+       * @param hash - transaction hash
+       * @return true if the hash was submitted through the connection and is
+       * followed by the stream
+       */
+      bool contains(const std::string &connection,
+                    StreamId stream,
+                    const shared_model::crypto::Hash &hash) const;
+
+      /**
+       * Stop following the hash by the stream, e.g. when its final status
+       * was delivered. The hash is forgotten, when no other stream follows it
+       * @param connection - client connection identifier
+       * @param stream - identifier returned by attach
+       * @param hash - transaction hash
+       */
+      void remove(const std::string &connection,
+                  StreamId stream,
+                  const shared_model::crypto::Hash &hash);
+
+     private:
+      struct Submission {
+        shared_model::crypto::Hash hash;
+        /// attached streams, which follow the hash
+        std::vector<StreamId> streams;
+      };
+
+      struct Connection {
+        /// hashes in submission order
+        std::list<Submission> order;
+        std::unordered_map<shared_model::crypto::Hash,
+                           std::list<Submission>::iterator,
+                           shared_model::crypto::Hash::Hasher>
+            positions;
+        /// position in connections_order_
+        std::list<std::string>::iterator recency;
+      };
+
+      using ConnectionIterator =
+          std::unordered_map<std::string, Connection>::iterator;
+
+      /**
+       * Stop following the hash by the stream, and forget the hash and then
+       * the connection, if nothing follows them
+       * Note: method requires the exclusive lock
+       */
+      void unfollow(ConnectionIterator connection,
+                    std::list<Submission>::iterator submission,
+                    StreamId stream);
+
+      const size_t max_connections_;
+      const size_t max_per_connection_;
+
+      /// status lookups of the streams take the lock for reading
+      mutable std::shared_timed_mutex mutex_;
+      StreamId next_stream_ = 0;
+      /// attached status streams of every connection
+      std::unordered_map<std::string, std::vector<StreamId>> streams_;
+      /// total number of attached status streams
+      std::atomic<size_t> attached_{0};
+      std::unordered_map<std::string, Connection> connections_;
+      /// connections from the least to the most recently active
+      std::list<std::string> connections_order_;
+    };
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_SUBMITTED_TRANSACTIONS_REGISTRY_HPP
@@ -0,0 +1,135 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/transaction_intake.hpp"
+
+#include <algorithm>
+
+#include "torii/command_service.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    TransactionIntake::TransactionIntake(
+        std::shared_ptr<CommandService> command_service,
+        size_t capacity,
+        size_t workers,
+        logger::Logger log)
+        : command_service_(std::move(command_service)),
+          capacity_(std::max<size_t>(capacity, 1)),
+          log_(std::move(log)),
+          queue_(capacity_),
+          occupancy_(0),
+          max_occupancy_(0),
+          queued_(0),
+          accepted_(0),
+          rejected_(0),
+          handled_in_place_(0),
+          idle_workers_(0),
+          stopped_(false) {
+      workers = std::max<size_t>(workers, 1);
+      workers_.reserve(workers);
+      for (size_t i = 0; i < workers; ++i) {
+        workers_.emplace_back([this] { this->work(); });
+      }
+    }
+
+    TransactionIntake::~TransactionIntake() {
+      {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        stopped_ = true;
+      }
+      wait_cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+    }
+
+    bool TransactionIntake::push(std::vector<BatchPtr> batches) {
+      const auto count = batches.size();
+      if (count == 0) {
+        return true;
+      }
+      if (count > capacity_) {
+        log_->debug("{} batches exceed the intake, handling them in place",
+                    count);
+        accepted_ += count;
+        handled_in_place_ += count;
+        for (auto &batch : batches) {
+          command_service_->handleTransactionBatch(std::move(batch));
+        }
+        return true;
+      }
+
+      // reserve room for all the batches first, so that the queue is never
+      // full when they are pushed
+      const auto occupancy = occupancy_.fetch_add(count) + count;
+      if (occupancy > capacity_) {
+        occupancy_.fetch_sub(count);
+        rejected_ += count;
+        log_->warn("Intake is full, {} batches are rejected", count);
+        return false;
+      }
+      auto max_occupancy = max_occupancy_.load();
+      while (max_occupancy < occupancy
+             and not max_occupancy_.compare_exchange_weak(max_occupancy,
+                                                          occupancy)) {
+      }
+
+      for (auto &batch : batches) {
+        // counted before it is pushed, so that the counter never goes below
+        // zero when a worker takes the batch right away
+        ++queued_;
+        queue_.tryPush(std::move(batch));
+      }
+      accepted_ += count;
+
+      if (idle_workers_ > 0) {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        wait_cv_.notify_all();
+      }
+      return true;
+    }
+
+    TransactionIntake::Metrics TransactionIntake::metrics() const {
+      return Metrics{capacity_,
+                     occupancy_,
+                     max_occupancy_,
+                     accepted_,
+                     rejected_,
+                     handled_in_place_};
+    }
+
+    void TransactionIntake::work() {
+      while (true) {
+        if (auto batch = queue_.tryPop()) {
+          --queued_;
+          command_service_->handleTransactionBatch(std::move(*batch));
+          // the room is released only when the batch is handled, so the
+          // occupancy bounds the work in progress as well
+          --occupancy_;
+          continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        if (queued_ > 0) {
+          // being pushed, or taken by another worker, which has not updated
+          // the counter yet
+          continue;
+        }
+        if (stopped_) {
+          return;
+        }
+        ++idle_workers_;
+        // batches are counted before a producer checks for idle workers, so
+        // either the producer sees this worker idle and notifies it, or the
+        // worker sees the batches
+        wait_cv_.wait(lock, [this] { return stopped_ or queued_ > 0; });
+        --idle_workers_;
+      }
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -0,0 +1,119 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_TRANSACTION_INTAKE_HPP
+#define TORII_TRANSACTION_INTAKE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/bounded_mpmc_queue.hpp"
+#include "logger/logger.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class TransactionBatch;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace torii {
+    class CommandService;
+
+    /**
+     * Intake stage between gRPC handlers and the command service.
+     *
+     * Handlers only enqueue stateless valid batches, while dedicated workers
+     * pass them to the command service, which looks up the caches, publishes
+     * statuses and propagates the batches. The number of batches which are
+     * queued or being handled is bounded, and a request which does not fit is
+     * rejected as a whole, so that clients can back off. A request with more
+     * batches than the capacity would never fit, so it is handled by the
+     * calling thread instead, which delays only the client that sent it.
+     */
+    class TransactionIntake {
+     public:
+      using BatchPtr =
+          std::shared_ptr<shared_model::interface::TransactionBatch>;
+
+      /// occupancy and admission counters of the intake
+      struct Metrics {
+        /// maximum number of batches, which are queued or being handled
+        size_t capacity;
+        /// number of batches, which are queued or being handled
+        size_t occupancy;
+        /// the highest occupancy since the start
+        size_t max_occupancy;
+        /// number of admitted batches
+        uint64_t accepted;
+        /// number of batches rejected for the lack of room
+        uint64_t rejected;
+        /// number of admitted batches of requests larger than the capacity,
+        /// which were handled by the calling thread
+        uint64_t handled_in_place;
+      };
+
+      /**
+       * @param command_service - handler of the admitted batches
+       * @param capacity - maximum number of batches, which are queued or
+       * being handled
+       * @param workers - number of threads handling the batches, at least one
+       * @param log to print progress
+       */
+      TransactionIntake(
+          std::shared_ptr<CommandService> command_service,
+          size_t capacity,
+          size_t workers,
+          logger::Logger log = logger::log("TransactionIntake"));
+
+      /// handles all the admitted batches and stops the workers
+      ~TransactionIntake();
+
+      TransactionIntake(const TransactionIntake &) = delete;
+      TransactionIntake &operator=(const TransactionIntake &) = delete;
+
+      /**
+       * Admit batches of one request, either all of them or none. Batches of
+       * a request larger than the capacity are handled before return
+       * @param batches - batches to handle
+       * @return false if there is not enough room for the batches
+       */
+      bool push(std::vector<BatchPtr> batches);
+
+      /// @return current counters
+      Metrics metrics() const;
+
+     private:
+      void work();
+
+      std::shared_ptr<CommandService> command_service_;
+      const size_t capacity_;
+      logger::Logger log_;
+
+      BoundedMpmcQueue<BatchPtr> queue_;
+      std::atomic<size_t> occupancy_;
+      std::atomic<size_t> max_occupancy_;
+      /// number of batches in the queue
+      std::atomic<size_t> queued_;
+      std::atomic<uint64_t> accepted_;
+      std::atomic<uint64_t> rejected_;
+      std::atomic<uint64_t> handled_in_place_;
+
+      // idle workers sleep until a batch is admitted
+      std::atomic<size_t> idle_workers_;
+      std::atomic<bool> stopped_;
+      std::mutex wait_mutex_;
+      std::condition_variable wait_cv_;
+      std::vector<std::thread> workers_;
+    };
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_TRANSACTION_INTAKE_HPP
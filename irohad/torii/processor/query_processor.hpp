@@ -6,8 +6,6 @@
 #ifndef IROHA_QUERY_PROCESSOR_HPP
 #define IROHA_QUERY_PROCESSOR_HPP
 
-#include <rxcpp/rx.hpp>
-
 #include <memory>
 
 namespace shared_model {
@@ -35,13 +33,12 @@ namespace iroha {
       virtual std::unique_ptr<shared_model::interface::QueryResponse>
       queryHandle(const shared_model::interface::Query &qry) = 0;
       /**
-       * Register client blocks query
-       * @param query - client intent
-       * @return observable with block query responses
+       * Check that the client may fetch committed blocks
+       * @param qry - client intent
+       * @return error response, or nullptr if the query is valid
        */
-      virtual rxcpp::observable<
-          std::shared_ptr<shared_model::interface::BlockQueryResponse>>
-      blocksQueryHandle(const shared_model::interface::BlocksQuery &qry) = 0;
+      virtual std::unique_ptr<shared_model::interface::BlockQueryResponse>
+      validateBlocksQuery(const shared_model::interface::BlocksQuery &qry) = 0;
 
       virtual ~QueryProcessor(){};
     };
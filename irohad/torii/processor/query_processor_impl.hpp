@@ -6,7 +6,7 @@
 #ifndef IROHA_QUERY_PROCESSOR_IMPL_HPP
 #define IROHA_QUERY_PROCESSOR_IMPL_HPP
 
-#include "ametsuchi/storage.hpp"
+#include "ametsuchi/query_executor_factory.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "logger/logger.hpp"
 #include "torii/processor/query_processor.hpp"
@@ -20,7 +20,6 @@ namespace iroha {
     class QueryProcessorImpl : public QueryProcessor {
      public:
       QueryProcessorImpl(
-          std::shared_ptr<ametsuchi::Storage> storage,
           std::shared_ptr<ametsuchi::QueryExecutorFactory> qry_exec,
           std::shared_ptr<iroha::PendingTransactionStorage>
               pending_transactions,
@@ -31,16 +30,11 @@ namespace iroha {
       std::unique_ptr<shared_model::interface::QueryResponse> queryHandle(
           const shared_model::interface::Query &qry) override;
 
-      rxcpp::observable<
-          std::shared_ptr<shared_model::interface::BlockQueryResponse>>
-      blocksQueryHandle(
+      std::unique_ptr<shared_model::interface::BlockQueryResponse>
+      validateBlocksQuery(
           const shared_model::interface::BlocksQuery &qry) override;
 
      private:
-      rxcpp::subjects::subject<
-          std::shared_ptr<shared_model::interface::BlockQueryResponse>>
-          blocks_query_subject_;
-      std::shared_ptr<ametsuchi::Storage> storage_;
       std::shared_ptr<ametsuchi::QueryExecutorFactory> qry_exec_;
       std::shared_ptr<iroha::PendingTransactionStorage> pending_transactions_;
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
@@ -15,6 +15,7 @@
 #include "backend/protobuf/queries/proto_query.hpp"
 #include "builders/protobuf/transport_builder.hpp"
 #include "cache/cache.hpp"
+#include "torii/impl/blocks_broadcast.hpp"
 #include "torii/processor/query_processor.hpp"
 
 #include "logger/logger.hpp"
@@ -43,6 +44,7 @@ namespace iroha {
       QueryService(
           std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
           std::shared_ptr<QueryFactoryType> query_factory,
+          std::shared_ptr<BlocksBroadcast> blocks_broadcast,
           logger::Logger log = logger::log("Query Service"));
 
       QueryService(const QueryService &) = delete;
@@ -67,8 +69,18 @@ namespace iroha {
           override;
 
      private:
+      /**
+       * Write committed blocks to the stream until the client cancels it or
+       * the blocks are over
+       */
+      void streamBlocks(
+          grpc::ServerContext *context,
+          const iroha::protocol::BlocksQuery &request,
+          grpc::ServerWriter<iroha::protocol::BlockQueryResponse> &writer);
+
       std::shared_ptr<iroha::torii::QueryProcessor> query_processor_;
       std::shared_ptr<QueryFactoryType> query_factory_;
+      std::shared_ptr<BlocksBroadcast> blocks_broadcast_;
 
       // TODO 18.02.2019 lebdron: IR-336 Replace cache
       iroha::cache::Cache<shared_model::crypto::Hash,
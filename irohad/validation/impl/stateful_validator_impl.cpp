@@ -5,6 +5,11 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <numeric>
 #include <string>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
@@ -14,6 +19,7 @@
 #include <boost/range/adaptor/transformed.hpp>
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
+#include "validation/impl/transaction_access.hpp"
 #include "validation/utils.hpp"
 
 namespace iroha {
@@ -40,6 +46,292 @@ namespace iroha {
           });
     };
 
+    /// result of validation of a batch
+    struct BatchOutcome {
+      /// whether each transaction of the batch passed validation
+      std::vector<bool> valid;
+      /// errors of transactions of the batch, in validation order
+      validation::TransactionsErrors errors;
+    };
+
+    /**
+     * Validate the batch; includes special rules for atomic batches
+     * @param batch to be validated
+     * @param temporary_wsv to apply transactions on
+     * @return which transactions of the batch passed validation and their
+     * errors
+     */
+    static BatchOutcome validateBatch(
+        const shared_model::interface::types::TransactionsCollectionType
+            &batch,
+        ametsuchi::TemporaryWsv &temporary_wsv) {
+      BatchOutcome outcome;
+      auto validation = [&](auto &tx) {
+        return checkTransactions(temporary_wsv, outcome.errors, tx);
+      };
+      if (batch.front().batchMeta()
+          and batch.front().batchMeta()->get()->type()
+              == shared_model::interface::types::BatchType::ATOMIC) {
+        // check all batch's transactions for validness
+        auto savepoint = temporary_wsv.createSavepoint(
+            "batch_" + batch.front().hash().hex());
+
+        bool validation_result = boost::algorithm::all_of(batch, validation);
+        outcome.valid.assign(boost::size(batch), validation_result);
+        if (validation_result) {
+          // batch is successful; release savepoint
+          savepoint->release();
+        } else {
+          auto failed_tx_hash = outcome.errors.back().tx_hash;
+          for (const auto &tx : batch) {
+            if (tx.hash() != failed_tx_hash) {
+              outcome.errors.emplace_back(validation::TransactionError{
+                  tx.hash(),
+                  // TODO igor-egorov 22.01.2019 IR-245 add a separate
+                  // error code for failed batch case
+                  validation::CommandError{
+                      "",
+                      1,  // internal error code
+                      "Another transaction failed the batch",
+                      true,
+                      std::numeric_limits<size_t>::max()}});
+            }
+          }
+        }
+      } else {
+        for (const auto &tx : batch) {
+          outcome.valid.push_back(validation(tx));
+        }
+      }
+      return outcome;
+    }
+
+    /**
+     * Apply transactions of the batch which passed validation on another
+     * temporary wsv with the same state of the batch's access set
+     * @return true if all of them were applied
+     */
+    static bool replayBatch(
+        const shared_model::interface::types::TransactionsCollectionType
+            &batch,
+        const BatchOutcome &outcome,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        const logger::Logger &log) {
+      if (std::none_of(outcome.valid.begin(),
+                       outcome.valid.end(),
+                       [](bool valid) { return valid; })) {
+        return true;
+      }
+      auto savepoint =
+          temporary_wsv.createSavepoint("batch_" + batch.front().hash().hex());
+      size_t i = 0;
+      for (const auto &tx : batch) {
+        if (not outcome.valid.at(i++)) {
+          continue;
+        }
+        auto applied = temporary_wsv.apply(tx).match(
+            [](expected::Value<void> &) { return true; },
+            [&tx, &log](expected::Error<validation::CommandError> &error) {
+              log->error("replay of validated transaction {} failed: {}",
+                         tx.hash().hex(),
+                         error.error.error_extra);
+              return false;
+            });
+        if (not applied) {
+          return false;
+        }
+      }
+      savepoint->release();
+      return true;
+    }
+
+    /**
+     * Validate batches one after another on the temporary wsv
+     */
+    static std::vector<BatchOutcome> validateBatchesSequentially(
+        const std::vector<
+            shared_model::interface::types::TransactionsCollectionType>
+            &batches,
+        ametsuchi::TemporaryWsv &temporary_wsv) {
+      temporary_wsv.prefetch(batches);
+      std::vector<BatchOutcome> outcomes;
+      outcomes.reserve(batches.size());
+      for (const auto &batch : batches) {
+        outcomes.push_back(validateBatch(batch, temporary_wsv));
+      }
+      return outcomes;
+    }
+
+    /**
+     * Indices of workers which have finished, in order of completion
+     */
+    class FinishedWorkers {
+     public:
+      /// adds the worker on destruction, even if the worker has thrown
+      class Guard {
+       public:
+        Guard(FinishedWorkers &finished, size_t worker)
+            : finished_(finished), worker_(worker) {}
+
+        ~Guard() {
+          finished_.push(worker_);
+        }
+
+       private:
+        FinishedWorkers &finished_;
+        size_t worker_;
+      };
+
+      void push(size_t worker) {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          workers_.push_back(worker);
+        }
+        cv_.notify_one();
+      }
+
+      /// waits until a worker finishes and returns its index
+      size_t pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return not workers_.empty(); });
+        auto worker = workers_.front();
+        workers_.pop_front();
+        return worker;
+      }
+
+     private:
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      std::deque<size_t> workers_;
+    };
+
+    /**
+     * Validate independent groups of batches concurrently: the first worker
+     * uses the given temporary wsv, the other ones use temporary wsvs of their
+     * own. Changes of other workers are then merged into the given temporary
+     * wsv, or their accepted batches are applied to it again, so it ends up in
+     * the same state as after sequential validation.
+     * Workers are collected in order of completion and each worker wsv is
+     * destroyed right after it is merged. A worker wsv holds a database
+     * session from a bounded pool, so a worker which waits for a session is
+     * never blocked by finished workers holding theirs.
+     */
+    static std::vector<BatchOutcome> validateBatchesInParallel(
+        const std::vector<
+            shared_model::interface::types::TransactionsCollectionType>
+            &batches,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        ametsuchi::TemporaryFactory &worker_wsv_factory,
+        size_t max_workers,
+        const logger::Logger &log) {
+      std::vector<AccessSet> accesses;
+      accesses.reserve(batches.size());
+      for (const auto &batch : batches) {
+        AccessSet access;
+        for (const auto &tx : batch) {
+          access.merge(accessSetOf(tx));
+        }
+        accesses.push_back(std::move(access));
+      }
+      auto groups = independentGroups(accesses);
+      const size_t groups_count = groups.empty()
+          ? 0
+          : *std::max_element(groups.begin(), groups.end()) + 1;
+      const size_t workers_count = std::min(max_workers, groups_count);
+      if (workers_count < 2) {
+        return validateBatchesSequentially(batches, temporary_wsv);
+      }
+
+      // the largest groups are assigned first to balance transactions
+      std::vector<size_t> group_sizes(groups_count);
+      for (size_t i = 0; i < batches.size(); ++i) {
+        group_sizes[groups[i]] += boost::size(batches[i]);
+      }
+      std::vector<size_t> groups_by_size(groups_count);
+      std::iota(groups_by_size.begin(), groups_by_size.end(), 0);
+      std::stable_sort(groups_by_size.begin(),
+                       groups_by_size.end(),
+                       [&group_sizes](auto lhs, auto rhs) {
+                         return group_sizes[lhs] > group_sizes[rhs];
+                       });
+      std::vector<size_t> worker_of_group(groups_count);
+      std::vector<size_t> worker_loads(workers_count);
+      for (auto group : groups_by_size) {
+        auto worker = std::distance(
+            worker_loads.begin(),
+            std::min_element(worker_loads.begin(), worker_loads.end()));
+        worker_of_group[group] = worker;
+        worker_loads[worker] += group_sizes[group];
+      }
+      auto worker_of_batch = [&](size_t batch) {
+        return worker_of_group[groups[batch]];
+      };
+
+      std::vector<BatchOutcome> outcomes(batches.size());
+      // each worker writes outcomes of its own batches only
+      auto run_worker = [&](size_t worker, ametsuchi::TemporaryWsv &wsv) {
+        std::vector<shared_model::interface::types::TransactionsCollectionType>
+            worker_batches;
+        for (size_t i = 0; i < batches.size(); ++i) {
+          if (worker_of_batch(i) == worker) {
+            worker_batches.push_back(batches[i]);
+          }
+        }
+        wsv.prefetch(worker_batches);
+        for (size_t i = 0; i < batches.size(); ++i) {
+          if (worker_of_batch(i) == worker) {
+            outcomes[i] = validateBatch(batches[i], wsv);
+          }
+        }
+      };
+
+      FinishedWorkers finished;
+      std::vector<std::future<std::unique_ptr<ametsuchi::TemporaryWsv>>>
+          workers;
+      for (size_t worker = 1; worker < workers_count; ++worker) {
+        workers.push_back(std::async(std::launch::async, [&, worker] {
+          FinishedWorkers::Guard guard(finished, worker);
+          return worker_wsv_factory.createTemporaryWsv().match(
+              [&](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
+                      &wsv) {
+                run_worker(worker, *wsv.value);
+                return std::move(wsv.value);
+              },
+              [&](expected::Error<std::string> &error) {
+                log->warn("failed to create worker temporary wsv: {}",
+                          error.error);
+                return std::unique_ptr<ametsuchi::TemporaryWsv>{};
+              });
+        }));
+      }
+      run_worker(0, temporary_wsv);
+
+      // changes of a worker are taken over as they are if the temporary wsv
+      // supports it; otherwise the worker wsv is dropped before its batches
+      // are applied again, so its locks do not block the replay
+      std::vector<bool> worker_succeeded(workers_count, true),
+          worker_merged(workers_count, true);
+      for (size_t collected = 0; collected < workers.size(); ++collected) {
+        auto worker = finished.pop();
+        auto worker_wsv = workers[worker - 1].get();
+        worker_succeeded[worker] = static_cast<bool>(worker_wsv);
+        worker_merged[worker] =
+            worker_wsv and temporary_wsv.merge(*worker_wsv);
+      }
+
+      for (size_t i = 0; i < batches.size(); ++i) {
+        auto worker = worker_of_batch(i);
+        if (worker_merged[worker]) {
+          continue;
+        }
+        if (not worker_succeeded[worker]
+            or not replayBatch(batches[i], outcomes[i], temporary_wsv, log)) {
+          outcomes[i] = validateBatch(batches[i], temporary_wsv);
+        }
+      }
+      return outcomes;
+    }
+
     /**
      * Validate all transactions supplied; includes special rules, such as batch
      * validation etc
@@ -48,6 +340,9 @@ namespace iroha {
      * @param transactions_errors_log to write errors to
      * @param log to write errors to console
      * @param batch_parser to parse batches from transaction range
+     * @param worker_wsv_factory to create temporary wsvs for concurrent
+     * validation, null to validate sequentially
+     * @param max_workers - maximal number of concurrently validated groups
      * @return range of transactions, which passed stateful validation
      */
     static auto validateTransactions(
@@ -55,52 +350,28 @@ namespace iroha {
         ametsuchi::TemporaryWsv &temporary_wsv,
         validation::TransactionsErrors &transactions_errors_log,
         const logger::Logger &log,
-        const shared_model::interface::TransactionBatchParser &batch_parser) {
+        const shared_model::interface::TransactionBatchParser &batch_parser,
+        ametsuchi::TemporaryFactory *worker_wsv_factory,
+        size_t max_workers) {
+      auto batches = batch_parser.parseBatches(txs);
+      auto outcomes = worker_wsv_factory and max_workers > 1
+          ? validateBatchesInParallel(batches,
+                                      temporary_wsv,
+                                      *worker_wsv_factory,
+                                      max_workers,
+                                      log)
+          : validateBatchesSequentially(batches, temporary_wsv);
+
       std::vector<bool> validation_results;
       validation_results.reserve(boost::size(txs));
-
-      for (auto batch : batch_parser.parseBatches(txs)) {
-        auto validation = [&](auto &tx) {
-          return checkTransactions(temporary_wsv, transactions_errors_log, tx);
-        };
-        if (batch.front().batchMeta()
-            and batch.front().batchMeta()->get()->type()
-                == shared_model::interface::types::BatchType::ATOMIC) {
-          // check all batch's transactions for validness
-          auto savepoint = temporary_wsv.createSavepoint(
-              "batch_" + batch.front().hash().hex());
-          bool validation_result = false;
-
-          if (boost::algorithm::all_of(batch, validation)) {
-            // batch is successful; release savepoint
-            validation_result = true;
-            savepoint->release();
-          } else {
-            auto failed_tx_hash = transactions_errors_log.back().tx_hash;
-            for (const auto &tx : batch) {
-              if (tx.hash() != failed_tx_hash) {
-                transactions_errors_log.emplace_back(
-                    validation::TransactionError{
-                        tx.hash(),
-                        // TODO igor-egorov 22.01.2019 IR-245 add a separate
-                        // error code for failed batch case
-                        validation::CommandError{
-                            "",
-                            1,  // internal error code
-                            "Another transaction failed the batch",
-                            true,
-                            std::numeric_limits<size_t>::max()}});
-              }
-            }
-          }
-
-          validation_results.insert(
-              validation_results.end(), boost::size(batch), validation_result);
-        } else {
-          for (const auto &tx : batch) {
-            validation_results.push_back(validation(tx));
-          }
-        }
+      for (size_t i = 0; i < batches.size(); ++i) {
+        auto &outcome = outcomes[i];
+        std::move(outcome.errors.begin(),
+                  outcome.errors.end(),
+                  std::back_inserter(transactions_errors_log));
+        validation_results.insert(validation_results.end(),
+                                  outcome.valid.begin(),
+                                  outcome.valid.end());
       }
 
       return txs | boost::adaptors::indexed()
@@ -117,9 +388,13 @@ namespace iroha {
         std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory,
         std::shared_ptr<shared_model::interface::TransactionBatchParser>
             batch_parser,
+        std::shared_ptr<ametsuchi::TemporaryFactory> worker_wsv_factory,
+        size_t max_workers,
         logger::Logger log)
         : factory_(std::move(factory)),
           batch_parser_(std::move(batch_parser)),
+          worker_wsv_factory_(std::move(worker_wsv_factory)),
+          max_workers_(max_workers),
           log_(std::move(log)) {}
 
     std::unique_ptr<validation::VerifiedProposalAndErrors>
@@ -135,7 +410,9 @@ namespace iroha {
                                temporaryWsv,
                                validation_result->rejected_transactions,
                                log_,
-                               *batch_parser_);
+                               *batch_parser_,
+                               worker_wsv_factory_.get(),
+                               max_workers_);
 
       // Since proposal came from ordering gate it was already validated.
       // All transactions are validated as well
@@ -8,6 +8,7 @@
 
 #include "validation/stateful_validator.hpp"
 
+#include "ametsuchi/temporary_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger.hpp"
@@ -20,11 +21,21 @@ namespace iroha {
      */
     class StatefulValidatorImpl : public StatefulValidator {
      public:
+      /**
+       * @param worker_wsv_factory - source of additional temporary wsvs, on
+       * which batches that do not conflict with each other are validated
+       * concurrently; null to validate all batches on the given temporary wsv
+       * @param max_workers - maximal number of temporary wsvs used for a
+       * proposal, including the given one
+       */
       StatefulValidatorImpl(
           std::unique_ptr<shared_model::interface::UnsafeProposalFactory>
               factory,
           std::shared_ptr<shared_model::interface::TransactionBatchParser>
               batch_parser,
+          std::shared_ptr<ametsuchi::TemporaryFactory> worker_wsv_factory =
+              nullptr,
+          size_t max_workers = 1,
           logger::Logger log = logger::log("SFV"));
 
       std::unique_ptr<validation::VerifiedProposalAndErrors> validate(
@@ -35,6 +46,8 @@ namespace iroha {
       std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory_;
       std::shared_ptr<shared_model::interface::TransactionBatchParser>
           batch_parser_;
+      std::shared_ptr<ametsuchi::TemporaryFactory> worker_wsv_factory_;
+      size_t max_workers_;
       logger::Logger log_;
     };
 
@@ -0,0 +1,270 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/transaction_access.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  using namespace shared_model::interface;
+
+  std::string accountKey(const std::string &account_id) {
+    return "account/" + account_id;
+  }
+
+  std::string assetKey(const std::string &asset_id) {
+    return "asset/" + asset_id;
+  }
+
+  std::string domainKey(const std::string &domain_id) {
+    return "domain/" + domain_id;
+  }
+
+  std::string roleKey(const std::string &role_id) {
+    return "role/" + role_id;
+  }
+
+  std::string signatoryKey(const std::string &public_key_hex) {
+    return "signatory/" + public_key_hex;
+  }
+
+  /// peers are checked for unique addresses, so they share a single key
+  const std::string kPeersKey = "peers";
+
+  /**
+   * Adds keys accessed by a command to the access set. Permissions of the
+   * creator are read from its account, which is read by every transaction.
+   */
+  class AccessVisitor : public boost::static_visitor<> {
+   public:
+    AccessVisitor(iroha::validation::AccessSet &access,
+                  const std::string &creator)
+        : access_(access), creator_(creator) {}
+
+    void operator()(const AddAssetQuantity &command) {
+      write(accountKey(creator_));
+      read(assetKey(command.assetId()));
+    }
+
+    void operator()(const AddPeer &) {
+      write(kPeersKey);
+    }
+
+    void operator()(const AddSignatory &command) {
+      write(accountKey(command.accountId()));
+      write(signatoryKey(command.pubkey().hex()));
+    }
+
+    void operator()(const AppendRole &command) {
+      write(accountKey(command.accountId()));
+      read(roleKey(command.roleName()));
+    }
+
+    void operator()(const CreateAccount &command) {
+      write(accountKey(command.accountName() + "@" + command.domainId()));
+      write(signatoryKey(command.pubkey().hex()));
+      // the domain provides the default role
+      read(domainKey(command.domainId()));
+    }
+
+    void operator()(const CreateAsset &command) {
+      write(assetKey(command.assetName() + "#" + command.domainId()));
+      read(domainKey(command.domainId()));
+    }
+
+    void operator()(const CreateDomain &command) {
+      write(domainKey(command.domainId()));
+      read(roleKey(command.userDefaultRole()));
+    }
+
+    void operator()(const CreateRole &command) {
+      write(roleKey(command.roleName()));
+    }
+
+    void operator()(const DetachRole &command) {
+      write(accountKey(command.accountId()));
+      read(roleKey(command.roleName()));
+    }
+
+    void operator()(const GrantPermission &command) {
+      // permissions granted by an account are stored with the account
+      write(accountKey(creator_));
+      read(accountKey(command.accountId()));
+    }
+
+    void operator()(const RemoveSignatory &command) {
+      write(accountKey(command.accountId()));
+      write(signatoryKey(command.pubkey().hex()));
+    }
+
+    void operator()(const RevokePermission &command) {
+      write(accountKey(creator_));
+      read(accountKey(command.accountId()));
+    }
+
+    void operator()(const SetAccountDetail &command) {
+      write(accountKey(command.accountId()));
+    }
+
+    void operator()(const SetQuorum &command) {
+      write(accountKey(command.accountId()));
+    }
+
+    void operator()(const SubtractAssetQuantity &command) {
+      write(accountKey(creator_));
+      read(assetKey(command.assetId()));
+    }
+
+    void operator()(const TransferAsset &command) {
+      write(accountKey(command.srcAccountId()));
+      write(accountKey(command.destAccountId()));
+      read(assetKey(command.assetId()));
+    }
+
+   private:
+    void read(std::string key) {
+      access_.reads.insert(std::move(key));
+    }
+
+    void write(std::string key) {
+      access_.writes.insert(std::move(key));
+    }
+
+    iroha::validation::AccessSet &access_;
+    const std::string &creator_;
+  };
+
+  /// disjoint set of units with the smallest unit as a representative
+  class UnitSets {
+   public:
+    explicit UnitSets(size_t size) : parent_(size) {
+      std::iota(parent_.begin(), parent_.end(), 0);
+    }
+
+    size_t find(size_t unit) {
+      while (parent_[unit] != unit) {
+        parent_[unit] = parent_[parent_[unit]];
+        unit = parent_[unit];
+      }
+      return unit;
+    }
+
+    void unite(size_t a, size_t b) {
+      auto root_a = find(a);
+      auto root_b = find(b);
+      if (root_a < root_b) {
+        parent_[root_b] = root_a;
+      } else {
+        parent_[root_a] = root_b;
+      }
+    }
+
+   private:
+    std::vector<size_t> parent_;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace validation {
+
+    void AccessSet::merge(const AccessSet &other) {
+      reads.insert(other.reads.begin(), other.reads.end());
+      writes.insert(other.writes.begin(), other.writes.end());
+    }
+
+    bool AccessSet::conflictsWith(const AccessSet &other) const {
+      auto writes_any = [](const AccessSet &writer, const AccessSet &target) {
+        return std::any_of(
+            writer.writes.begin(),
+            writer.writes.end(),
+            [&target](const auto &key) {
+              return target.writes.count(key) or target.reads.count(key);
+            });
+      };
+      return writes_any(*this, other) or writes_any(other, *this);
+    }
+
+    AccessSet accessSetOf(const shared_model::interface::Transaction &tx) {
+      AccessSet access;
+      // signatories, quorum and permissions of the creator
+      access.reads.insert(accountKey(tx.creatorAccountId()));
+      AccessVisitor visitor(access, tx.creatorAccountId());
+      for (const auto &command : tx.commands()) {
+        boost::apply_visitor(visitor, command.get());
+      }
+      return access;
+    }
+
+    std::vector<size_t> independentGroups(const std::vector<AccessSet> &units) {
+      struct KeyAccess {
+        boost::optional<size_t> last_writer;
+        std::vector<size_t> readers_since_write;
+      };
+      std::unordered_map<std::string, KeyAccess> keys;
+      UnitSets sets(units.size());
+
+      // every writer of a key is united with all previous accessors of it, so
+      // it is enough to remember the last writer and the following readers
+      for (size_t unit = 0; unit < units.size(); ++unit) {
+        for (const auto &key : units[unit].writes) {
+          auto &access = keys[key];
+          if (access.last_writer) {
+            sets.unite(unit, *access.last_writer);
+          }
+          for (auto reader : access.readers_since_write) {
+            sets.unite(unit, reader);
+          }
+          access.readers_since_write.clear();
+          access.last_writer = unit;
+        }
+        for (const auto &key : units[unit].reads) {
+          if (units[unit].writes.count(key)) {
+            continue;
+          }
+          auto &access = keys[key];
+          if (access.last_writer) {
+            sets.unite(unit, *access.last_writer);
+          }
+          access.readers_since_write.push_back(unit);
+        }
+      }
+
+      std::vector<size_t> groups(units.size());
+      std::unordered_map<size_t, size_t> group_of_root;
+      for (size_t unit = 0; unit < units.size(); ++unit) {
+        groups[unit] =
+            group_of_root.emplace(sets.find(unit), group_of_root.size())
+                .first->second;
+      }
+      return groups;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
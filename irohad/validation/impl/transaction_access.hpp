@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRANSACTION_ACCESS_HPP
+#define IROHA_TRANSACTION_ACCESS_HPP
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Parts of the world state view which are read and written by a
+     * transaction. Keys are coarse: e.g. all balances, signatories, roles and
+     * grantable permissions of an account share the key of the account.
+     */
+    struct AccessSet {
+      std::set<std::string> reads;
+      std::set<std::string> writes;
+
+      /**
+       * Add reads and writes of another access set
+       */
+      void merge(const AccessSet &other);
+
+      /**
+       * @return true if the results of two units depend on the order in which
+       * they are applied, i.e. one writes a key which another accesses
+       */
+      bool conflictsWith(const AccessSet &other) const;
+    };
+
+    /**
+     * Derive the access set of the transaction from its creator and commands
+     */
+    AccessSet accessSetOf(const shared_model::interface::Transaction &tx);
+
+    /**
+     * Split units, e.g. batches, into groups which can be applied
+     * independently: a unit conflicts only with units of its own group.
+     * Applying each group in the original order gives the same result as
+     * applying all units in the original order.
+     * @param units - access sets of units in application order
+     * @return group number of each unit; groups are numbered by their first
+     * unit, so the result does not depend on anything but the input
+     */
+    std::vector<size_t> independentGroups(const std::vector<AccessSet> &units);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_ACCESS_HPP
@@ -68,6 +68,20 @@ namespace iroha {
         underlying().addItemImpl(key, value);
       }
 
+      /**
+       * Adds new item to cache unless the key is already there. The search and
+       * the insertion are made under the same lock, so concurrent callers,
+       * which missed the same key, add it once.
+       * @param key - key to insert
+       * @param value - value to insert
+       * @return true if the item was added
+       */
+      bool addItemIfAbsent(const KeyType &key, const ValueType &value) {
+        // exclusive lock
+        std::lock_guard<std::shared_timed_mutex> lock(access_mutex_);
+        return underlying().addItemIfAbsentImpl(key, value);
+      }
+
       /**
        * Performs a search for an item with a specific key.
        * @param hash - key to find
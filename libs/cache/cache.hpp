@@ -55,6 +55,14 @@ namespace iroha {
         }
       }
 
+      bool addItemIfAbsentImpl(const KeyType &key, const ValueType &value) {
+        if (handler_map_.find(key) != handler_map_.end()) {
+          return false;
+        }
+        addItemImpl(key, value);
+        return true;
+      }
+
       boost::optional<ValueType> findItemImpl(const KeyType &key) const {
         auto found = handler_map_.find(key);
         if (found == handler_map_.end()) {
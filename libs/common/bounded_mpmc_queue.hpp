@@ -0,0 +1,139 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_BOUNDED_MPMC_QUEUE_HPP
+#define IROHA_COMMON_BOUNDED_MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+
+  /**
+   * Bounded lock-free queue for many producers and many consumers.
+   *
+   * Every cell of the ring buffer has a sequence number, which tells whether
+   * the cell is ready to be written or read at the current position, so that
+   * producers and consumers only contend on the position counters with a
+   * single compare-and-swap per operation.
+   * @tparam T - type of elements, must be default constructible and movable
+   */
+  template <typename T>
+  class BoundedMpmcQueue {
+   public:
+    /**
+     * @param capacity - maximum number of elements, rounded up to a power of
+     * two
+     */
+    explicit BoundedMpmcQueue(size_t capacity)
+        : mask_(roundUp(capacity) - 1),
+          cells_(new Cell[mask_ + 1]),
+          enqueue_position_(),
+          dequeue_position_() {
+      for (size_t i = 0; i <= mask_; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    BoundedMpmcQueue(const BoundedMpmcQueue &) = delete;
+    BoundedMpmcQueue &operator=(const BoundedMpmcQueue &) = delete;
+
+    /**
+     * Add the element to the tail of the queue
+     * @param value - element, which is left untouched if the queue is full
+     * @return false if the queue is full
+     */
+    bool tryPush(T &&value) {
+      auto position = enqueue_position_.value.load(std::memory_order_relaxed);
+      while (true) {
+        auto &cell = cells_[position & mask_];
+        auto sequence = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence)
+            - static_cast<std::ptrdiff_t>(position);
+        if (diff == 0) {
+          if (enqueue_position_.value.compare_exchange_weak(
+                  position, position + 1, std::memory_order_relaxed)) {
+            cell.value = std::move(value);
+            cell.sequence.store(position + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0) {
+          return false;
+        } else {
+          position = enqueue_position_.value.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /**
+     * Take the element from the head of the queue
+     * @return the element, or none if the queue is empty
+     */
+    boost::optional<T> tryPop() {
+      auto position = dequeue_position_.value.load(std::memory_order_relaxed);
+      while (true) {
+        auto &cell = cells_[position & mask_];
+        auto sequence = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence)
+            - static_cast<std::ptrdiff_t>(position + 1);
+        if (diff == 0) {
+          if (dequeue_position_.value.compare_exchange_weak(
+                  position, position + 1, std::memory_order_relaxed)) {
+            boost::optional<T> value(std::move(cell.value));
+            cell.value = T{};
+            cell.sequence.store(position + mask_ + 1,
+                                std::memory_order_release);
+            return value;
+          }
+        } else if (diff < 0) {
+          return boost::none;
+        } else {
+          position = dequeue_position_.value.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /// @return maximum number of elements
+    size_t capacity() const {
+      return mask_ + 1;
+    }
+
+   private:
+    static size_t roundUp(size_t capacity) {
+      size_t result = 2;
+      while (result < capacity) {
+        result <<= 1;
+      }
+      return result;
+    }
+
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct Cell {
+      std::atomic<size_t> sequence;
+      T value;
+    };
+
+    /// position counter, which occupies a whole cache line, so that
+    /// producers and consumers do not invalidate each other's cache line
+    struct Position {
+      char padding_before[kCacheLineSize];
+      std::atomic<size_t> value;
+      char padding_after[kCacheLineSize - sizeof(std::atomic<size_t>)];
+    };
+
+    const size_t mask_;
+    const std::unique_ptr<Cell[]> cells_;
+    Position enqueue_position_;
+    Position dequeue_position_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_BOUNDED_MPMC_QUEUE_HPP
@@ -22,6 +22,15 @@ namespace shared_model {
       explicit Block(const TransportType &ref);
       explicit Block(TransportType &&ref);
 
+      /**
+       * Wrap the given transport without copying it and share its ownership.
+       * When the transport is allocated on a protobuf arena, pass a pointer
+       * sharing the ownership of the arena, so that the whole block with its
+       * transactions is freed at once.
+       * @param ref - shared transport to be referenced
+       */
+      explicit Block(std::shared_ptr<TransportType> ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
@@ -45,6 +54,8 @@ namespace shared_model {
 
       const interface::types::BlobType &payload() const override;
 
+      const interface::types::HashType &hash() const override;
+
       typename interface::Block::ModelType *clone() const override;
 
       const iroha::protocol::Block_v1 &getTransport() const;
@@ -10,53 +10,81 @@
 #include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
 #include "common/byteutils.hpp"
+#include "cryptography/hash_providers/sha3_256.hpp"
+#include "utils/lazy_initializer.hpp"
 
 namespace shared_model {
   namespace proto {
 
     struct Block::Impl {
-      explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
-      explicit Impl(const TransportType &ref) : proto_(ref) {}
+      explicit Impl(TransportType &&ref)
+          : Impl(std::make_shared<TransportType>(std::move(ref))) {}
+      explicit Impl(const TransportType &ref)
+          : Impl(std::make_shared<TransportType>(ref)) {}
+      explicit Impl(std::shared_ptr<TransportType> ref)
+          : owner_(std::move(ref)) {}
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
-      TransportType proto_;
+      // owns the transport, possibly together with the arena it lives in
+      std::shared_ptr<TransportType> owner_;
+
+      TransportType &proto_{*owner_};
       iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
 
-      std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            payload_.mutable_transactions()->begin(),
-            payload_.mutable_transactions()->end());
-      }()};
+      // all the members below are derived from the transport and are built
+      // only when they are requested for the first time, so that blocks which
+      // are only stored or forwarded do not pay for the serializations and
+      // wrappers of all their transactions
+
+      detail::LazyInitializer<std::vector<proto::Transaction>> transactions_{
+          [this] {
+            // wrappers reference the transactions of the shared transport
+            std::vector<proto::Transaction> transactions;
+            transactions.reserve(payload_.transactions_size());
+            for (auto &tx : *payload_.mutable_transactions()) {
+              transactions.emplace_back(tx);
+            }
+            // the transactions are requested to be applied or looked up by
+            // their hashes, so all the hashes are computed at once
+            proto::Transaction::computeHashes(transactions);
+            return transactions;
+          }};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      detail::LazyInitializer<interface::types::BlobType> blob_{
+          [this] { return makeBlob(proto_); }};
 
-      interface::types::HashType prev_hash_{[this] {
+      detail::LazyInitializer<interface::types::HashType> prev_hash_{[this] {
         return interface::types::HashType(
             crypto::Hash::fromHexString(proto_.payload().prev_block_hash()));
-      }()};
-
-      SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_.mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }()};
+      }};
 
-      std::vector<interface::types::HashType> rejected_transactions_hashes_{
+      detail::LazyInitializer<SignatureSetType<proto::Signature>> signatures_{
           [this] {
+            auto signatures = *proto_.mutable_signatures()
+                | boost::adaptors::transformed(
+                      [](auto &x) { return proto::Signature(x); });
+            return SignatureSetType<proto::Signature>(signatures.begin(),
+                                                      signatures.end());
+          }};
+
+      detail::LazyInitializer<std::vector<interface::types::HashType>>
+          rejected_transactions_hashes_{[this] {
             std::vector<interface::types::HashType> hashes;
-            for (const auto &hash :
-                 *payload_.mutable_rejected_transactions_hashes()) {
+            hashes.reserve(payload_.rejected_transactions_hashes_size());
+            for (const auto &hash : payload_.rejected_transactions_hashes()) {
               hashes.emplace_back(
                   shared_model::crypto::Hash::fromHexString(hash));
             }
             return hashes;
-          }()};
+          }};
+
+      detail::LazyInitializer<interface::types::BlobType> payload_blob_{
+          [this] { return makeBlob(payload_); }};
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
+      detail::LazyInitializer<interface::types::HashType> hash_{[this] {
+        return shared_model::crypto::Sha3_256::makeHash(*payload_blob_);
+      }};
     };
 
     Block::Block(Block &&o) noexcept = default;
@@ -69,8 +97,12 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(std::shared_ptr<TransportType> ref) {
+      impl_ = std::make_unique<Block::Impl>(std::move(ref));
+    }
+
     interface::types::TransactionsCollectionType Block::transactions() const {
-      return impl_->transactions_;
+      return *impl_->transactions_;
     }
 
     interface::types::HeightType Block::height() const {
@@ -78,26 +110,26 @@ namespace shared_model {
     }
 
     const interface::types::HashType &Block::prevHash() const {
-      return impl_->prev_hash_;
+      return *impl_->prev_hash_;
     }
 
     const interface::types::BlobType &Block::blob() const {
-      return impl_->blob_;
+      return *impl_->blob_;
     }
 
     interface::types::SignatureRangeType Block::signatures() const {
-      return impl_->signatures_;
+      return *impl_->signatures_;
     }
 
     bool Block::addSignature(const crypto::Signed &signed_blob,
                              const crypto::PublicKey &public_key) {
       // if already has such signature
-      if (std::find_if(impl_->signatures_.begin(),
-                       impl_->signatures_.end(),
+      if (std::find_if(impl_->signatures_->begin(),
+                       impl_->signatures_->end(),
                        [&public_key](const auto &signature) {
                          return signature.publicKey() == public_key;
                        })
-          != impl_->signatures_.end()) {
+          != impl_->signatures_->end()) {
         return false;
       }
 
@@ -105,13 +137,8 @@ namespace shared_model {
       sig->set_signature(signed_blob.hex());
       sig->set_public_key(public_key.hex());
 
-      impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_.mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }();
+      impl_->signatures_.invalidate();
+      impl_->blob_.invalidate();
       return true;
     }
 
@@ -125,11 +152,15 @@ namespace shared_model {
 
     interface::types::HashCollectionType Block::rejected_transactions_hashes()
         const {
-      return impl_->rejected_transactions_hashes_;
+      return *impl_->rejected_transactions_hashes_;
     }
 
     const interface::types::BlobType &Block::payload() const {
-      return impl_->payload_blob_;
+      return *impl_->payload_blob_;
+    }
+
+    const interface::types::HashType &Block::hash() const {
+      return *impl_->hash_;
     }
 
     const iroha::protocol::Block_v1 &Block::getTransport() const {
@@ -13,16 +13,28 @@ namespace shared_model {
     using namespace interface::types;
 
     struct Proposal::Impl {
-      explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
+      explicit Impl(TransportType &&ref)
+          : Impl(std::make_shared<TransportType>(std::move(ref))) {}
 
-      explicit Impl(const TransportType &ref) : proto_(ref) {}
+      explicit Impl(const TransportType &ref)
+          : Impl(std::make_shared<TransportType>(ref)) {}
 
-      TransportType proto_;
+      explicit Impl(std::shared_ptr<TransportType> ref)
+          : owner_(std::move(ref)) {}
+
+      // owns the transport, possibly together with the arena it lives in
+      std::shared_ptr<TransportType> owner_;
+
+      TransportType &proto_{*owner_};
 
       const std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
+        std::vector<proto::Transaction> transactions(
             proto_.mutable_transactions()->begin(),
             proto_.mutable_transactions()->end());
+        // hashes of all the transactions of a proposal are needed for its
+        // validation, so they are computed at once
+        proto::Transaction::computeHashes(transactions);
+        return transactions;
       }()};
 
       interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
@@ -41,6 +53,10 @@ namespace shared_model {
       impl_ = std::make_unique<Proposal::Impl>(std::move(ref));
     }
 
+    Proposal::Proposal(std::shared_ptr<TransportType> ref) {
+      impl_ = std::make_unique<Proposal::Impl>(std::move(ref));
+    }
+
     TransactionsCollectionType Proposal::transactions() const {
       return impl_->transactions_;
     }
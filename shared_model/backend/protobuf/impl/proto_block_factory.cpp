@@ -59,7 +59,26 @@ ProtoBlockFactory::createBlock(iroha::protocol::Block block) {
   }
 
   std::unique_ptr<shared_model::interface::Block> proto_block =
-      std::make_unique<Block>(std::move(block.block_v1()));
+      std::make_unique<Block>(std::move(*block.mutable_block_v1()));
+  if (auto errors = interface_validator_->validate(*proto_block)) {
+    return iroha::expected::makeError(errors.reason());
+  }
+
+  return iroha::expected::makeValue(std::move(proto_block));
+}
+
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+ProtoBlockFactory::createBlock(std::shared_ptr<iroha::protocol::Block> block) {
+  if (auto errors = proto_validator_->validate(*block)) {
+    return iroha::expected::makeError(errors.reason());
+  }
+
+  // the block payload shares the ownership of the whole message
+  auto block_v1 = std::shared_ptr<iroha::protocol::Block_v1>(
+      block, block->mutable_block_v1());
+  std::unique_ptr<shared_model::interface::Block> proto_block =
+      std::make_unique<Block>(std::move(block_v1));
   if (auto errors = interface_validator_->validate(*proto_block)) {
     return iroha::expected::makeError(errors.reason());
   }
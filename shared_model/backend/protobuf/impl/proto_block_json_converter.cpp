@@ -9,10 +9,152 @@
 #include <string>
 
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/transaction.hpp"
 
 using namespace shared_model;
 using namespace shared_model::proto;
 
+namespace {
+  /**
+   * Structural scanner of json, which only finds the boundaries of values
+   * without building them
+   */
+  class JsonScanner {
+   public:
+    explicit JsonScanner(const std::string &json) : json_(json), pos_(0) {}
+
+    /**
+     * Move to the value of the member of the object at the current position
+     * @param key - name of the member
+     * @return false if there is no such member, or the json is malformed
+     */
+    bool findMember(const std::string &key) {
+      if (not consume('{')) {
+        return fail();
+      }
+      if (consume('}')) {
+        return false;
+      }
+      do {
+        std::string name;
+        if (not readString(&name) or not consume(':')) {
+          return fail();
+        }
+        if (name == key) {
+          skipWhitespace();
+          return true;
+        }
+        if (not skipValue()) {
+          return false;
+        }
+      } while (consume(','));
+      return consume('}') ? false : fail();
+    }
+
+    /// skip the value at the current position
+    bool skipValue() {
+      skipWhitespace();
+      if (pos_ >= json_.size()) {
+        return fail();
+      }
+      switch (json_[pos_]) {
+        case '"':
+          return readString(nullptr);
+        case '{':
+          ++pos_;
+          if (consume('}')) {
+            return true;
+          }
+          do {
+            if (not readString(nullptr) or not consume(':')
+                or not skipValue()) {
+              return fail();
+            }
+          } while (consume(','));
+          return consume('}') or fail();
+        case '[':
+          ++pos_;
+          if (consume(']')) {
+            return true;
+          }
+          do {
+            if (not skipValue()) {
+              return fail();
+            }
+          } while (consume(','));
+          return consume(']') or fail();
+        default: {
+          // number, boolean or null
+          auto begin = pos_;
+          while (pos_ < json_.size()
+                 and std::string(",}] \t\r\n").find(json_[pos_])
+                     == std::string::npos) {
+            ++pos_;
+          }
+          return pos_ != begin or fail();
+        }
+      }
+    }
+
+    /// skip whitespace and the character if it is at the current position
+    bool consume(char c) {
+      skipWhitespace();
+      if (pos_ < json_.size() and json_[pos_] == c) {
+        ++pos_;
+        return true;
+      }
+      return false;
+    }
+
+    void skipWhitespace() {
+      while (pos_ < json_.size()
+             and (json_[pos_] == ' ' or json_[pos_] == '\t'
+                  or json_[pos_] == '\r' or json_[pos_] == '\n')) {
+        ++pos_;
+      }
+    }
+
+    size_t position() const {
+      return pos_;
+    }
+
+    bool failed() const {
+      return failed_;
+    }
+
+   private:
+    bool readString(std::string *out) {
+      if (not consume('"')) {
+        return fail();
+      }
+      auto begin = pos_;
+      while (pos_ < json_.size()) {
+        if (json_[pos_] == '\\') {
+          pos_ += 2;
+        } else if (json_[pos_] == '"') {
+          if (out) {
+            out->assign(json_, begin, pos_ - begin);
+          }
+          ++pos_;
+          return true;
+        } else {
+          ++pos_;
+        }
+      }
+      return fail();
+    }
+
+    bool fail() {
+      failed_ = true;
+      return false;
+    }
+
+    const std::string &json_;
+    size_t pos_;
+    bool failed_ = false;
+  };
+}  // namespace
+
 iroha::expected::Result<interface::types::JsonType, std::string>
 ProtoBlockJsonConverter::serialize(const interface::Block &block) const
     noexcept {
@@ -41,3 +183,52 @@ ProtoBlockJsonConverter::deserialize(
       std::make_unique<Block>(std::move(block.block_v1()));
   return iroha::expected::makeValue(std::move(result));
 }
+
+iroha::expected::Result<
+    std::vector<interface::BlockJsonSerializer::TransactionPosition>,
+    std::string>
+ProtoBlockJsonConverter::transactionPositions(
+    const interface::types::JsonType &json) const noexcept {
+  std::vector<TransactionPosition> positions;
+  JsonScanner scanner(json);
+  if (not scanner.findMember("blockV1") or not scanner.findMember("payload")) {
+    return iroha::expected::makeError("No block payload in json");
+  }
+  // empty repeated fields are omitted from json
+  if (not scanner.findMember("transactions")) {
+    if (scanner.failed()) {
+      return iroha::expected::makeError("Malformed json of block payload");
+    }
+    return iroha::expected::makeValue(std::move(positions));
+  }
+  if (not scanner.consume('[')) {
+    return iroha::expected::makeError("Transactions are not an array");
+  }
+  if (not scanner.consume(']')) {
+    do {
+      scanner.skipWhitespace();
+      auto begin = scanner.position();
+      if (not scanner.skipValue()) {
+        return iroha::expected::makeError("Malformed json of transaction");
+      }
+      positions.push_back({begin, scanner.position() - begin});
+    } while (scanner.consume(','));
+    if (not scanner.consume(']')) {
+      return iroha::expected::makeError("Malformed json of transactions");
+    }
+  }
+  return iroha::expected::makeValue(std::move(positions));
+}
+
+iroha::expected::Result<std::unique_ptr<interface::Transaction>, std::string>
+ProtoBlockJsonConverter::deserializeTransaction(
+    const interface::types::JsonType &json) const noexcept {
+  iroha::protocol::Transaction transaction;
+  auto status = google::protobuf::util::JsonStringToMessage(json, &transaction);
+  if (not status.ok()) {
+    return iroha::expected::makeError(status.error_message());
+  }
+  std::unique_ptr<interface::Transaction> result =
+      std::make_unique<Transaction>(std::move(transaction));
+  return iroha::expected::makeValue(std::move(result));
+}
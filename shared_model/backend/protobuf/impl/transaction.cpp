@@ -10,6 +10,7 @@
 #include "backend/protobuf/commands/proto_command.hpp"
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/util.hpp"
+#include "utils/lazy_initializer.hpp"
 #include "utils/reference_holder.hpp"
 
 namespace shared_model {
@@ -22,6 +23,12 @@ namespace shared_model {
 
       explicit Impl(TransportType &ref) : proto_{ref} {}
 
+      explicit Impl(std::shared_ptr<TransportType> ref)
+          : owner_{std::move(ref)}, proto_{*owner_} {}
+
+      // keeps alive the storage of a shared transport, e.g. its arena
+      std::shared_ptr<TransportType> owner_;
+
       detail::ReferenceHolder<TransportType> proto_;
 
       iroha::protocol::Transaction::Payload &payload_{
@@ -30,39 +37,56 @@ namespace shared_model {
       iroha::protocol::Transaction::Payload::ReducedPayload &reduced_payload_{
           *proto_->mutable_payload()->mutable_reduced_payload()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
+      // all the members below are derived from the transport and are built
+      // only when they are requested for the first time: most consumers of a
+      // transaction need just a couple of them
+
+      detail::LazyInitializer<interface::types::BlobType> blob_{
+          [this] { return makeBlob(*proto_); }};
+
+      detail::LazyInitializer<interface::types::BlobType> payload_blob_{
+          [this] { return makeBlob(payload_); }};
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
+      detail::LazyInitializer<interface::types::BlobType>
+          reduced_payload_blob_{[this] { return makeBlob(reduced_payload_); }};
 
-      interface::types::BlobType reduced_payload_blob_{
-          [this] { return makeBlob(reduced_payload_); }()};
+      detail::LazyInitializer<interface::types::HashType> hash_{[this] {
+        return shared_model::crypto::Sha3_256::makeHash(*payload_blob_);
+      }};
 
-      interface::types::HashType reduced_hash_{
-          shared_model::crypto::Sha3_256::makeHash(reduced_payload_blob_)};
+      detail::LazyInitializer<interface::types::HashType> reduced_hash_{
+          [this] {
+            return shared_model::crypto::Sha3_256::makeHash(
+                *reduced_payload_blob_);
+          }};
 
-      std::vector<proto::Command> commands_{
-          reduced_payload_.mutable_commands()->begin(),
-          reduced_payload_.mutable_commands()->end()};
+      detail::LazyInitializer<std::vector<proto::Command>> commands_{[this] {
+        return std::vector<proto::Command>(
+            reduced_payload_.mutable_commands()->begin(),
+            reduced_payload_.mutable_commands()->end());
+      }};
 
-      boost::optional<std::shared_ptr<interface::BatchMeta>> meta_{
-          [this]() -> boost::optional<std::shared_ptr<interface::BatchMeta>> {
+      detail::LazyInitializer<
+          boost::optional<std::shared_ptr<interface::BatchMeta>>>
+          meta_{[this]()
+                    -> boost::optional<std::shared_ptr<interface::BatchMeta>> {
             if (payload_.has_batch()) {
               std::shared_ptr<interface::BatchMeta> b =
                   std::make_shared<proto::BatchMeta>(*payload_.mutable_batch());
               return b;
             }
             return boost::none;
-          }()};
-
-      SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_->mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }()};
-    };  // namespace proto
+          }};
+
+      detail::LazyInitializer<SignatureSetType<proto::Signature>> signatures_{
+          [this] {
+            auto signatures = *proto_->mutable_signatures()
+                | boost::adaptors::transformed(
+                      [](auto &x) { return proto::Signature(x); });
+            return SignatureSetType<proto::Signature>(signatures.begin(),
+                                                      signatures.end());
+          }};
+    };
 
     Transaction::Transaction(const TransportType &transaction) {
       impl_ = std::make_unique<Transaction::Impl>(transaction);
@@ -76,6 +100,10 @@ namespace shared_model {
       impl_ = std::make_unique<Transaction::Impl>(transaction);
     }
 
+    Transaction::Transaction(std::shared_ptr<TransportType> transaction) {
+      impl_ = std::make_unique<Transaction::Impl>(std::move(transaction));
+    }
+
     // TODO [IR-1866] Akvinikym 13.11.18: remove the copy ctor and fix fallen
     // tests
     Transaction::Transaction(const Transaction &transaction)
@@ -92,38 +120,42 @@ namespace shared_model {
     }
 
     Transaction::CommandsType Transaction::commands() const {
-      return impl_->commands_;
+      return *impl_->commands_;
     }
 
     const interface::types::BlobType &Transaction::blob() const {
-      return impl_->blob_;
+      return *impl_->blob_;
     }
 
     const interface::types::BlobType &Transaction::payload() const {
-      return impl_->payload_blob_;
+      return *impl_->payload_blob_;
     }
 
     const interface::types::BlobType &Transaction::reducedPayload() const {
-      return impl_->reduced_payload_blob_;
+      return *impl_->reduced_payload_blob_;
     }
 
     interface::types::SignatureRangeType Transaction::signatures() const {
-      return impl_->signatures_;
+      return *impl_->signatures_;
+    }
+
+    const interface::types::HashType &Transaction::hash() const {
+      return *impl_->hash_;
     }
 
     const interface::types::HashType &Transaction::reducedHash() const {
-      return impl_->reduced_hash_;
+      return *impl_->reduced_hash_;
     }
 
     bool Transaction::addSignature(const crypto::Signed &signed_blob,
                                    const crypto::PublicKey &public_key) {
       // if already has such signature
-      if (std::find_if(impl_->signatures_.begin(),
-                       impl_->signatures_.end(),
+      if (std::find_if(impl_->signatures_->begin(),
+                       impl_->signatures_->end(),
                        [&public_key](const auto &signature) {
                          return signature.publicKey() == public_key;
                        })
-          != impl_->signatures_.end()) {
+          != impl_->signatures_->end()) {
         return false;
       }
 
@@ -131,17 +163,27 @@ namespace shared_model {
       sig->set_signature(signed_blob.hex());
       sig->set_public_key(public_key.hex());
 
-      impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_->mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }();
+      // signatures are not a part of the payload, so only these two members
+      // have become outdated
+      impl_->signatures_.invalidate();
+      impl_->blob_.invalidate();
 
       return true;
     }
 
+    void Transaction::computeHashes(
+        const std::vector<Transaction> &transactions) {
+      std::vector<const crypto::Blob *> payloads;
+      payloads.reserve(transactions.size());
+      for (const auto &transaction : transactions) {
+        payloads.push_back(&transaction.payload());
+      }
+      auto hashes = crypto::Sha3_256::makeHashes(payloads);
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        transactions[i].impl_->hash_.initialize(std::move(hashes[i]));
+      }
+    }
+
     const Transaction::TransportType &Transaction::getTransport() const {
       return *impl_->proto_;
     }
@@ -156,7 +198,7 @@ namespace shared_model {
 
     boost::optional<std::shared_ptr<interface::BatchMeta>>
     Transaction::batchMeta() const {
-      return impl_->meta_;
+      return *impl_->meta_;
     }
 
     Transaction::ModelType *Transaction::clone() const {
@@ -22,6 +22,15 @@ namespace shared_model {
       explicit Proposal(const TransportType &ref);
       explicit Proposal(TransportType &&ref);
 
+      /**
+       * Wrap the given transport without copying it and share its ownership.
+       * When the transport is allocated on a protobuf arena, pass a pointer
+       * sharing the ownership of the arena, so that the whole proposal with
+       * its transactions is freed at once.
+       * @param ref - shared transport to be referenced
+       */
+      explicit Proposal(std::shared_ptr<TransportType> ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
@@ -42,6 +42,17 @@ namespace shared_model {
       iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
       createBlock(iroha::protocol::Block block);
 
+      /**
+       * Create block variant over a shared transport without copying it
+       *
+       * @param block - proto block, possibly owned by an arena, from which
+       *        block variant is created
+       * @return Pointer to block.
+       *         Error if block is invalid
+       */
+      iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
+      createBlock(std::shared_ptr<iroha::protocol::Block> block);
+
      private:
       std::unique_ptr<shared_model::validation::AbstractValidator<
           shared_model::interface::Block>>
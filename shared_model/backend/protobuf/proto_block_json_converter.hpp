@@ -12,6 +12,7 @@
 namespace shared_model {
   namespace interface {
     class Block;
+    class Transaction;
   }
 
   namespace proto {
@@ -23,6 +24,15 @@ namespace shared_model {
       iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
       deserialize(const interface::types::JsonType &json) const
           noexcept override;
+
+      iroha::expected::Result<std::vector<TransactionPosition>, std::string>
+      transactionPositions(const interface::types::JsonType &json) const
+          noexcept override;
+
+      iroha::expected::Result<std::unique_ptr<interface::Transaction>,
+                              std::string>
+      deserializeTransaction(const interface::types::JsonType &json) const
+          noexcept override;
     };
   }  // namespace proto
 }  // namespace shared_model
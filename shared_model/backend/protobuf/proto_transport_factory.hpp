@@ -42,30 +42,66 @@ namespace shared_model {
       iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
           typename Proto::TransportType m) const override {
         if (auto answer = proto_validator_->validate(m)) {
-          auto payload_field_descriptor =
-              m.GetDescriptor()->FindFieldByLowercaseName("payload");
-          shared_model::crypto::Hash hash;
-          if (payload_field_descriptor) {
-            const auto &payload =
-                m.GetReflection()->GetMessage(m, payload_field_descriptor);
-            hash = HashProvider::makeHash(makeBlob(payload));
-          }
-          return iroha::expected::makeError(Error{hash, answer.reason()});
+          return iroha::expected::makeError(
+              Error{payloadHash(m), answer.reason()});
         }
 
-        std::unique_ptr<Interface> result =
-            std::make_unique<Proto>(std::move(m));
-        if (auto answer = interface_validator_->validate(*result)) {
+        return validated(std::make_unique<Proto>(std::move(m)));
+      }
+
+      iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          std::shared_ptr<typename Proto::TransportType> m) const override {
+        if (auto answer = proto_validator_->validate(*m)) {
           return iroha::expected::makeError(
-              Error{result->hash(), answer.reason()});
+              Error{payloadHash(*m), answer.reason()});
         }
 
-        return iroha::expected::makeValue(std::move(result));
+        return validated(makeShared(
+            std::move(m),
+            std::is_constructible<
+                Proto,
+                std::shared_ptr<typename Proto::TransportType>>{}));
       }
 
      private:
       using HashProvider = shared_model::crypto::Sha3_256;
 
+      static crypto::Hash payloadHash(const typename Proto::TransportType &m) {
+        auto payload_field_descriptor =
+            m.GetDescriptor()->FindFieldByLowercaseName("payload");
+        shared_model::crypto::Hash hash;
+        if (payload_field_descriptor) {
+          const auto &payload =
+              m.GetReflection()->GetMessage(m, payload_field_descriptor);
+          hash = HashProvider::makeHash(makeBlob(payload));
+        }
+        return hash;
+      }
+
+      /// wrap shared transport when Proto supports it
+      template <typename P = Proto>
+      static std::unique_ptr<Interface> makeShared(
+          std::shared_ptr<typename P::TransportType> m, std::true_type) {
+        return std::make_unique<P>(std::move(m));
+      }
+
+      /// copy shared transport otherwise
+      template <typename P = Proto>
+      static std::unique_ptr<Interface> makeShared(
+          std::shared_ptr<typename P::TransportType> m, std::false_type) {
+        return std::make_unique<P>(typename P::TransportType(*m));
+      }
+
+      iroha::expected::Result<std::unique_ptr<Interface>, Error> validated(
+          std::unique_ptr<Interface> result) const {
+        if (auto answer = interface_validator_->validate(*result)) {
+          return iroha::expected::makeError(
+              Error{result->hash(), answer.reason()});
+        }
+
+        return iroha::expected::makeValue(std::move(result));
+      }
+
       ValidatorType interface_validator_;
       ProtoValidatorType proto_validator_;
     };
@@ -10,7 +10,12 @@ namespace shared_model {
 
     template <typename QueryType>
     GetPendingTransactions::GetPendingTransactions(QueryType &&query)
-        : CopyableProto(std::forward<QueryType>(query)) {}
+        : CopyableProto(std::forward<QueryType>(query)),
+          pending_transactions_{proto_->payload().get_pending_transactions()},
+          pagination_meta_{pending_transactions_.has_pagination_meta()
+                               ? boost::make_optional(TxPaginationMeta{
+                                     pending_transactions_.pagination_meta()})
+                               : boost::none} {}
 
     template GetPendingTransactions::GetPendingTransactions(
         GetPendingTransactions::TransportType &);
@@ -27,5 +32,13 @@ namespace shared_model {
         GetPendingTransactions &&o) noexcept
         : GetPendingTransactions(std::move(o.proto_)) {}
 
+    boost::optional<const interface::TxPaginationMeta &>
+    GetPendingTransactions::paginationMeta() const {
+      if (pagination_meta_) {
+        return *pagination_meta_;
+      }
+      return boost::none;
+    }
+
   }  // namespace proto
 }  // namespace shared_model
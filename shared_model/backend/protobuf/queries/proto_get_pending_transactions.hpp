@@ -7,6 +7,7 @@
 #define IROHA_PROTO_GET_PENDING_TRANSACTIONS_HPP
 
 #include "backend/protobuf/common_objects/trivial_proto.hpp"
+#include "backend/protobuf/queries/proto_tx_pagination_meta.hpp"
 #include "interfaces/queries/get_pending_transactions.hpp"
 #include "queries.pb.h"
 
@@ -23,6 +24,15 @@ namespace shared_model {
       GetPendingTransactions(const GetPendingTransactions &o);
 
       GetPendingTransactions(GetPendingTransactions &&o) noexcept;
+
+      boost::optional<const interface::TxPaginationMeta &> paginationMeta()
+          const override;
+
+     private:
+      // ------------------------------| fields |-------------------------------
+
+      const iroha::protocol::GetPendingTransactions &pending_transactions_;
+      const boost::optional<TxPaginationMeta> pagination_meta_;
     };
   }  // namespace proto
 }  // namespace shared_model
@@ -19,10 +19,31 @@ namespace shared_model {
 
       explicit Transaction(TransportType &&transaction);
 
+      /**
+       * Wrap the given transport without copying it. The transport must
+       * outlive the created object, e.g. be a part of an enclosing proposal.
+       * @param transaction - transport to be referenced
+       */
       explicit Transaction(TransportType &transaction);
 
+      /**
+       * Wrap the given transport without copying it and share its ownership.
+       * Use the aliasing constructor of std::shared_ptr to keep alive the
+       * arena or the enclosing message which owns the transport.
+       * @param transaction - shared transport to be referenced
+       */
+      explicit Transaction(std::shared_ptr<TransportType> transaction);
+
       Transaction(const Transaction &transaction);
 
+      /**
+       * Compute hashes of the given transactions at once, which is faster
+       * than computing them one by one on the first access, e.g. for all the
+       * transactions of a proposal or a block
+       * @param transactions - transactions, whose hashes are computed
+       */
+      static void computeHashes(const std::vector<Transaction> &transactions);
+
       Transaction(Transaction &&o) noexcept;
 
       ~Transaction() override;
@@ -39,6 +60,8 @@ namespace shared_model {
 
       interface::types::SignatureRangeType signatures() const override;
 
+      const interface::types::HashType &hash() const override;
+
       const interface::types::HashType &reducedHash() const override;
 
       bool addSignature(const crypto::Signed &signed_blob,
@@ -6,7 +6,9 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 #define IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/message.h>
+#include <memory>
 #include <vector>
 #include "cryptography/blob.hpp"
 
@@ -21,6 +23,20 @@ namespace shared_model {
       return crypto::Blob(std::move(data));
     }
 
+    /**
+     * Copy the message into a new arena, so that all its submessages and
+     * fields are allocated at once and freed together with the copy
+     * @param message - message to be copied
+     * @return copy of the message which shares the ownership of the arena
+     */
+    template <typename T>
+    std::shared_ptr<T> makeArenaCopy(const T &message) {
+      auto arena = std::make_shared<google::protobuf::Arena>();
+      auto copy = google::protobuf::Arena::CreateMessage<T>(arena.get());
+      copy->CopyFrom(message);
+      return std::shared_ptr<T>(arena, copy);
+    }
+
   }  // namespace proto
 }  // namespace shared_model
 
@@ -6,23 +6,44 @@
 #ifndef IROHA_CRYPTO_VERIFIER_HPP
 #define IROHA_CRYPTO_VERIFIER_HPP
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "cache/cache.hpp"
+#include "crypto/hash_types.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
 
 namespace shared_model {
   namespace crypto {
 
-    class Signed;
-    class Blob;
-    class PublicKey;
-
     /**
      * CryptoVerifier - adapter for generalization verification of cryptographic
      * signatures
+     *
+     * The same signatures are verified by several stages of the node, e.g. a
+     * transaction by torii, by the ordering service and as a part of a
+     * proposal and a block, so correct signatures are remembered in a bounded
+     * cache, which is shared by all the stages and threads.
      * @tparam Algorithm - cryptographic algorithm for verification
      */
     template <typename Algorithm = DefaultCryptoAlgorithmType>
     class CryptoVerifier {
      public:
+      /// counters of the cache of correct signatures
+      struct CacheMetrics {
+        /// number of verifications, which found the signature in the cache
+        uint64_t hits;
+        /// number of verifications made by the algorithm
+        uint64_t misses;
+        /// number of signatures in the cache
+        uint32_t size;
+      };
+
       /**
        * Verify signature attached to source data
        * @param signedData - cryptographic signature
@@ -33,11 +54,78 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &source,
                          const PublicKey &pubKey) {
-        return Algorithm::verify(signedData, source, pubKey);
+        auto &state = cacheState();
+        const auto key = cacheKey(signedData, source, pubKey);
+        if (state.cache.findItem(key)) {
+          ++state.hits;
+          return true;
+        }
+        ++state.misses;
+        auto result = Algorithm::verify(signedData, source, pubKey);
+        if (result) {
+          // another thread may have verified the same signature meanwhile
+          state.cache.addItemIfAbsent(key, true);
+        }
+        return result;
+      }
+
+      /**
+       * @return counters of the cache of correct signatures
+       */
+      static CacheMetrics cacheMetrics() {
+        auto &state = cacheState();
+        return {state.hits, state.misses, state.cache.getCacheItemCount()};
       }
 
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
+
+     private:
+      /// the key is a digest, so any of its words is a good hash value
+      struct KeyHasher {
+        std::size_t operator()(const iroha::hash256_t &key) const {
+          std::size_t result;
+          std::memcpy(&result, key.data(), sizeof(result));
+          return result;
+        }
+      };
+
+      struct CacheState {
+        // the cache is trimmed to the low size when the high size is reached
+        static constexpr uint32_t kSizeHigh = 1u << 16;
+        static constexpr uint32_t kSizeLow = 3u << 14;
+
+        iroha::cache::Cache<iroha::hash256_t, bool, KeyHasher> cache{kSizeHigh,
+                                                                     kSizeLow};
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+      };
+
+      static CacheState &cacheState() {
+        static CacheState state;
+        return state;
+      }
+
+      /**
+       * @return digest of the signature, its public key and the signed data,
+       * which identifies the triple
+       */
+      static iroha::hash256_t cacheKey(const Signed &signedData,
+                                       const Blob &source,
+                                       const PublicKey &pubKey) {
+        // sizes of the key and the signature make the concatenation
+        // unambiguous
+        const uint64_t sizes[] = {pubKey.size(), signedData.size()};
+        std::vector<uint8_t> data(reinterpret_cast<const uint8_t *>(sizes),
+                                  reinterpret_cast<const uint8_t *>(sizes + 2));
+        data.reserve(data.size() + pubKey.size() + signedData.size()
+                     + source.size());
+        data.insert(data.end(), pubKey.blob().begin(), pubKey.blob().end());
+        data.insert(
+            data.end(), signedData.blob().begin(), signedData.blob().end());
+        data.insert(data.end(), source.blob().begin(), source.blob().end());
+        return iroha::sha3_256(data);
+      }
     };
   }  // namespace crypto
 }  // namespace shared_model
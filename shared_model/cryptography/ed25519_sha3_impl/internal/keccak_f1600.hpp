@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_KECCAK_F1600_HPP
+#define IROHA_KECCAK_F1600_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+/**
+ * Keccak-f[1600] permutation, which is shared by the translation units of the
+ * hash library. It is compiled with different instruction sets by them, so
+ * everything here has internal linkage: otherwise the linker could pick a
+ * copy, which uses instructions unsupported by the running CPU.
+ */
+namespace {
+  namespace keccak {
+
+    /// Keccak-f[1600] state is 5x5 lanes of 64 bits, lane (x, y) is x + 5 * y
+    constexpr size_t kStateLanes = 25;
+    constexpr size_t kRounds = 24;
+
+    constexpr uint64_t kRoundConstants[kRounds] = {
+        0x0000000000000001ull, 0x0000000000008082ull, 0x800000000000808aull,
+        0x8000000080008000ull, 0x000000000000808bull, 0x0000000080000001ull,
+        0x8000000080008081ull, 0x8000000000008009ull, 0x000000000000008aull,
+        0x0000000000000088ull, 0x0000000080008009ull, 0x000000008000000aull,
+        0x000000008000808bull, 0x800000000000008bull, 0x8000000000008089ull,
+        0x8000000000008003ull, 0x8000000000008002ull, 0x8000000000000080ull,
+        0x000000000000800aull, 0x800000008000000aull, 0x8000000080008081ull,
+        0x8000000000008080ull, 0x0000000080000001ull, 0x8000000080008008ull};
+
+    /// rotation offsets of the rho step
+    constexpr unsigned kRotations[kStateLanes] = {
+        0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+        25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14};
+
+    /// destination of each lane in the pi step: (x, y) -> (y, 2x + 3y)
+    constexpr size_t kPermutation[kStateLanes] = {
+        0,  10, 20, 5,  15, 16, 1,  11, 21, 6,  7,  17, 2,
+        12, 22, 23, 8,  18, 3,  13, 14, 24, 9,  19, 4};
+
+    /**
+     * Call f(std::integral_constant<size_t, I>) for I in [0, N), so that the
+     * loops of a round are unrolled and all the lanes are kept in registers
+     */
+    template <typename F, size_t... I>
+    inline void unroll(F &&f, std::index_sequence<I...>) {
+      (void)std::initializer_list<int>{
+          (f(std::integral_constant<size_t, I>{}), 0)...};
+    }
+
+    template <size_t N, typename F>
+    inline void unroll(F &&f) {
+      unroll(std::forward<F>(f), std::make_index_sequence<N>{});
+    }
+
+    /**
+     * Keccak-f[1600] permutation
+     * @tparam Ops - lane operations: type Lane, which is a single lane or a
+     * vector of lanes of several independent states, and static functions
+     * bitXor, bitAndNot, rotateLeft and broadcast over it
+     */
+    template <typename Ops>
+    void permute(typename Ops::Lane *lanes) {
+      using Lane = typename Ops::Lane;
+      Lane state[kStateLanes];
+      Lane columns[5];
+      Lane permuted[kStateLanes];
+      unroll<kStateLanes>([&](auto i) { state[i] = lanes[i]; });
+      for (size_t round = 0; round < kRounds; ++round) {
+        // theta
+        unroll<5>([&](auto x) {
+          columns[x] = Ops::bitXor(
+              Ops::bitXor(state[x], state[x + 5]),
+              Ops::bitXor(Ops::bitXor(state[x + 10], state[x + 15]),
+                          state[x + 20]));
+        });
+        unroll<5>([&](auto x) {
+          auto d = Ops::bitXor(columns[(x + 4) % 5],
+                               Ops::rotateLeft(columns[(x + 1) % 5], 1));
+          unroll<5>([&](auto y) {
+            state[x + 5 * y] = Ops::bitXor(state[x + 5 * y], d);
+          });
+        });
+        // rho and pi
+        unroll<kStateLanes>([&](auto i) {
+          permuted[kPermutation[i]] =
+              Ops::rotateLeft(state[i], kRotations[i]);
+        });
+        // chi
+        unroll<kStateLanes>([&](auto i) {
+          constexpr size_t x = i % 5, y = i - x;
+          state[i] = Ops::bitXor(permuted[i],
+                                 Ops::bitAndNot(permuted[(x + 1) % 5 + y],
+                                                permuted[(x + 2) % 5 + y]));
+        });
+        // iota
+        state[0] =
+            Ops::bitXor(state[0], Ops::broadcast(kRoundConstants[round]));
+      }
+      unroll<kStateLanes>([&](auto i) { lanes[i] = state[i]; });
+    }
+
+  }  // namespace keccak
+}  // namespace
+
+namespace iroha {
+  namespace detail {
+
+    /**
+     * Permute 4 Keccak-f[1600] states, which are stored lane by lane, with
+     * AVX2 instructions. Defined only when the hash library is built with
+     * IROHA_SHA3_AVX2, and must be called only when the CPU supports AVX2.
+     */
+    void keccakF1600x4(uint64_t (*state)[4]);
+
+  }  // namespace detail
+}  // namespace iroha
+
+#endif  // IROHA_KECCAK_F1600_HPP
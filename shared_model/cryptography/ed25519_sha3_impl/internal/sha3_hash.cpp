@@ -3,19 +3,248 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include <ed25519/ed25519/sha256.h>
-#include <ed25519/ed25519/sha512.h>
-
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "cryptography/ed25519_sha3_impl/internal/keccak_f1600.hpp"
+
+namespace {
+  using keccak::kStateLanes;
+
+  /// lane operations over a single state
+  struct ScalarLanes {
+    using Lane = uint64_t;
+
+    static inline Lane bitXor(Lane a, Lane b) {
+      return a ^ b;
+    }
+
+    static inline Lane bitAndNot(Lane a, Lane b) {
+      return ~a & b;
+    }
+
+    static inline Lane rotateLeft(Lane a, unsigned n) {
+      return n == 0 ? a : (a << n) | (a >> (64 - n));
+    }
+
+    static inline Lane broadcast(uint64_t a) {
+      return a;
+    }
+  };
+
+  /**
+   * Lane operations over 2 states with a portable vector, which compilers
+   * map to 128-bit SIMD registers of any target
+   */
+  struct PortableLanes {
+    typedef uint64_t Lane __attribute__((vector_size(2 * sizeof(uint64_t))));
+
+    static inline Lane bitXor(Lane a, Lane b) {
+      return a ^ b;
+    }
+
+    static inline Lane bitAndNot(Lane a, Lane b) {
+      return ~a & b;
+    }
+
+    static inline Lane rotateLeft(Lane a, unsigned n) {
+      return n == 0 ? a : (a << n) | (a >> (64 - n));
+    }
+
+    static inline Lane broadcast(uint64_t a) {
+      return Lane{} + a;
+    }
+  };
+
+  /// permute 2 states, which are stored lane by lane
+  void keccakF1600x2(uint64_t (*state)[2]) {
+    PortableLanes::Lane vectors[kStateLanes];
+    std::memcpy(vectors, state, sizeof(vectors));
+    keccak::permute<PortableLanes>(vectors);
+    std::memcpy(state, vectors, sizeof(vectors));
+  }
+
+#ifdef IROHA_SHA3_AVX2
+  /// whether the CPU can run the AVX2 permutation
+  bool avx2Supported() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+  }
+#endif
+
+  inline uint64_t load64(const uint8_t *bytes) {
+    uint64_t value = 0;
+    for (size_t i = 8; i-- > 0;) {
+      value = (value << 8) | bytes[i];
+    }
+    return value;
+  }
+
+  inline void store64(uint8_t *bytes, uint64_t value) {
+    for (size_t i = 0; i < 8; ++i) {
+      bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+  }
+
+  /**
+   * Copy the tail of a message, which is shorter than a block, and append
+   * SHA-3 padding to it
+   */
+  template <size_t kRate>
+  void padBlock(uint8_t *block, const uint8_t *tail, size_t size) {
+    std::memset(block, 0, kRate);
+    if (size > 0) {
+      std::memcpy(block, tail, size);
+    }
+    block[size] ^= 0x06;
+    block[kRate - 1] ^= 0x80;
+  }
+
+  /**
+   * SHA-3 sponge over a single state
+   * @tparam kRate - number of bytes absorbed per permutation
+   * @tparam kOutput - digest size in bytes
+   */
+  template <size_t kRate, size_t kOutput>
+  void sha3(uint8_t *output, const uint8_t *input, size_t size) {
+    uint64_t state[kStateLanes] = {};
+    auto absorb = [&state](const uint8_t *block) {
+      for (size_t i = 0; i < kRate / 8; ++i) {
+        state[i] ^= load64(block + 8 * i);
+      }
+      keccak::permute<ScalarLanes>(state);
+    };
+
+    for (; size >= kRate; input += kRate, size -= kRate) {
+      absorb(input);
+    }
+    uint8_t last[kRate];
+    padBlock<kRate>(last, input, size);
+    absorb(last);
+
+    for (size_t i = 0; i < kOutput / 8; ++i) {
+      store64(output + 8 * i, state[i]);
+    }
+  }
+
+  constexpr size_t kSha3_256Rate = 136;
+  constexpr size_t kSha3_256Output = 32;
+  constexpr size_t kSha3_512Rate = 72;
+  constexpr size_t kSha3_512Output = 64;
+
+  /**
+   * SHA3-256 sponge over up to kLanesNumber states, which are interleaved
+   * lane by lane and permuted at once. A message is absorbed while it has
+   * blocks, and its digest is taken after its last block.
+   * @tparam Permute - permutation of kLanesNumber interleaved states
+   */
+  template <size_t kLanesNumber,
+            void (*Permute)(uint64_t (*)[kLanesNumber])>
+  void sha3_256Interleaved(uint8_t *const *outputs,
+                           const uint8_t *const *inputs,
+                           const size_t *in_sizes,
+                           size_t count) {
+    constexpr size_t kRate = kSha3_256Rate;
+    uint64_t state[kStateLanes][kLanesNumber] = {};
+
+    size_t blocks[kLanesNumber] = {};
+    uint8_t last[kLanesNumber][kRate];
+    for (size_t j = 0; j < count; ++j) {
+      blocks[j] = in_sizes[j] / kRate + 1;
+      padBlock<kRate>(last[j],
+                      inputs[j] + (blocks[j] - 1) * kRate,
+                      in_sizes[j] % kRate);
+    }
+    const auto max_blocks = *std::max_element(blocks, blocks + count);
+
+    for (size_t k = 0; k < max_blocks; ++k) {
+      for (size_t j = 0; j < count; ++j) {
+        if (k >= blocks[j]) {
+          continue;
+        }
+        const auto *block =
+            k + 1 == blocks[j] ? last[j] : inputs[j] + k * kRate;
+        for (size_t i = 0; i < kRate / 8; ++i) {
+          state[i][j] ^= load64(block + 8 * i);
+        }
+      }
+      Permute(state);
+      for (size_t j = 0; j < count; ++j) {
+        if (k + 1 == blocks[j]) {
+          for (size_t i = 0; i < kSha3_256Output / 8; ++i) {
+            store64(outputs[j] + 8 * i, state[i][j]);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Hash messages in groups of kLanesNumber in the given order, and the last
+   * message, which does not fill a group, alone
+   */
+  template <size_t kLanesNumber,
+            void (*Permute)(uint64_t (*)[kLanesNumber])>
+  void sha3_256Groups(uint8_t *const *outputs,
+                      const uint8_t *const *inputs,
+                      const size_t *in_sizes,
+                      const std::vector<size_t> &order) {
+    uint8_t *group_outputs[kLanesNumber];
+    const uint8_t *group_inputs[kLanesNumber];
+    size_t group_sizes[kLanesNumber];
+    for (size_t begin = 0; begin < order.size(); begin += kLanesNumber) {
+      const auto group = std::min(kLanesNumber, order.size() - begin);
+      if (group == 1) {
+        const auto i = order[begin];
+        sha3<kSha3_256Rate, kSha3_256Output>(
+            outputs[i], inputs[i], in_sizes[i]);
+        break;
+      }
+      for (size_t j = 0; j < group; ++j) {
+        const auto i = order[begin + j];
+        group_outputs[j] = outputs[i];
+        group_inputs[j] = inputs[i];
+        group_sizes[j] = in_sizes[i];
+      }
+      sha3_256Interleaved<kLanesNumber, Permute>(
+          group_outputs, group_inputs, group_sizes, group);
+    }
+  }
+}  // namespace
+
 namespace iroha {
 
   void sha3_256(uint8_t *output, const uint8_t *input, size_t in_size) {
-    sha256(output, input, in_size);
+    sha3<kSha3_256Rate, kSha3_256Output>(output, input, in_size);
   }
 
   void sha3_512(uint8_t *output, const uint8_t *input, size_t in_size) {
-    sha512(output, input, in_size);
+    sha3<kSha3_512Rate, kSha3_512Output>(output, input, in_size);
+  }
+
+  void sha3_256(uint8_t *const *outputs,
+                const uint8_t *const *inputs,
+                const size_t *in_sizes,
+                size_t count) {
+    // messages of the same number of blocks are hashed together, so that
+    // the states of a group finish at once
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [in_sizes](auto lhs, auto rhs) {
+      return in_sizes[lhs] < in_sizes[rhs];
+    });
+
+#ifdef IROHA_SHA3_AVX2
+    if (avx2Supported()) {
+      sha3_256Groups<4, detail::keccakF1600x4>(
+          outputs, inputs, in_sizes, order);
+      return;
+    }
+#endif
+    sha3_256Groups<2, keccakF1600x2>(outputs, inputs, in_sizes, order);
   }
 
   hash256_t sha3_256(const uint8_t *input, size_t in_size) {
@@ -16,6 +16,20 @@ namespace iroha {
   void sha3_256(uint8_t *output, const uint8_t *input, size_t in_size);
   void sha3_512(uint8_t *output, const uint8_t *input, size_t in_size);
 
+  /**
+   * Compute SHA3-256 of several messages at once, which is faster than
+   * hashing them one by one: the states of several messages are permuted
+   * together by vector instructions
+   * @param outputs - buffers of 32 bytes for the digests of the inputs
+   * @param inputs - messages to hash
+   * @param in_sizes - sizes of the messages
+   * @param count - number of messages
+   */
+  void sha3_256(uint8_t *const *outputs,
+                const uint8_t *const *inputs,
+                const size_t *in_sizes,
+                size_t count);
+
   hash256_t sha3_256(const uint8_t *input, size_t in_size);
   hash256_t sha3_256(const std::string &msg);
   hash256_t sha3_256(const std::vector<uint8_t> &msg);
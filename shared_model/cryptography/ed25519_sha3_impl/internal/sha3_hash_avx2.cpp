@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/ed25519_sha3_impl/internal/keccak_f1600.hpp"
+
+#include <cstring>
+
+#include <immintrin.h>
+
+// This file is compiled with -mavx2. Its code is called only after a run
+// time check of the CPU, so it must not define anything with external
+// linkage besides the entry point.
+
+namespace {
+  struct Avx2Lanes {
+    using Lane = __m256i;
+
+    static inline Lane bitXor(Lane a, Lane b) {
+      return _mm256_xor_si256(a, b);
+    }
+
+    static inline Lane bitAndNot(Lane a, Lane b) {
+      return _mm256_andnot_si256(a, b);
+    }
+
+    static inline Lane rotateLeft(Lane a, unsigned n) {
+      return n == 0 ? a
+                    : _mm256_or_si256(
+                          _mm256_sll_epi64(a, _mm_cvtsi32_si128(n)),
+                          _mm256_srl_epi64(a, _mm_cvtsi32_si128(64 - n)));
+    }
+
+    static inline Lane broadcast(uint64_t a) {
+      return _mm256_set1_epi64x(a);
+    }
+  };
+}  // namespace
+
+namespace iroha {
+  namespace detail {
+
+    void keccakF1600x4(uint64_t (*state)[4]) {
+      __m256i vectors[keccak::kStateLanes];
+      std::memcpy(vectors, state, sizeof(vectors));
+      keccak::permute<Avx2Lanes>(vectors);
+      std::memcpy(state, vectors, sizeof(vectors));
+    }
+
+  }  // namespace detail
+}  // namespace iroha
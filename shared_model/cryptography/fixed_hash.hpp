@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_FIXED_HASH_HPP
+#define IROHA_SHARED_MODEL_FIXED_HASH_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "cryptography/hash.hpp"
+
+namespace shared_model {
+  namespace crypto {
+    /**
+     * Hash value of a fixed capacity, which is stored inline. Unlike Hash it
+     * never allocates and does not keep a hex representation, so it is meant
+     * to be a key of containers on hot paths.
+     * Capacity is enough for SHA3-256 hashes, which are used for transactions
+     * and blocks.
+     */
+    class FixedHash {
+     public:
+      static constexpr std::size_t kMaxSize = 32;
+
+      /**
+       * Mixes all the bytes of the hash word by word, which is much cheaper
+       * than a byte-wise hash of a variable length blob
+       */
+      struct Hasher {
+        std::size_t operator()(const FixedHash &h) const noexcept {
+          std::uint64_t words[kMaxSize / sizeof(std::uint64_t)];
+          std::memcpy(words, h.bytes_.data(), kMaxSize);
+          std::uint64_t result = h.size_;
+          for (auto word : words) {
+            result = (result ^ word) * 0x9E3779B97F4A7C15ull;
+            result ^= result >> 32;
+          }
+          return static_cast<std::size_t>(result);
+        }
+      };
+
+      FixedHash() = default;
+
+      /**
+       * @param blob - hash to copy, must not be longer than kMaxSize
+       * @throws std::length_error if the blob is longer than kMaxSize
+       */
+      explicit FixedHash(const Blob &blob) {
+        if (blob.size() > kMaxSize) {
+          throw std::length_error("FixedHash: blob of "
+                                  + std::to_string(blob.size())
+                                  + " bytes exceeds capacity");
+        }
+        size_ = static_cast<std::uint8_t>(blob.size());
+        std::memcpy(bytes_.data(), blob.blob().data(), size_);
+      }
+
+      const std::uint8_t *data() const {
+        return bytes_.data();
+      }
+
+      std::size_t size() const {
+        return size_;
+      }
+
+      /**
+       * @return the value as Hash
+       */
+      Hash toHash() const {
+        return Hash(Blob(Blob::Bytes(bytes_.begin(), bytes_.begin() + size_)));
+      }
+
+      bool operator==(const FixedHash &rhs) const {
+        return size_ == rhs.size_ and bytes_ == rhs.bytes_;
+      }
+
+      bool operator!=(const FixedHash &rhs) const {
+        return not(*this == rhs);
+      }
+
+      bool operator<(const FixedHash &rhs) const {
+        return size_ < rhs.size_
+            or (size_ == rhs.size_ and bytes_ < rhs.bytes_);
+      }
+
+     private:
+      std::array<std::uint8_t, kMaxSize> bytes_{};
+      std::uint8_t size_{0};
+    };
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_FIXED_HASH_HPP
@@ -6,6 +6,8 @@
 #ifndef IROHA_SHARED_MODEL_SHA3_256_HPP
 #define IROHA_SHARED_MODEL_SHA3_256_HPP
 
+#include <vector>
+
 #include "crypto/hash_types.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 #include "cryptography/hash.hpp"
@@ -17,6 +19,36 @@ namespace shared_model {
       static Hash makeHash(const Blob &blob) {
         return Hash(iroha::sha3_256(blob.blob()).to_string());
       }
+
+      /**
+       * Hash several blobs at once, which is faster than one by one
+       * @param blobs - blobs to hash
+       * @return hashes of the blobs in the same order
+       */
+      static std::vector<Hash> makeHashes(
+          const std::vector<const Blob *> &blobs) {
+        std::vector<iroha::hash256_t> digests(blobs.size());
+        std::vector<uint8_t *> outputs;
+        std::vector<const uint8_t *> inputs;
+        std::vector<size_t> sizes;
+        outputs.reserve(blobs.size());
+        inputs.reserve(blobs.size());
+        sizes.reserve(blobs.size());
+        for (size_t i = 0; i < blobs.size(); ++i) {
+          outputs.push_back(digests[i].data());
+          inputs.push_back(blobs[i]->blob().data());
+          sizes.push_back(blobs[i]->blob().size());
+        }
+        iroha::sha3_256(
+            outputs.data(), inputs.data(), sizes.data(), blobs.size());
+
+        std::vector<Hash> hashes;
+        hashes.reserve(digests.size());
+        for (const auto &digest : digests) {
+          hashes.emplace_back(digest.to_string());
+        }
+        return hashes;
+      }
     };
   }  // namespace crypto
 }  // namespace shared_model
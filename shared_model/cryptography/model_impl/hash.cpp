@@ -8,6 +8,7 @@
 #include <boost/functional/hash.hpp>
 
 #include "common/byteutils.hpp"
+#include "cryptography/fixed_hash.hpp"
 namespace shared_model {
   namespace crypto {
 
@@ -29,6 +30,10 @@ namespace shared_model {
     }
 
     std::size_t Hash::Hasher::operator()(const Hash &h) const {
+      if (h.size() <= FixedHash::kMaxSize) {
+        return FixedHash::Hasher{}(FixedHash(h));
+      }
+
       using boost::hash_combine;
       using boost::hash_value;
 
@@ -8,7 +8,7 @@
 
 #include "interfaces/base/model_primitive.hpp"
 
-#include <boost/multiprecision/cpp_int.hpp>
+#include "interfaces/common_objects/fixed_point.hpp"
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
@@ -19,17 +19,24 @@ namespace shared_model {
      */
     class Amount final : public ModelPrimitive<Amount> {
      public:
+      /**
+       * @param amount - number of the form "123" or "123.456"; any other
+       * string makes a zero amount
+       */
       explicit Amount(const std::string &amount);
       explicit Amount(std::string &&amount);
 
+      explicit Amount(const FixedPoint &value);
+
       Amount(const Amount &o);
       Amount(Amount &&o) noexcept;
 
       /**
-       * Gets integer representation value, which ignores precision
-       * @return amount represented as integer value, which ignores precision
+       * Gets the value of the amount
+       * @return fixed point number with the precision of the amount, or none
+       * if all its digits do not fit 256 bits
        */
-      const boost::multiprecision::uint256_t &intValue() const;
+      const boost::optional<FixedPoint> &value() const;
 
       /**
        * Gets the position of precision
@@ -59,10 +66,12 @@ namespace shared_model {
       Amount *clone() const override;
 
      private:
-      const std::string amount_;
+      Amount(boost::optional<FixedPoint> value, std::string oversized);
 
-      interface::types::PrecisionType precision_;
-      const boost::multiprecision::uint256_t multiprecision_repr_;
+      const boost::optional<FixedPoint> value_;
+      // a number, which does not fit the value, is kept as a string, so that
+      // the storage can report the overflow; it is empty otherwise
+      const std::string oversized_;
     };
   }  // namespace interface
 }  // namespace shared_model
@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_FIXED_POINT_HPP
+#define IROHA_SHARED_MODEL_FIXED_POINT_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+
+    /**
+     * Unsigned decimal fixed point number: a 256-bit integer of all its
+     * digits and the number of digits after the point. It is parsed and
+     * formatted by hand and never allocates, so it is cheap to create and
+     * copy.
+     */
+    class FixedPoint {
+     public:
+      static constexpr size_t kWordsNumber = 4;
+
+      /// digits as an integer, the least significant word first
+      using Words = std::array<uint64_t, kWordsNumber>;
+
+      /// zero without digits after the point
+      FixedPoint() = default;
+
+      /**
+       * @param words - digits as an integer
+       * @param precision - number of digits after the point
+       */
+      FixedPoint(const Words &words, types::PrecisionType precision);
+
+      /**
+       * Parse a number of the form "123" or "123.456"
+       * @param str - string to parse
+       * @return parsed number, or none if the string has another form, has
+       * more than 255 digits after the point or does not fit 256 bits
+       */
+      static boost::optional<FixedPoint> fromString(const std::string &str);
+
+      /**
+       * @return the number with exactly precision() digits after the point,
+       * e.g. "0.50" for 50 with precision 2
+       */
+      std::string toString() const;
+
+      const Words &words() const;
+
+      types::PrecisionType precision() const;
+
+      bool isZero() const;
+
+      /**
+       * Change the number of digits after the point
+       * @param precision - new number of digits after the point
+       * @return the same number, or none if digits would be lost or it does
+       * not fit 256 bits
+       */
+      boost::optional<FixedPoint> withPrecision(
+          types::PrecisionType precision) const;
+
+      /**
+       * Checked addition
+       * @return the sum with the greater precision of the operands, or none
+       * if it does not fit 256 bits
+       */
+      boost::optional<FixedPoint> add(const FixedPoint &rhs) const;
+
+      /**
+       * Checked subtraction
+       * @return the difference with the greater precision of the operands,
+       * or none if it is negative or does not fit 256 bits
+       */
+      boost::optional<FixedPoint> subtract(const FixedPoint &rhs) const;
+
+      /**
+       * Compare values of the numbers regardless of their precisions
+       * @return negative, zero or positive if this number is less, equal or
+       * greater than rhs
+       */
+      int compare(const FixedPoint &rhs) const;
+
+      /// numbers are equal only if their precisions are equal too
+      bool operator==(const FixedPoint &rhs) const;
+      bool operator!=(const FixedPoint &rhs) const;
+
+     private:
+      Words words_{};
+      types::PrecisionType precision_{0};
+    };
+
+  }  // namespace interface
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_FIXED_POINT_HPP
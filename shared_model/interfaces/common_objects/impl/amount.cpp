@@ -5,64 +5,82 @@
 
 #include "interfaces/common_objects/amount.hpp"
 
-#include <regex>
+#include <algorithm>
+#include <limits>
 
 #include "utils/string_builder.hpp"
 
+namespace {
+  /**
+   * @return precision of a number of the form "123" or "123.456" regardless
+   * of its size, or none if the string has another form
+   */
+  boost::optional<shared_model::interface::types::PrecisionType> precisionOf(
+      const std::string &str) {
+    const auto point = str.find('.');
+    const auto is_digit = [](char c) { return c >= '0' and c <= '9'; };
+    if (point == std::string::npos) {
+      if (str.empty() or not std::all_of(str.begin(), str.end(), is_digit)) {
+        return boost::none;
+      }
+      return 0;
+    }
+    const auto precision = str.size() - point - 1;
+    if (point == 0 or precision == 0
+        or precision > std::numeric_limits<
+                           shared_model::interface::types::PrecisionType>::max()
+        or not std::all_of(str.begin(), str.begin() + point, is_digit)
+        or not std::all_of(str.begin() + point + 1, str.end(), is_digit)) {
+      return boost::none;
+    }
+    return precision;
+  }
+}  // namespace
+
 namespace shared_model {
   namespace interface {
-    Amount::Amount(const std::string &amount) : Amount(std::string(amount)) {}
-    Amount::Amount(std::string &&amount)
-        : amount_(std::move(amount)),
-          precision_(0),
-          multiprecision_repr_([this] {
-            static const std::regex r("([0-9]+)(\\.([0-9]+))?");
-            // 123.456 will have the following groups:
-            //   [0] -> 123.456, [1] -> 123
-            //   [2] -> .456,    [3] -> 456
-            std::smatch match;
-            if (std::regex_match(this->amount_, match, r)
-                && match.size() == 4) {
-              this->precision_ = match[3].length();
-              auto str = match[0].str();
-              size_t pos = match[1].length();
-              // remove dot if it exist
-              if (pos < str.size()) {
-                str.erase(str.begin() + pos);
-              }
-              // remove leading zeroes
-              str.erase(0,
-                        std::min(str.find_first_not_of('0'), str.size() - 1));
-              return boost::multiprecision::uint256_t(str);
+    Amount::Amount(const std::string &amount)
+        : Amount([&amount]() -> Amount {
+            if (auto value = FixedPoint::fromString(amount)) {
+              return Amount(value, {});
+            }
+            if (precisionOf(amount)) {
+              return Amount(boost::none, amount);
             }
-            return std::numeric_limits<boost::multiprecision::uint256_t>::min();
+            return Amount(FixedPoint{}, {});
           }()) {}
 
-    Amount::Amount(const Amount &o) : Amount(std::string(o.amount_)) {}
+    Amount::Amount(std::string &&amount) : Amount(amount) {}
+
+    Amount::Amount(const FixedPoint &value) : Amount(value, {}) {}
+
+    Amount::Amount(boost::optional<FixedPoint> value, std::string oversized)
+        : value_(std::move(value)), oversized_(std::move(oversized)) {}
+
+    Amount::Amount(const Amount &o) = default;
 
-    Amount::Amount(Amount &&o) noexcept
-        : Amount(std::move(const_cast<std::string &>(o.amount_))) {}
+    Amount::Amount(Amount &&o) noexcept = default;
 
-    const boost::multiprecision::uint256_t &Amount::intValue() const {
-      return multiprecision_repr_;
+    const boost::optional<FixedPoint> &Amount::value() const {
+      return value_;
     }
 
     types::PrecisionType Amount::precision() const {
-      return precision_;
+      return value_ ? value_->precision() : *precisionOf(oversized_);
     }
 
     std::string Amount::toStringRepr() const {
-      return amount_;
+      return value_ ? value_->toString() : oversized_;
     }
 
     bool Amount::operator==(const ModelType &rhs) const {
-      return amount_ == rhs.amount_;
+      return value_ == rhs.value_ and oversized_ == rhs.oversized_;
     }
 
     std::string Amount::toString() const {
       return detail::PrettyStringBuilder()
           .init("Amount")
-          .append("value", amount_)
+          .append("value", toStringRepr())
           .finalize();
     }
 
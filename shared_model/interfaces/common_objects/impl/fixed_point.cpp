@@ -0,0 +1,270 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "interfaces/common_objects/fixed_point.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+  using Words = shared_model::interface::FixedPoint::Words;
+  using Uint128 = unsigned __int128;
+
+  /// the greatest power of ten, which fits a word
+  constexpr uint64_t kChunkBase = 10000000000000000000ull;
+  constexpr size_t kChunkDigits = 19;
+
+  uint64_t powerOfTen(size_t power) {
+    uint64_t result = 1;
+    while (power-- > 0) {
+      result *= 10;
+    }
+    return result;
+  }
+
+  /**
+   * words = words * factor + addend
+   * @return false if the result does not fit
+   */
+  bool multiplyAdd(Words &words, uint64_t factor, uint64_t addend) {
+    uint64_t carry = addend;
+    for (auto &word : words) {
+      Uint128 result = static_cast<Uint128>(word) * factor + carry;
+      word = static_cast<uint64_t>(result);
+      carry = static_cast<uint64_t>(result >> 64);
+    }
+    return carry == 0;
+  }
+
+  /**
+   * words = words / divisor
+   * @return remainder of the division
+   */
+  uint64_t divide(Words &words, uint64_t divisor) {
+    Uint128 remainder = 0;
+    for (auto word = words.rbegin(); word != words.rend(); ++word) {
+      if (remainder == 0 and *word < divisor) {
+        // skips the wide division for the leading words
+        remainder = *word;
+        *word = 0;
+        continue;
+      }
+      Uint128 current = (remainder << 64) | *word;
+      *word = static_cast<uint64_t>(current / divisor);
+      remainder = current % divisor;
+    }
+    return static_cast<uint64_t>(remainder);
+  }
+
+  /**
+   * words = words * 10^power
+   * @return false if the result does not fit
+   */
+  bool scale(Words &words, size_t power) {
+    while (power > 0) {
+      auto digits = std::min(power, kChunkDigits);
+      if (not multiplyAdd(words, powerOfTen(digits), 0)) {
+        return false;
+      }
+      power -= digits;
+    }
+    return true;
+  }
+
+  bool isZero(const Words &words) {
+    return std::all_of(
+        words.begin(), words.end(), [](auto word) { return word == 0; });
+  }
+
+  int compare(const Words &lhs, const Words &rhs) {
+    for (size_t i = lhs.size(); i-- > 0;) {
+      if (lhs[i] != rhs[i]) {
+        return lhs[i] < rhs[i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * lhs = lhs + rhs
+   * @return false if the result does not fit
+   */
+  bool add(Words &lhs, const Words &rhs) {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      Uint128 result = static_cast<Uint128>(lhs[i]) + rhs[i] + carry;
+      lhs[i] = static_cast<uint64_t>(result);
+      carry = static_cast<uint64_t>(result >> 64);
+    }
+    return carry == 0;
+  }
+
+  /**
+   * lhs = lhs - rhs
+   * @return false if the result is negative
+   */
+  bool subtract(Words &lhs, const Words &rhs) {
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      Uint128 result = static_cast<Uint128>(lhs[i]) - rhs[i] - borrow;
+      lhs[i] = static_cast<uint64_t>(result);
+      borrow = (result >> 64) != 0 ? 1 : 0;
+    }
+    return borrow == 0;
+  }
+}  // namespace
+
+namespace shared_model {
+  namespace interface {
+
+    FixedPoint::FixedPoint(const Words &words, types::PrecisionType precision)
+        : words_(words), precision_(precision) {}
+
+    boost::optional<FixedPoint> FixedPoint::fromString(
+        const std::string &str) {
+      const auto point = str.find('.');
+      const auto integer_digits =
+          point == std::string::npos ? str.size() : point;
+      const auto fraction_digits =
+          point == std::string::npos ? 0 : str.size() - point - 1;
+      if (integer_digits == 0
+          or (point != std::string::npos and fraction_digits == 0)
+          or fraction_digits
+              > std::numeric_limits<types::PrecisionType>::max()) {
+        return boost::none;
+      }
+
+      // digits are accumulated in chunks, which fit a word
+      Words words{};
+      uint64_t chunk = 0;
+      size_t chunk_digits = 0;
+      for (size_t i = 0; i < str.size(); ++i) {
+        if (i == point) {
+          continue;
+        }
+        const auto c = str[i];
+        if (c < '0' or c > '9') {
+          return boost::none;
+        }
+        chunk = chunk * 10 + (c - '0');
+        if (++chunk_digits == kChunkDigits) {
+          if (not multiplyAdd(words, kChunkBase, chunk)) {
+            return boost::none;
+          }
+          chunk = 0;
+          chunk_digits = 0;
+        }
+      }
+      if (chunk_digits > 0
+          and not multiplyAdd(words, powerOfTen(chunk_digits), chunk)) {
+        return boost::none;
+      }
+      return FixedPoint(words, fraction_digits);
+    }
+
+    std::string FixedPoint::toString() const {
+      // digits from the least significant one
+      std::string digits;
+      auto words = words_;
+      do {
+        auto chunk = divide(words, kChunkBase);
+        for (size_t i = 0; i < kChunkDigits; ++i) {
+          digits.push_back('0' + chunk % 10);
+          chunk /= 10;
+        }
+      } while (not ::isZero(words));
+
+      const size_t min_digits = precision_ + 1u;
+      while (digits.size() > min_digits and digits.back() == '0') {
+        digits.pop_back();
+      }
+      digits.resize(std::max(digits.size(), min_digits), '0');
+
+      std::string result(digits.rbegin(), digits.rend());
+      if (precision_ > 0) {
+        result.insert(result.size() - precision_, 1, '.');
+      }
+      return result;
+    }
+
+    const FixedPoint::Words &FixedPoint::words() const {
+      return words_;
+    }
+
+    types::PrecisionType FixedPoint::precision() const {
+      return precision_;
+    }
+
+    bool FixedPoint::isZero() const {
+      return ::isZero(words_);
+    }
+
+    boost::optional<FixedPoint> FixedPoint::withPrecision(
+        types::PrecisionType precision) const {
+      auto words = words_;
+      if (precision >= precision_) {
+        if (not scale(words, precision - precision_)) {
+          return boost::none;
+        }
+        return FixedPoint(words, precision);
+      }
+
+      size_t power = precision_ - precision;
+      while (power > 0) {
+        auto digits = std::min(power, kChunkDigits);
+        if (divide(words, powerOfTen(digits)) != 0) {
+          return boost::none;
+        }
+        power -= digits;
+      }
+      return FixedPoint(words, precision);
+    }
+
+    boost::optional<FixedPoint> FixedPoint::add(const FixedPoint &rhs) const {
+      const auto precision = std::max(precision_, rhs.precision_);
+      auto lhs_aligned = withPrecision(precision);
+      auto rhs_aligned = rhs.withPrecision(precision);
+      if (not lhs_aligned or not rhs_aligned
+          or not ::add(lhs_aligned->words_, rhs_aligned->words_)) {
+        return boost::none;
+      }
+      return lhs_aligned;
+    }
+
+    boost::optional<FixedPoint> FixedPoint::subtract(
+        const FixedPoint &rhs) const {
+      const auto precision = std::max(precision_, rhs.precision_);
+      auto lhs_aligned = withPrecision(precision);
+      auto rhs_aligned = rhs.withPrecision(precision);
+      if (not lhs_aligned or not rhs_aligned
+          or not ::subtract(lhs_aligned->words_, rhs_aligned->words_)) {
+        return boost::none;
+      }
+      return lhs_aligned;
+    }
+
+    int FixedPoint::compare(const FixedPoint &rhs) const {
+      if (precision_ == rhs.precision_) {
+        return ::compare(words_, rhs.words_);
+      }
+      // a number which does not fit after scaling is greater than any other
+      if (precision_ < rhs.precision_) {
+        auto lhs_aligned = withPrecision(rhs.precision_);
+        return lhs_aligned ? ::compare(lhs_aligned->words_, rhs.words_) : 1;
+      }
+      auto rhs_aligned = rhs.withPrecision(precision_);
+      return rhs_aligned ? ::compare(words_, rhs_aligned->words_) : -1;
+    }
+
+    bool FixedPoint::operator==(const FixedPoint &rhs) const {
+      return precision_ == rhs.precision_ and words_ == rhs.words_;
+    }
+
+    bool FixedPoint::operator!=(const FixedPoint &rhs) const {
+      return not(*this == rhs);
+    }
+
+  }  // namespace interface
+}  // namespace shared_model
@@ -26,6 +26,18 @@ namespace shared_model {
       virtual iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
           Transport transport) const = 0;
 
+      /**
+       * Build the object over a shared transport, which is possibly owned by
+       * an arena together with other objects. Implementations are expected
+       * to reference the transport instead of copying it.
+       * @param transport - shared transport
+       * @return built object or error
+       */
+      virtual iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          std::shared_ptr<Transport> transport) const {
+        return build(Transport(*transport));
+      }
+
       virtual ~AbstractTransportFactory() = default;
     };
 
@@ -14,6 +14,7 @@
 namespace shared_model {
   namespace interface {
     class Block;
+    class Transaction;
     /**
      * BlockJsonDeserializer is an interface which allows transforming json
      * string to block objects.
@@ -28,6 +29,16 @@ namespace shared_model {
       virtual iroha::expected::Result<std::unique_ptr<Block>, std::string>
       deserialize(const types::JsonType &json) const noexcept = 0;
 
+      /**
+       * Try to parse json string of a single transaction of a block
+       * @param json - part of json string of a block, which is located by
+       * BlockJsonSerializer::transactionPositions
+       * @return pointer to a transaction if json was valid or an error
+       */
+      virtual iroha::expected::Result<std::unique_ptr<Transaction>,
+                                      std::string>
+      deserializeTransaction(const types::JsonType &json) const noexcept = 0;
+
       virtual ~BlockJsonDeserializer() = default;
     };
   }  // namespace interface
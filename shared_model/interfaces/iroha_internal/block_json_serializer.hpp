@@ -7,6 +7,7 @@
 #define IROHA_BLOCK_JSON_SERIALIZER_HPP
 
 #include <memory>
+#include <vector>
 
 #include "common/result.hpp"
 #include "interfaces/common_objects/types.hpp"
@@ -28,6 +29,24 @@ namespace shared_model {
       virtual iroha::expected::Result<types::JsonType, std::string>
       serialize(const Block &block) const noexcept = 0;
 
+      /**
+       * Position of json of a transaction inside json of its block
+       */
+      struct TransactionPosition {
+        size_t offset;
+        size_t size;
+      };
+
+      /**
+       * Find transactions in json of a block, so that they can be read and
+       * deserialized without the rest of the block
+       * @param json - json string, which was made by serialize()
+       * @return positions of transactions in order of the block or an error
+       */
+      virtual iroha::expected::Result<std::vector<TransactionPosition>,
+                                      std::string>
+      transactionPositions(const types::JsonType &json) const noexcept = 0;
+
       virtual ~BlockJsonSerializer() = default;
     };
   }  // namespace interface
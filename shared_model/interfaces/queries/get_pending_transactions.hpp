@@ -6,11 +6,13 @@
 #ifndef IROHA_SHARED_MODEL_GET_PENDING_TRANSACTIONS_HPP
 #define IROHA_SHARED_MODEL_GET_PENDING_TRANSACTIONS_HPP
 
+#include <boost/optional.hpp>
 #include "interfaces/base/model_primitive.hpp"
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
   namespace interface {
+    class TxPaginationMeta;
 
     /**
      * Get all pending (not fully signed) multisignature transactions or batches
@@ -19,6 +21,14 @@ namespace shared_model {
     class GetPendingTransactions
         : public ModelPrimitive<GetPendingTransactions> {
      public:
+      /**
+       * Get the query pagination metadata
+       * @return pagination metadata, or none if all the pending transactions
+       * are requested at once
+       */
+      virtual boost::optional<const TxPaginationMeta &> paginationMeta()
+          const = 0;
+
       std::string toString() const override;
 
       bool operator==(const ModelType &rhs) const override;
@@ -5,17 +5,27 @@
 
 #include "interfaces/queries/get_pending_transactions.hpp"
 
+#include "interfaces/queries/tx_pagination_meta.hpp"
+
 namespace shared_model {
   namespace interface {
 
     std::string GetPendingTransactions::toString() const {
-      return detail::PrettyStringBuilder()
-          .init("GetPendingTransactions")
-          .finalize();
+      auto pretty_builder =
+          detail::PrettyStringBuilder().init("GetPendingTransactions");
+      if (auto pagination_meta = paginationMeta()) {
+        pretty_builder.append("pagination_meta", pagination_meta->toString());
+      }
+      return pretty_builder.finalize();
     }
 
     bool GetPendingTransactions::operator==(const ModelType &rhs) const {
-      return true;
+      auto lhs_meta = paginationMeta();
+      auto rhs_meta = rhs.paginationMeta();
+      if (lhs_meta and rhs_meta) {
+        return *lhs_meta == *rhs_meta;
+      }
+      return not lhs_meta and not rhs_meta;
     }
 
   }  // namespace interface
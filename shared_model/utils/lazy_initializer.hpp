@@ -0,0 +1,85 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LAZY_INITIALIZER_HPP
+#define IROHA_LAZY_INITIALIZER_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <boost/optional.hpp>
+
+namespace shared_model {
+  namespace detail {
+    /**
+     * Lazy class for lazy converting one type to another.
+     * The value is generated on the first access and then cached; concurrent
+     * first accesses from several threads are safe and run the generator
+     * exactly once.
+     * @tparam Target - output type
+     */
+    template <typename Target>
+    class LazyInitializer {
+     public:
+      using GeneratorType = std::function<Target()>;
+
+      explicit LazyInitializer(GeneratorType generator)
+          : generator_(std::move(generator)),
+            flag_(std::make_unique<std::once_flag>()) {}
+
+      const Target &operator*() const {
+        return *ptr();
+      }
+
+      const Target *operator->() const {
+        return ptr();
+      }
+
+      const Target *ptr() const {
+        std::call_once(*flag_, [this] { target_value_.emplace(generator_()); });
+        return target_value_.get_ptr();
+      }
+
+      /**
+       * Set the value, which has been computed elsewhere, e.g. together with
+       * values of other objects. Does nothing if the value is already there.
+       * @param value - the value, which the generator would return
+       */
+      void initialize(Target value) const {
+        std::call_once(*flag_, [this, &value] {
+          target_value_.emplace(std::move(value));
+        });
+      }
+
+      /**
+       * Drop the cached value, so it will be generated again on the next
+       * access. Must not be called concurrently with any other method.
+       */
+      void invalidate() {
+        target_value_ = boost::none;
+        flag_ = std::make_unique<std::once_flag>();
+      }
+
+     private:
+      GeneratorType generator_;
+      mutable std::unique_ptr<std::once_flag> flag_;
+      mutable boost::optional<Target> target_value_;
+    };
+
+    /**
+     * Function for creating lazy object
+     * @tparam Generator - type of generator
+     * @param generator - instance of Generator
+     * @return initialized lazy value
+     */
+    template <typename Generator>
+    auto makeLazyInitializer(Generator &&generator) {
+      using targetType = decltype(generator());
+      return LazyInitializer<targetType>(std::forward<Generator>(generator));
+    }
+  }  // namespace detail
+}  // namespace shared_model
+#endif  // IROHA_LAZY_INITIALIZER_HPP
@@ -0,0 +1,205 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <cstddef>
+
+namespace {
+
+  // character classes are spelled out explicitly so that the result does not
+  // depend on the current locale, just like the classes of ECMAScript regex
+
+  inline bool isDigit(char c) {
+    return c >= '0' and c <= '9';
+  }
+
+  inline bool isLower(char c) {
+    return c >= 'a' and c <= 'z';
+  }
+
+  inline bool isAlpha(char c) {
+    return isLower(c) or (c >= 'A' and c <= 'Z');
+  }
+
+  inline bool isAlnum(char c) {
+    return isAlpha(c) or isDigit(c);
+  }
+
+  inline bool isHexDigit(char c) {
+    return isDigit(c) or (c >= 'a' and c <= 'f') or (c >= 'A' and c <= 'F');
+  }
+
+  /// [a-z_0-9]{1,max_length} over [begin, end)
+  inline bool isLowerName(const char *begin,
+                          const char *end,
+                          std::size_t max_length) {
+    const auto length = static_cast<std::size_t>(end - begin);
+    if (length == 0 or length > max_length) {
+      return false;
+    }
+    for (; begin != end; ++begin) {
+      const auto c = *begin;
+      if (not(isLower(c) or isDigit(c) or c == '_')) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])? over [begin, end)
+  inline bool isDomainLabel(const char *begin, const char *end) {
+    const auto length = end - begin;
+    if (length == 0 or length > 63) {
+      return false;
+    }
+    if (not isAlpha(*begin) or not isAlnum(*(end - 1))) {
+      return false;
+    }
+    for (++begin; begin < end - 1; ++begin) {
+      if (not(isAlnum(*begin) or *begin == '-')) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// (label\.)*label over [begin, end)
+  inline bool isDomain(const char *begin, const char *end) {
+    auto label_begin = begin;
+    for (auto it = begin; it != end; ++it) {
+      if (*it == '.') {
+        if (not isDomainLabel(label_begin, it)) {
+          return false;
+        }
+        label_begin = it + 1;
+      }
+    }
+    return isDomainLabel(label_begin, end);
+  }
+
+  /**
+   * Decimal number in [0, max_value] without leading zeroes over [begin, end)
+   */
+  inline bool isDecimal(const char *begin,
+                        const char *end,
+                        std::size_t max_digits,
+                        unsigned max_value) {
+    const auto length = static_cast<std::size_t>(end - begin);
+    if (length == 0 or length > max_digits) {
+      return false;
+    }
+    if (*begin == '0' and length > 1) {
+      return false;
+    }
+    unsigned value = 0;
+    for (; begin != end; ++begin) {
+      if (not isDigit(*begin)) {
+        return false;
+      }
+      value = value * 10 + static_cast<unsigned>(*begin - '0');
+    }
+    return value <= max_value;
+  }
+
+  /// four dot-separated octets over [begin, end)
+  inline bool isIpV4(const char *begin, const char *end) {
+    std::size_t octets = 0;
+    auto octet_begin = begin;
+    for (auto it = begin; it != end; ++it) {
+      if (*it == '.') {
+        if (++octets > 3 or not isDecimal(octet_begin, it, 3, 255)) {
+          return false;
+        }
+        octet_begin = it + 1;
+      }
+    }
+    return octets == 3 and isDecimal(octet_begin, end, 3, 255);
+  }
+
+  /// name<separator>domain over the whole string
+  inline bool isNameAtDomain(const std::string &str, char separator) {
+    const auto begin = str.data();
+    const auto end = begin + str.size();
+    for (auto it = begin; it != end; ++it) {
+      if (*it == separator) {
+        return isLowerName(begin, it, 32) and isDomain(it + 1, end);
+      }
+    }
+    return false;
+  }
+
+}  // namespace
+
+namespace shared_model {
+  namespace validation {
+    namespace matchers {
+
+      bool isAccountName(const std::string &str) {
+        return isLowerName(str.data(), str.data() + str.size(), 32);
+      }
+
+      bool isAssetName(const std::string &str) {
+        return isLowerName(str.data(), str.data() + str.size(), 32);
+      }
+
+      bool isRoleId(const std::string &str) {
+        return isLowerName(str.data(), str.data() + str.size(), 32);
+      }
+
+      bool isDetailKey(const std::string &str) {
+        if (str.empty() or str.size() > 64) {
+          return false;
+        }
+        for (const auto c : str) {
+          if (not(isAlnum(c) or c == '_')) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      bool isDomain(const std::string &str) {
+        return ::isDomain(str.data(), str.data() + str.size());
+      }
+
+      bool isIpV4(const std::string &str) {
+        return ::isIpV4(str.data(), str.data() + str.size());
+      }
+
+      bool isPeerAddress(const std::string &str) {
+        const auto begin = str.data();
+        const auto end = begin + str.size();
+        // neither an IPv4 address nor a domain may contain a colon, so the
+        // first one separates the host from the port
+        for (auto it = begin; it != end; ++it) {
+          if (*it == ':') {
+            return (::isIpV4(begin, it) or ::isDomain(begin, it))
+                and isDecimal(it + 1, end, 5, 65535);
+          }
+        }
+        return false;
+      }
+
+      bool isAccountId(const std::string &str) {
+        return isNameAtDomain(str, '@');
+      }
+
+      bool isAssetId(const std::string &str) {
+        return isNameAtDomain(str, '#');
+      }
+
+      bool isHexString(const std::string &str) {
+        for (const auto c : str) {
+          if (not isHexDigit(c)) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+    }  // namespace matchers
+  }    // namespace validation
+}  // namespace shared_model
@@ -0,0 +1,57 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_FIELD_MATCHERS_HPP
+#define IROHA_SHARED_MODEL_FIELD_MATCHERS_HPP
+
+#include <string>
+
+namespace shared_model {
+  namespace validation {
+
+    /**
+     * Allocation-free matchers for the textual fields checked by
+     * FieldValidator. Every function accepts exactly the same set of strings
+     * as the corresponding pattern of FieldValidator does when used with
+     * std::regex_match, but scans the input once without building any
+     * intermediate state.
+     */
+    namespace matchers {
+
+      /// [a-z_0-9]{1,32}
+      bool isAccountName(const std::string &str);
+
+      /// [a-z_0-9]{1,32}
+      bool isAssetName(const std::string &str);
+
+      /// [a-z_0-9]{1,32}
+      bool isRoleId(const std::string &str);
+
+      /// [A-Za-z0-9_]{1,64}
+      bool isDetailKey(const std::string &str);
+
+      /// dot-separated sequence of RFC1035 / RFC1123 labels
+      bool isDomain(const std::string &str);
+
+      /// dotted-decimal IPv4 address without leading zeroes
+      bool isIpV4(const std::string &str);
+
+      /// host:port, where host is IPv4 or a domain and port is in [0, 65535]
+      bool isPeerAddress(const std::string &str);
+
+      /// account_name@domain
+      bool isAccountId(const std::string &str);
+
+      /// asset_name#domain
+      bool isAssetId(const std::string &str);
+
+      /// [0-9a-fA-F]*
+      bool isHexString(const std::string &str);
+
+    }  // namespace matchers
+  }    // namespace validation
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_FIELD_MATCHERS_HPP
@@ -155,6 +155,10 @@ namespace shared_model {
         ReasonsGroupType reason;
         reason.first = "GetPendingTransactions";
 
+        if (auto pagination_meta = qry.paginationMeta()) {
+          validator_.validateTxPaginationMeta(reason, *pagination_meta);
+        }
+
         return reason;
       }
 
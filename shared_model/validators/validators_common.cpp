@@ -5,14 +5,13 @@
 
 #include "validators/validators_common.hpp"
 
-#include <regex>
+#include "validators/field_matchers.hpp"
 
 namespace shared_model {
   namespace validation {
 
     bool validateHexString(const std::string &str) {
-      static const std::regex hex_regex{R"([0-9a-fA-F]*)"};
-      return std::regex_match(str, hex_regex);
+      return matchers::isHexString(str);
     }
 
   }  // namespace validation
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Amounts are parsed for every AddAssetQuantity, SubtractAssetQuantity and
+ * TransferAsset command when it is validated, executed and cloned.
+ *
+ * The purpose of this benchmark is to compare parsing, copying and
+ * formatting of amounts with the former regex-based parsing.
+ */
+
+#include <regex>
+
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "interfaces/common_objects/amount.hpp"
+
+namespace {
+  const std::string kAmount = "1234567890.0123456789";
+
+  /// parsing of the former Amount implementation
+  boost::multiprecision::uint256_t parseWithRegex(const std::string &amount) {
+    static const std::regex r("([0-9]+)(\\.([0-9]+))?");
+    std::smatch match;
+    if (std::regex_match(amount, match, r) && match.size() == 4) {
+      auto str = match[0].str();
+      size_t pos = match[1].length();
+      if (pos < str.size()) {
+        str.erase(str.begin() + pos);
+      }
+      str.erase(0, std::min(str.find_first_not_of('0'), str.size() - 1));
+      return boost::multiprecision::uint256_t(str);
+    }
+    return 0;
+  }
+}  // namespace
+
+static void BM_RegexParse(benchmark::State &state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(parseWithRegex(kAmount));
+  }
+}
+BENCHMARK(BM_RegexParse);
+
+static void BM_Parse(benchmark::State &state) {
+  while (state.KeepRunning()) {
+    shared_model::interface::Amount amount(kAmount);
+    benchmark::DoNotOptimize(amount.value());
+  }
+}
+BENCHMARK(BM_Parse);
+
+static void BM_Copy(benchmark::State &state) {
+  const shared_model::interface::Amount amount(kAmount);
+  while (state.KeepRunning()) {
+    shared_model::interface::Amount copy(amount);
+    benchmark::DoNotOptimize(copy.value());
+  }
+}
+BENCHMARK(BM_Copy);
+
+static void BM_Format(benchmark::State &state) {
+  const shared_model::interface::Amount amount(kAmount);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(amount.toStringRepr());
+  }
+}
+BENCHMARK(BM_Format);
+
+static void BM_Add(benchmark::State &state) {
+  const shared_model::interface::Amount lhs(kAmount);
+  const shared_model::interface::Amount rhs("0.5");
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(lhs.value()->add(*rhs.value()));
+  }
+}
+BENCHMARK(BM_Add);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,376 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * The purpose of this benchmark is to measure how the pipeline scales with
+ * the number of peers. A network of real peers is started in one process:
+ * peers communicate over loopback gRPC, and each of them has its own
+ * database and block store.
+ *
+ * Every iteration sends a proposal worth of transactions to the first peer
+ * and waits until all peers commit them. The time of the iteration is the
+ * round latency, so items per second are the end-to-end throughput. Besides,
+ * the first round which includes the transactions is split into stages on
+ * every peer, and the stage durations averaged over peers are reported as
+ * counters:
+ *  - ordering: from sending until the proposal is received
+ *  - simulator: from the proposal until it is verified
+ *  - yac: from the verified proposal until the consensus outcome
+ *  - commit: from the consensus outcome until the block is stored
+ * Arguments are the number of peers and the proposal size.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/size.hpp>
+
+#include "ametsuchi/storage.hpp"
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "common/visitor.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/default_hash_provider.hpp"
+#include "datetime/time.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/integration_framework/iroha_instance.hpp"
+#include "framework/integration_framework/port_guard.hpp"
+#include "framework/integration_framework/test_irohad.hpp"
+#include "interfaces/permissions.hpp"
+#include "module/shared_model/builders/protobuf/block.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
+#include "torii/command_client.hpp"
+
+using namespace common_constants;
+using integration_framework::TestIrohad;
+
+namespace {
+  const std::string kLocalHost = "127.0.0.1";
+  constexpr size_t kToriiPort = 11501;
+  constexpr size_t kInternalPort = 50541;
+  /// timeout of the request of a proposal from the ordering service
+  constexpr std::chrono::milliseconds kProposalDelay(5000);
+  /// upper bound of the delay between empty rounds
+  constexpr std::chrono::milliseconds kMaxRoundsDelay(100);
+  /// maximum time of waiting for all peers to commit the transactions
+  constexpr std::chrono::seconds kRoundTimeout(60);
+
+  using Clock = std::chrono::steady_clock;
+
+  /// stages of the round, which are timed on every peer
+  enum Stage { kOrdering, kSimulator, kConsensus, kCommit, kStagesCount };
+
+  /// progress of the current round on one peer
+  struct PeerProgress {
+    boost::optional<iroha::consensus::Round> round;
+    boost::optional<Clock::time_point> stages[kStagesCount];
+    size_t committed = 0;
+  };
+
+  /// durations of the round, in milliseconds
+  struct RoundTimes {
+    double stages[kStagesCount] = {};
+    double round = 0;
+  };
+
+  double milliseconds(Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  }
+
+  /**
+   * Peers of one network, which are started in this process. All peers are
+   * listed in the genesis block; transactions are sent to the first one.
+   */
+  class Network {
+   public:
+    Network(size_t peers_count, size_t proposal_size)
+        : progress_(peers_count) {
+      std::vector<size_t> torii_ports;
+      for (size_t i = 0; i < peers_count; ++i) {
+        torii_ports.push_back(port_guard_.getPort(kToriiPort));
+        keypairs_.push_back(shared_model::crypto::DefaultCryptoAlgorithmType::
+                                generateKeypair());
+        internal_ports_.push_back(port_guard_.getPort(kInternalPort));
+        block_stores_.push_back((boost::filesystem::temp_directory_path()
+                                 / boost::filesystem::unique_path())
+                                    .string());
+        peers_.push_back(std::make_shared<TestIrohad>(
+            block_stores_.back(),
+            integration_framework::IrohaInstance::getPostgreCredsOrDefault(
+                boost::none),
+            kLocalHost,
+            torii_ports.back(),
+            internal_ports_.back(),
+            proposal_size,
+            kProposalDelay,
+            std::chrono::milliseconds(0),
+            std::chrono::minutes(24 * 60),
+            keypairs_.back(),
+            kMaxRoundsDelay,
+            2));
+      }
+      command_client_ = std::make_unique<torii::CommandSyncClient>(
+          iroha::network::createClient<iroha::protocol::CommandService_v1>(
+              kLocalHost + ":" + std::to_string(torii_ports.front())));
+
+      auto genesis = genesisBlock();
+      for (size_t i = 0; i < peers_.size(); ++i) {
+        peers_[i]->storage->reset();
+        peers_[i]->storage->insertBlock(genesis);
+        peers_[i]->init();
+        subscribe(i);
+      }
+      for (auto &peer : peers_) {
+        peer->run().match(
+            [](const Irohad::RunResult::ValueType &) {},
+            [](const Irohad::RunResult::ErrorType &error) {
+              BOOST_THROW_EXCEPTION(std::runtime_error(error.error));
+            });
+      }
+    }
+
+    ~Network() {
+      subscriptions_.unsubscribe();
+      for (auto &peer : peers_) {
+        peer->terminate(std::chrono::system_clock::now());
+      }
+      for (size_t i = 0; i < peers_.size(); ++i) {
+        peers_[i]->storage->dropStorage();
+        boost::filesystem::remove_all(block_stores_[i]);
+      }
+    }
+
+    /**
+     * Send the transactions to the first peer and wait until every peer
+     * commits them
+     * @return durations of the round, or none if the round timed out
+     */
+    boost::optional<RoundTimes> round(const iroha::protocol::TxList &txs) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      std::fill(progress_.begin(), progress_.end(), PeerProgress{});
+      expected_ = txs.transactions_size();
+      start_ = Clock::now();
+      lock.unlock();
+
+      command_client_->ListTorii(txs);
+
+      lock.lock();
+      auto committed = [this] {
+        return std::all_of(
+            progress_.begin(), progress_.end(), [this](const auto &progress) {
+              return progress.committed >= expected_;
+            });
+      };
+      if (not committed_cv_.wait_until(
+              lock, start_ + kRoundTimeout, committed)) {
+        return boost::none;
+      }
+
+      RoundTimes times;
+      times.round = milliseconds(end_ - start_);
+      for (const auto &progress : progress_) {
+        // a stage which was not observed is considered passed with the next
+        // one
+        Clock::time_point reached[kStagesCount];
+        auto next = end_;
+        for (int stage = kStagesCount - 1; stage >= 0; --stage) {
+          next = reached[stage] = progress.stages[stage].value_or(next);
+        }
+        auto previous = start_;
+        for (int stage = 0; stage < kStagesCount; ++stage) {
+          times.stages[stage] +=
+              milliseconds(reached[stage] - previous) / peers_.size();
+          previous = reached[stage];
+        }
+      }
+      return times;
+    }
+
+   private:
+    shared_model::proto::Block genesisBlock() const {
+      shared_model::interface::RolePermissionSet all_perms{};
+      for (size_t i = 0; i < all_perms.size(); ++i) {
+        auto perm = static_cast<shared_model::interface::permissions::Role>(i);
+        all_perms.set(perm);
+      }
+      auto builder = shared_model::proto::TransactionBuilder()
+                         .creatorAccountId(kAdminId)
+                         .createdTime(iroha::time::now())
+                         .createRole(kAdminRole, all_perms)
+                         .createRole(kDefaultRole, {})
+                         .createDomain(kDomain, kDefaultRole)
+                         .createAccount(
+                             kAdminName, kDomain, kAdminKeypair.publicKey())
+                         .detachRole(kAdminId, kDefaultRole)
+                         .appendRole(kAdminId, kAdminRole)
+                         .quorum(1);
+      for (size_t i = 0; i < keypairs_.size(); ++i) {
+        builder = builder.addPeer(
+            kLocalHost + ":" + std::to_string(internal_ports_[i]),
+            keypairs_[i].publicKey());
+      }
+      auto genesis_tx =
+          builder.build().signAndAddSignature(kAdminKeypair).finish();
+      return shared_model::proto::BlockBuilder()
+          .transactions(
+              std::vector<shared_model::proto::Transaction>{genesis_tx})
+          .height(1)
+          .prevHash(shared_model::crypto::DefaultHashProvider::makeHash(
+              shared_model::crypto::Blob("")))
+          .createdTime(iroha::time::now())
+          .build()
+          .signAndAddSignature(kAdminKeypair)
+          .finish();
+    }
+
+    /// record the time of the stage in the first round with transactions
+    void reached(size_t peer,
+                 Stage stage,
+                 const iroha::consensus::Round &round) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &progress = progress_[peer];
+      if (progress.round and *progress.round == round
+          and not progress.stages[stage]) {
+        progress.stages[stage] = Clock::now();
+      }
+    }
+
+    void subscribe(size_t peer) {
+      auto &irohad = *peers_[peer];
+      irohad.getPeerCommunicationService()->onProposal().subscribe(
+          subscriptions_, [this, peer](const auto &event) {
+            if (not event.proposal
+                or boost::empty((*event.proposal)->transactions())) {
+              return;
+            }
+            {
+              std::lock_guard<std::mutex> lock(mutex_);
+              auto &progress = progress_[peer];
+              if (not progress.round) {
+                progress.round = event.round;
+              }
+            }
+            this->reached(peer, kOrdering, event.round);
+          });
+      irohad.getPeerCommunicationService()->onVerifiedProposal().subscribe(
+          subscriptions_, [this, peer](const auto &event) {
+            this->reached(peer, kSimulator, event.round);
+          });
+      irohad.getConsensusGate()->onOutcome().subscribe(
+          subscriptions_, [this, peer](const auto &outcome) {
+            auto round = iroha::visit_in_place(
+                outcome, [](const auto &object) { return object.round; });
+            this->reached(peer, kConsensus, round);
+          });
+      irohad.storage->on_commit().subscribe(
+          subscriptions_, [this, peer](const auto &block) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto &progress = progress_[peer];
+            auto transactions = boost::size(block->transactions());
+            if (transactions == 0) {
+              return;
+            }
+            if (not progress.stages[kCommit]) {
+              progress.stages[kCommit] = Clock::now();
+            }
+            progress.committed += transactions;
+            end_ = Clock::now();
+            committed_cv_.notify_all();
+          });
+    }
+
+    integration_framework::PortGuard port_guard_;
+    std::unique_ptr<torii::CommandSyncClient> command_client_;
+    std::vector<shared_model::crypto::Keypair> keypairs_;
+    std::vector<size_t> internal_ports_;
+    std::vector<std::string> block_stores_;
+    std::vector<std::shared_ptr<TestIrohad>> peers_;
+    rxcpp::composite_subscription subscriptions_;
+
+    std::mutex mutex_;
+    std::condition_variable committed_cv_;
+    std::vector<PeerProgress> progress_;
+    size_t expected_ = 0;
+    Clock::time_point start_;
+    Clock::time_point end_;
+  };
+
+  /// transactions of the admin, which set details of its account
+  iroha::protocol::TxList makeTransactions(size_t count) {
+    iroha::protocol::TxList txs;
+    auto time = iroha::time::now();
+    for (size_t i = 0; i < count; ++i) {
+      *txs.add_transactions() =
+          shared_model::proto::TransactionBuilder()
+              .creatorAccountId(kAdminId)
+              .createdTime(time - i)
+              .quorum(1)
+              .setAccountDetail(kAdminId, "bench", std::to_string(time - i))
+              .build()
+              .signAndAddSignature(kAdminKeypair)
+              .finish()
+              .getTransport();
+    }
+    return txs;
+  }
+}  // namespace
+
+static void BM_ConsensusRound(benchmark::State &state) {
+  const auto peers = static_cast<size_t>(state.range(0));
+  const auto proposal_size = static_cast<size_t>(state.range(1));
+  spdlog::set_level(spdlog::level::err);
+  Network network(peers, proposal_size);
+
+  RoundTimes total;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto txs = makeTransactions(proposal_size);
+    state.ResumeTiming();
+
+    auto times = network.round(txs);
+    if (not times) {
+      state.SkipWithError("transactions were not committed by all peers");
+      break;
+    }
+    state.SetIterationTime(times->round / 1000);
+    for (int stage = 0; stage < kStagesCount; ++stage) {
+      total.stages[stage] += times->stages[stage];
+    }
+    total.round += times->round;
+  }
+
+  static const char *kStageNames[] = {
+      "ordering_ms", "simulator_ms", "yac_ms", "commit_ms"};
+  for (int stage = 0; stage < kStagesCount; ++stage) {
+    state.counters[kStageNames[stage]] = benchmark::Counter(
+        total.stages[stage], benchmark::Counter::kAvgIterations);
+  }
+  state.counters["round_ms"] =
+      benchmark::Counter(total.round, benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * proposal_size);
+}
+
+/// numbers of peers and proposal sizes
+static void NetworkSizes(benchmark::internal::Benchmark *benchmark) {
+  for (auto peers : {4, 7, 10, 16}) {
+    for (auto proposal_size : {10, 100, 1000}) {
+      benchmark->Args({peers, proposal_size});
+    }
+  }
+}
+
+BENCHMARK(BM_ConsensusRound)
+    ->Apply(NetworkSizes)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * FieldValidator checks identifiers of every command of every transaction,
+ * both in torii and when proposals are validated, so the cost of a single
+ * check is multiplied by the whole load of the network.
+ *
+ * The purpose of this benchmark is to compare the hand-written field matchers
+ * with the std::regex grammar they replaced.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "module/shared_model/validators/field_regexes.hpp"
+
+namespace {
+  const FieldRegexes &regexes() {
+    static FieldRegexes instance;
+    return instance;
+  }
+
+  /// sample inputs for each case of FieldRegexes, both valid and invalid
+  const std::vector<std::vector<std::string>> &inputs() {
+    static const std::vector<std::vector<std::string>> instance{
+        {"admin", "user_with_long_name_32_chars_xxx", "Admin"},
+        {"coin", "irh", "coin-1"},
+        {"admin_role", "money_creator", "bad role"},
+        {"some_detail_Key_1", "key", "bad.key"},
+        {"test", "sub.domain-1.example.com", "1bad.domain"},
+        {"127.0.0.1", "255.255.255.255", "256.0.0.1"},
+        {"127.0.0.1:10001", "peer-1.iroha.tech:50541", "localhost:65536"},
+        {"admin@test", "user@sub.domain-1.example.com", "admin@@test"},
+        {"coin#test", "irh#sub.domain-1.example.com", "coin#test#x"},
+        {"0123456789abcdefABCDEF", "deadbeef", "xyz"}};
+    return instance;
+  }
+}  // namespace
+
+/// Validation of identifiers with the reference std::regex grammar
+static void BM_RegexMatch(benchmark::State &state) {
+  const auto &c = regexes().cases.at(state.range(0));
+  const auto &samples = inputs().at(state.range(0));
+  state.SetLabel(c.name);
+  while (state.KeepRunning()) {
+    for (const auto &sample : samples) {
+      benchmark::DoNotOptimize(std::regex_match(sample, c.regex));
+    }
+  }
+}
+BENCHMARK(BM_RegexMatch)->DenseRange(0, 9);
+
+/// Validation of identifiers with the hand-written field matchers
+static void BM_FieldMatcher(benchmark::State &state) {
+  const auto &c = regexes().cases.at(state.range(0));
+  const auto &samples = inputs().at(state.range(0));
+  state.SetLabel(c.name);
+  while (state.KeepRunning()) {
+    for (const auto &sample : samples) {
+      benchmark::DoNotOptimize(c.matcher(sample));
+    }
+  }
+}
+BENCHMARK(BM_FieldMatcher)->DenseRange(0, 9);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,137 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Transaction and batch hashes are used as keys of containers on hot paths,
+ * e.g. to drop duplicate batches when a proposal is packed.
+ *
+ * The purpose of this benchmark is to compare memory usage and lookup cost of
+ * sets keyed on hex strings, on Hash and on FixedHash.
+ */
+
+#include <random>
+#include <unordered_set>
+
+#include <benchmark/benchmark.h>
+
+#include "cryptography/fixed_hash.hpp"
+
+namespace {
+  using shared_model::crypto::FixedHash;
+  using shared_model::crypto::Hash;
+
+  /// bytes allocated by the containers under test
+  std::size_t allocated_bytes = 0;
+
+  template <typename T>
+  struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U> &) {}
+
+    T *allocate(std::size_t n) {
+      allocated_bytes += n * sizeof(T);
+      return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) {
+      allocated_bytes -= n * sizeof(T);
+      std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U> &) const {
+      return true;
+    }
+    template <typename U>
+    bool operator!=(const CountingAllocator<U> &) const {
+      return false;
+    }
+  };
+
+  using CountingString =
+      std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+
+  struct CountingStringHasher {
+    std::size_t operator()(const CountingString &s) const {
+      return std::hash<std::string>{}(std::string(s.data(), s.size()));
+    }
+  };
+
+  const std::vector<Hash> &hashes() {
+    static const std::vector<Hash> instance = [] {
+      std::mt19937 engine{42};
+      std::vector<Hash> result;
+      for (int i = 0; i < 10000; ++i) {
+        std::string bytes(32, '\0');
+        for (auto &c : bytes) {
+          c = static_cast<char>(engine());
+        }
+        result.emplace_back(bytes);
+      }
+      return result;
+    }();
+    return instance;
+  }
+
+  /**
+   * Fill the set with all hashes, look every hash up and report bytes used by
+   * the set per element
+   * @param to_key - makes a key of the set from a Hash
+   */
+  template <typename Set, typename ToKey>
+  void runSet(benchmark::State &state, ToKey to_key) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::size_t bytes_per_element = 0;
+    for (auto _ : state) {
+      allocated_bytes = 0;
+      Set set;
+      for (std::size_t i = 0; i < count; ++i) {
+        set.insert(to_key(hashes()[i]));
+      }
+      for (std::size_t i = 0; i < count; ++i) {
+        benchmark::DoNotOptimize(set.count(to_key(hashes()[i])));
+      }
+      bytes_per_element = allocated_bytes / count;
+    }
+    state.counters["bytes_per_element"] = bytes_per_element;
+  }
+
+  void BM_HexStringSet(benchmark::State &state) {
+    runSet<std::unordered_set<CountingString,
+                              CountingStringHasher,
+                              std::equal_to<CountingString>,
+                              CountingAllocator<CountingString>>>(
+        state, [](const Hash &h) {
+          return CountingString(h.hex().data(), h.hex().size());
+        });
+  }
+
+  void BM_HashSet(benchmark::State &state) {
+    // Hash allocates its bytes and hex with the default allocator, which is
+    // not counted, so only the nodes are accounted for
+    runSet<std::unordered_set<Hash,
+                              Hash::Hasher,
+                              std::equal_to<Hash>,
+                              CountingAllocator<Hash>>>(
+        state, [](const Hash &h) -> const Hash & { return h; });
+  }
+
+  void BM_FixedHashSet(benchmark::State &state) {
+    runSet<std::unordered_set<FixedHash,
+                              FixedHash::Hasher,
+                              std::equal_to<FixedHash>,
+                              CountingAllocator<FixedHash>>>(
+        state, [](const Hash &h) { return FixedHash(h); });
+  }
+}  // namespace
+
+BENCHMARK(BM_HexStringSet)->Arg(100)->Arg(10000);
+BENCHMARK(BM_HashSet)->Arg(100)->Arg(10000);
+BENCHMARK(BM_FixedHashSet)->Arg(100)->Arg(10000);
+
+BENCHMARK_MAIN();
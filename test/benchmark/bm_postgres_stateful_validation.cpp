@@ -0,0 +1,217 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * In-memory temporary wsv reads the world state from Postgres. Before a
+ * proposal is validated, all the entities read by its transactions are loaded
+ * with one query instead of one query per entity on the first access.
+ *
+ * The purpose of this benchmark is to measure stateful validation of a
+ * proposal of transfers against a real Postgres database, with the state
+ * preloaded (argument 1) and loaded on the first access (argument 0). The
+ * database is configured by the same environment variables as the tests.
+ */
+
+#include <benchmark/benchmark.h>
+#include <boost/filesystem.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include "ametsuchi/impl/storage_impl.hpp"
+#include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/hash_providers/sha3_256.hpp"
+#include "datetime/time.hpp"
+#include "framework/config_helper.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "logger/logger.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validation/impl/stateful_validator_impl.hpp"
+#include "validators/field_validator.hpp"
+
+namespace {
+  constexpr size_t kAccountsCount = 1000;
+  constexpr size_t kTransactionsCount = 2000;
+  constexpr auto kDomainId = "test";
+  constexpr auto kAssetId = "coin#test";
+
+  std::string accountId(size_t i) {
+    return "user" + std::to_string(i) + "@" + kDomainId;
+  }
+
+  /**
+   * Storage with the in-memory wsv engine over a new database, where accounts
+   * "user<i>@test" with all permissions have 10.00 of "coin#test" each. The
+   * database is dropped on destruction.
+   */
+  class PostgresLedger {
+   public:
+    PostgresLedger()
+        : keypair_(shared_model::crypto::DefaultCryptoAlgorithmType::
+                       generateKeypair()),
+          block_store_path_((boost::filesystem::temp_directory_path()
+                             / boost::filesystem::unique_path())
+                                .string()) {
+      auto dbname = "d"
+          + boost::uuids::to_string(boost::uuids::random_generator()())
+                .substr(0, 8);
+      iroha::ametsuchi::StorageImpl::create(
+          block_store_path_,
+          "dbname=" + dbname + " "
+              + integration_framework::getPostgresCredsOrDefault(),
+          std::make_shared<shared_model::proto::ProtoCommonObjectsFactory<
+              shared_model::validation::FieldValidator>>(),
+          std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+          std::make_shared<shared_model::proto::ProtoPermissionToString>(),
+          iroha::ametsuchi::StorageImpl::kDefaultPoolSize,
+          iroha::ametsuchi::WsvEngine::kInMemory)
+          .match(
+              [this](iroha::expected::Value<
+                     std::shared_ptr<iroha::ametsuchi::StorageImpl>> &storage) {
+                storage_ = storage.value;
+              },
+              [](iroha::expected::Error<std::string> &error) {
+                throw std::runtime_error("StorageImpl: " + error.error);
+              });
+      storage_->insertBlock(makeGenesisBlock());
+    }
+
+    ~PostgresLedger() {
+      storage_->dropStorage();
+      boost::filesystem::remove_all(block_store_path_);
+    }
+
+    iroha::ametsuchi::StorageImpl &storage() {
+      return *storage_;
+    }
+
+    /// transfers between pairs of accounts, signed by their signatory
+    shared_model::proto::Proposal makeProposal() const {
+      std::vector<shared_model::proto::Transaction> txs;
+      auto time = iroha::time::now();
+      for (size_t i = 0; i < kTransactionsCount; ++i) {
+        auto src = i * 2 % kAccountsCount;
+        txs.push_back(TestUnsignedTransactionBuilder()
+                          .creatorAccountId(accountId(src))
+                          .createdTime(++time)
+                          .quorum(1)
+                          .transferAsset(accountId(src),
+                                         accountId(src + 1),
+                                         kAssetId,
+                                         "",
+                                         "0.01")
+                          .build()
+                          .signAndAddSignature(keypair_)
+                          .finish());
+      }
+      return TestProposalBuilder()
+          .createdTime(iroha::time::now())
+          .height(2)
+          .transactions(txs)
+          .build();
+    }
+
+   private:
+    shared_model::proto::Block makeGenesisBlock() const {
+      shared_model::interface::RolePermissionSet all;
+      all.set();
+      auto time = iroha::time::now();
+      auto accounts = TestTransactionBuilder()
+                          .creatorAccountId(accountId(0))
+                          .createdTime(++time)
+                          .quorum(1)
+                          .createRole("user", all)
+                          .createDomain(kDomainId, "user")
+                          .createAsset("coin", kDomainId, 2);
+      auto balances = TestTransactionBuilder()
+                          .creatorAccountId(accountId(0))
+                          .createdTime(++time)
+                          .quorum(1)
+                          .addAssetQuantity(kAssetId, "10000.00");
+      for (size_t i = 0; i < kAccountsCount; ++i) {
+        accounts = accounts.createAccount(
+            "user" + std::to_string(i), kDomainId, keypair_.publicKey());
+        if (i != 0) {
+          balances = balances.transferAsset(
+              accountId(0), accountId(i), kAssetId, "", "10.00");
+        }
+      }
+      return TestBlockBuilder()
+          .transactions(std::vector<shared_model::proto::Transaction>{
+              accounts.build(), balances.build()})
+          .height(1)
+          .prevHash(shared_model::crypto::Sha3_256::makeHash(
+              shared_model::crypto::Blob("")))
+          .createdTime(iroha::time::now())
+          .build();
+    }
+
+    shared_model::crypto::Keypair keypair_;
+    std::string block_store_path_;
+    std::shared_ptr<iroha::ametsuchi::StorageImpl> storage_;
+  };
+
+  /// temporary wsv, which loads every entity on the first access
+  class LazyTemporaryWsv : public iroha::ametsuchi::TemporaryWsv {
+   public:
+    explicit LazyTemporaryWsv(std::unique_ptr<TemporaryWsv> wsv)
+        : wsv_(std::move(wsv)) {}
+
+    iroha::expected::Result<void, iroha::validation::CommandError> apply(
+        const shared_model::interface::Transaction &transaction) override {
+      return wsv_->apply(transaction);
+    }
+
+    std::unique_ptr<SavepointWrapper> createSavepoint(
+        const std::string &name) override {
+      return wsv_->createSavepoint(name);
+    }
+
+   private:
+    std::unique_ptr<TemporaryWsv> wsv_;
+  };
+}  // namespace
+
+static void BM_PostgresStatefulValidation(benchmark::State &state) {
+  const bool preload = state.range(0) != 0;
+  static PostgresLedger ledger;
+  auto proposal = ledger.makeProposal();
+  iroha::validation::StatefulValidatorImpl validator(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(),
+      std::make_shared<shared_model::interface::TransactionBatchParserImpl>(),
+      nullptr,
+      1,
+      logger::log("BM_PG_SFV"));
+  logger::log("BM_PG_SFV")->set_level(spdlog::level::err);
+
+  for (auto _ : state) {
+    auto result = ledger.storage().createTemporaryWsv();
+    auto wsv = std::move(
+        boost::get<iroha::expected::Value<
+            std::unique_ptr<iroha::ametsuchi::TemporaryWsv>>>(result)
+            .value);
+    if (preload) {
+      benchmark::DoNotOptimize(validator.validate(proposal, *wsv));
+    } else {
+      LazyTemporaryWsv lazy(std::move(wsv));
+      benchmark::DoNotOptimize(validator.validate(proposal, lazy));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kTransactionsCount);
+}
+
+BENCHMARK(BM_PostgresStatefulValidation)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
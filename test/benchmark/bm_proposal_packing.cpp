@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Tenants of a network share its proposals. When one of them sends more
+ * transactions than proposals fit, the batches, which do not fit, are carried
+ * over to the next proposals, and with packing in arrival order the batches of
+ * other tenants wait behind them.
+ *
+ * The purpose of this benchmark is to measure the latency of the batches of
+ * small tenants, in rounds between the round, for which a batch is sent, and
+ * the round of the proposal with it, when one tenant overloads the network.
+ * Rounds are packed as the ordering service does it: the batches, which are
+ * carried over, and the batches of the round are offered in one pass, the
+ * carried over ones first, and the batches, which do not fit, go to a backlog
+ * of the same size. Every proposal is requested, so its batches leave the
+ * backlog. The number of small tenant batches dropped from the full backlog
+ * is reported as well.
+ */
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+#include "backend/protobuf/transaction.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "ordering/impl/batch_backlog.hpp"
+#include "ordering/impl/proposal_packing_policies.hpp"
+
+using namespace iroha::ordering;
+
+namespace {
+  using BatchesType = ProposalPackingPolicy::BatchesType;
+
+  const size_t kProposalTransactions = 100;
+  const size_t kBacklogTransactions = 2000;
+  const size_t kSmallTenants = 10;
+  const size_t kRounds = 200;
+
+  /// batches, which the tenants send for every round
+  std::vector<BatchesType> makeLoad(size_t heavy_tenant_batches) {
+    size_t counter = 0;
+    auto make_batch = [&counter](const std::string &account) {
+      iroha::protocol::Transaction tx;
+      auto *reduced_payload =
+          tx.mutable_payload()->mutable_reduced_payload();
+      reduced_payload->set_creator_account_id(account);
+      reduced_payload->set_created_time(counter++);
+      return std::make_shared<shared_model::interface::TransactionBatchImpl>(
+          shared_model::interface::types::SharedTxsCollectionType{
+              std::make_shared<shared_model::proto::Transaction>(
+                  std::move(tx))});
+    };
+
+    std::vector<BatchesType> rounds(kRounds);
+    for (auto &round : rounds) {
+      for (size_t i = 0; i < heavy_tenant_batches; ++i) {
+        round.push_back(make_batch("heavy@tenant"));
+      }
+      for (size_t i = 0; i < kSmallTenants; ++i) {
+        round.push_back(make_batch("small" + std::to_string(i) + "@tenant"));
+      }
+    }
+    return rounds;
+  }
+
+  /**
+   * Packs the rounds and reports the latency of the batches of small tenants
+   */
+  void runLoad(benchmark::State &state,
+               const ProposalPackingPolicy &policy) {
+    const auto rounds = makeLoad(state.range(0));
+    std::vector<size_t> latencies;
+    size_t dropped = 0;
+    auto is_small = [](const auto &batch) {
+      return batch->transactions().front()->creatorAccountId()
+          != "heavy@tenant";
+    };
+    for (auto _ : state) {
+      latencies.clear();
+      dropped = 0;
+      std::unordered_map<const void *, size_t> sent;
+      BatchBacklog backlog({kBacklogTransactions, std::chrono::hours(1)});
+      const auto now = BatchBacklog::Clock::now();
+      for (size_t round = 0; round < rounds.size(); ++round) {
+        for (const auto &batch : rounds[round]) {
+          sent[batch.get()] = round;
+        }
+        auto candidates = backlog.batches();
+        candidates.insert(
+            candidates.end(), rounds[round].begin(), rounds[round].end());
+        BatchesType proposal;
+        policy.pack(proposal, candidates);
+
+        BatchBacklog::HashSetType proposed;
+        for (const auto &batch : proposal) {
+          proposed.emplace(batch->reducedHash());
+          if (is_small(batch)) {
+            latencies.push_back(round - sent[batch.get()]);
+          }
+        }
+        backlog.remove(proposed);
+        for (const auto &batch : candidates) {
+          backlog.add(batch, now);
+        }
+      }
+      // small tenant batches, which were neither proposed nor left in the
+      // backlog, were dropped
+      const auto left = backlog.batches();
+      dropped = rounds.size() * kSmallTenants - latencies.size()
+          - std::count_if(left.begin(), left.end(), is_small);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) {
+      return latencies.empty()
+          ? 0.
+          : static_cast<double>(
+                latencies[static_cast<size_t>(p * (latencies.size() - 1))]);
+    };
+    state.counters["small_p50_rounds"] = percentile(0.5);
+    state.counters["small_p99_rounds"] = percentile(0.99);
+    state.counters["small_dropped"] = dropped;
+  }
+}  // namespace
+
+static void BM_FifoPacking(benchmark::State &state) {
+  runLoad(state, FifoPackingPolicy({kProposalTransactions}));
+}
+BENCHMARK(BM_FifoPacking)->Arg(50)->Arg(150);
+
+static void BM_FairPacking(benchmark::State &state) {
+  runLoad(state, FairPackingPolicy({kProposalTransactions}));
+}
+BENCHMARK(BM_FairPacking)->Arg(50)->Arg(150);
+
+static void BM_FairPackingWithAccountShare(benchmark::State &state) {
+  runLoad(state, FairPackingPolicy({kProposalTransactions}, 0.5));
+}
+BENCHMARK(BM_FairPackingWithAccountShare)->Arg(50)->Arg(150);
+
+BENCHMARK_MAIN();
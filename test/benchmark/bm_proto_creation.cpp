@@ -16,14 +16,35 @@
  * initialize possibly lazy fields.
  */
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
 #include <benchmark/benchmark.h>
+#include <google/protobuf/arena.h>
 
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/util.hpp"
 #include "datetime/time.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 
+/// number of heap allocations made by the benchmark binary
+static std::atomic<size_t> allocations{0};
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (auto ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
 /// number of commands in a single transaction
 constexpr int number_of_commands = 5;
 
@@ -85,6 +106,65 @@ class ProposalBenchmark : public benchmark::Fixture {
   }
 };
 
+class TransactionBenchmark : public benchmark::Fixture {
+ public:
+  /// serialized proposal with st.range(0) transactions
+  std::string serialized_proposal;
+
+  void SetUp(benchmark::State &st) override {
+    TestProposalBuilder builder;
+    TestTransactionBuilder txbuilder;
+
+    auto base_tx = txbuilder.createdTime(iroha::time::now()).quorum(1);
+
+    for (int i = 0; i < number_of_commands; i++) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+
+    std::vector<shared_model::proto::Transaction> txs;
+
+    for (int i = 0; i < st.range(0); i++) {
+      txs.push_back(base_tx.build());
+    }
+
+    builder.createdTime(iroha::time::now())
+        .height(1)
+        .transactions(txs)
+        .build()
+        .getTransport()
+        .SerializeToString(&serialized_proposal);
+  }
+};
+
+class BlockConstructionBenchmark : public benchmark::Fixture {
+ public:
+  /// transport of a block with st.range(0) transactions
+  iroha::protocol::Block_v1 transport;
+
+  void SetUp(benchmark::State &st) override {
+    TestBlockBuilder builder;
+    TestTransactionBuilder txbuilder;
+
+    auto base_tx = txbuilder.createdTime(iroha::time::now()).quorum(1);
+
+    for (int i = 0; i < number_of_commands; i++) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+
+    std::vector<shared_model::proto::Transaction> txs;
+
+    for (int i = 0; i < st.range(0); i++) {
+      txs.push_back(base_tx.build());
+    }
+
+    transport = builder.createdTime(iroha::time::now())
+                    .height(1)
+                    .transactions(txs)
+                    .build()
+                    .getTransport();
+  }
+};
+
 /**
  * calls getters of a given object (block or proposal),
  * so that lazy fields are initialized.
@@ -133,7 +213,7 @@ BENCHMARK_DEFINE_F(BlockBenchmark, TransportCopyTest)(benchmark::State &st) {
 BENCHMARK_DEFINE_F(BlockBenchmark, TransportMoveTest)(benchmark::State &st) {
   while (st.KeepRunning()) {
     auto block = complete_builder.build();
-    iroha::protocol::Block proto_block = block.getTransport();
+    iroha::protocol::Block_v1 proto_block = block.getTransport();
 
     runBenchmark(st, [&proto_block] {
       shared_model::proto::Block copy(std::move(proto_block));
@@ -227,6 +307,174 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, CloneTest)(benchmark::State &st) {
   }
 }
 
+/**
+ * Benchmark wrapping every transaction of a parsed proposal and reading only
+ * the reduced hash, as replay checks and status publishing do
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, ReducedHashTest)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    iroha::protocol::Proposal proposal;
+    proposal.ParseFromString(serialized_proposal);
+
+    runBenchmark(st, [&proposal] {
+      for (auto &tx : *proposal.mutable_transactions()) {
+        shared_model::proto::Transaction transaction(tx);
+        benchmark::DoNotOptimize(transaction.reducedHash());
+      }
+    });
+  }
+}
+
+/**
+ * Benchmark wrapping every transaction of a parsed proposal and reading all
+ * of its derived members
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, FullAccessTest)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    iroha::protocol::Proposal proposal;
+    proposal.ParseFromString(serialized_proposal);
+
+    runBenchmark(st, [&proposal] {
+      for (auto &tx : *proposal.mutable_transactions()) {
+        shared_model::proto::Transaction transaction(tx);
+        benchmark::DoNotOptimize(transaction.blob());
+        benchmark::DoNotOptimize(transaction.hash());
+        benchmark::DoNotOptimize(transaction.reducedHash());
+        benchmark::DoNotOptimize(transaction.commands());
+        benchmark::DoNotOptimize(transaction.signatures());
+      }
+    });
+  }
+}
+
+/**
+ * Benchmark parsing a proposal on the heap and wrapping its transactions
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, HeapParseTest)
+(benchmark::State &st) {
+  const auto allocations_before = allocations.load();
+  while (st.KeepRunning()) {
+    runBenchmark(st, [this] {
+      iroha::protocol::Proposal proposal;
+      proposal.ParseFromString(serialized_proposal);
+      for (auto &tx : *proposal.mutable_transactions()) {
+        shared_model::proto::Transaction transaction(tx);
+        benchmark::DoNotOptimize(transaction.reducedHash());
+      }
+    });
+  }
+  st.counters["allocations"] = benchmark::Counter(
+      allocations.load() - allocations_before,
+      benchmark::Counter::kAvgIterations);
+}
+
+/**
+ * Benchmark parsing a proposal into an arena and wrapping its transactions
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, ArenaParseTest)
+(benchmark::State &st) {
+  const auto allocations_before = allocations.load();
+  while (st.KeepRunning()) {
+    runBenchmark(st, [this] {
+      google::protobuf::Arena arena;
+      auto proposal =
+          google::protobuf::Arena::CreateMessage<iroha::protocol::Proposal>(
+              &arena);
+      proposal->ParseFromString(serialized_proposal);
+      for (auto &tx : *proposal->mutable_transactions()) {
+        shared_model::proto::Transaction transaction(tx);
+        benchmark::DoNotOptimize(transaction.reducedHash());
+      }
+    });
+  }
+  st.counters["allocations"] = benchmark::Counter(
+      allocations.load() - allocations_before,
+      benchmark::Counter::kAvgIterations);
+}
+
+/**
+ * Benchmark copying received transactions into separate heap messages, as
+ * torii and MST transport used to do
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, HeapCopyTest)
+(benchmark::State &st) {
+  iroha::protocol::Proposal proposal;
+  proposal.ParseFromString(serialized_proposal);
+  const auto allocations_before = allocations.load();
+  while (st.KeepRunning()) {
+    runBenchmark(st, [&proposal] {
+      for (const auto &tx : proposal.transactions()) {
+        shared_model::proto::Transaction transaction(tx);
+        benchmark::DoNotOptimize(transaction.reducedHash());
+      }
+    });
+  }
+  st.counters["allocations"] = benchmark::Counter(
+      allocations.load() - allocations_before,
+      benchmark::Counter::kAvgIterations);
+}
+
+/**
+ * Benchmark copying received transactions into arenas, as torii and MST
+ * transport do
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, ArenaCopyTest)
+(benchmark::State &st) {
+  iroha::protocol::Proposal proposal;
+  proposal.ParseFromString(serialized_proposal);
+  const auto allocations_before = allocations.load();
+  while (st.KeepRunning()) {
+    runBenchmark(st, [&proposal] {
+      for (const auto &tx : proposal.transactions()) {
+        shared_model::proto::Transaction transaction(
+            shared_model::proto::makeArenaCopy(tx));
+        benchmark::DoNotOptimize(transaction.reducedHash());
+      }
+    });
+  }
+  st.counters["allocations"] = benchmark::Counter(
+      allocations.load() - allocations_before,
+      benchmark::Counter::kAvgIterations);
+}
+
+/**
+ * Benchmark wrapping a block transport and reading only its height, as block
+ * storage and propagation do
+ */
+BENCHMARK_DEFINE_F(BlockConstructionBenchmark, ConstructionTest)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    auto copy = transport;
+
+    runBenchmark(st, [&copy] {
+      shared_model::proto::Block block(std::move(copy));
+      benchmark::DoNotOptimize(block.height());
+    });
+  }
+}
+
+/**
+ * Benchmark wrapping a block transport and reading its blob, payload and the
+ * hashes of all its transactions, as block validation does
+ */
+BENCHMARK_DEFINE_F(BlockConstructionBenchmark, FullAccessTest)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    auto copy = transport;
+
+    runBenchmark(st, [&copy] {
+      shared_model::proto::Block block(std::move(copy));
+      benchmark::DoNotOptimize(block.blob());
+      benchmark::DoNotOptimize(block.payload());
+      for (const auto &tx : block.transactions()) {
+        benchmark::DoNotOptimize(tx.hash());
+      }
+    });
+  }
+}
+
 BENCHMARK_REGISTER_F(BlockBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, CloneTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveTest)->UseManualTime();
@@ -235,5 +483,38 @@ BENCHMARK_REGISTER_F(ProposalBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, CloneTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportMoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportCopyTest)->UseManualTime();
+// proposal- and block-sized inputs
+BENCHMARK_REGISTER_F(BlockConstructionBenchmark, ConstructionTest)
+    ->Arg(100)
+    ->Arg(10000)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(BlockConstructionBenchmark, FullAccessTest)
+    ->Arg(100)
+    ->Arg(10000)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, ReducedHashTest)
+    ->Arg(100)
+    ->Arg(10000)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, FullAccessTest)
+    ->Arg(100)
+    ->Arg(10000)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, HeapParseTest)
+    ->Arg(100)
+    ->Arg(10000)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, ArenaParseTest)
+    ->Arg(100)
+    ->Arg(10000)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, HeapCopyTest)
+    ->Arg(100)
+    ->Arg(10000)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, ArenaCopyTest)
+    ->Arg(100)
+    ->Arg(10000)
+    ->UseManualTime();
 
 BENCHMARK_MAIN();
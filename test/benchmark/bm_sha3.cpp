@@ -0,0 +1,120 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Every transaction of a proposal or a block is hashed, and a transaction
+ * payload fits a few SHA3-256 blocks, so the time is spent mostly in the
+ * Keccak permutation.
+ *
+ * The purpose of this benchmark is to compare hashing of payloads one by one
+ * with hashing of several payloads at once, and the same for the
+ * transactions of a proposal.
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+#include "backend/protobuf/proposal.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "cryptography/hash_providers/sha3_256.hpp"
+
+namespace {
+  /**
+   * @param number - number of payloads
+   * @return random payloads of the sizes of usual transactions
+   */
+  std::vector<shared_model::crypto::Blob> makePayloads(size_t number) {
+    std::mt19937 random(42);
+    std::vector<shared_model::crypto::Blob> payloads;
+    for (size_t i = 0; i < number; ++i) {
+      std::string payload(150 + random() % 200, 0);
+      for (auto &c : payload) {
+        c = static_cast<char>(random());
+      }
+      payloads.emplace_back(payload);
+    }
+    return payloads;
+  }
+
+  iroha::protocol::Proposal makeProposal(size_t transactions) {
+    iroha::protocol::Proposal proposal;
+    for (const auto &payload : makePayloads(transactions)) {
+      auto *reduced_payload = proposal.add_transactions()
+                                  ->mutable_payload()
+                                  ->mutable_reduced_payload();
+      reduced_payload->set_creator_account_id("user@test");
+      reduced_payload->add_commands()
+          ->mutable_set_account_detail()
+          ->set_value(payload.hex());
+    }
+    return proposal;
+  }
+}  // namespace
+
+static void BM_HashOneByOne(benchmark::State &state) {
+  const auto payloads = makePayloads(state.range(0));
+
+  for (auto _ : state) {
+    for (const auto &payload : payloads) {
+      benchmark::DoNotOptimize(
+          shared_model::crypto::Sha3_256::makeHash(payload));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * payloads.size());
+}
+BENCHMARK(BM_HashOneByOne)->Arg(100)->Arg(1000);
+
+static void BM_HashAtOnce(benchmark::State &state) {
+  const auto payloads = makePayloads(state.range(0));
+  std::vector<const shared_model::crypto::Blob *> blobs;
+  for (const auto &payload : payloads) {
+    blobs.push_back(&payload);
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        shared_model::crypto::Sha3_256::makeHashes(blobs));
+  }
+  state.SetItemsProcessed(state.iterations() * payloads.size());
+}
+BENCHMARK(BM_HashAtOnce)->Arg(100)->Arg(1000);
+
+/**
+ * Transactions of a proposal are wrapped and hashed one by one
+ */
+static void BM_TransactionHashesOneByOne(benchmark::State &state) {
+  auto proposal = makeProposal(state.range(0));
+
+  for (auto _ : state) {
+    for (auto &tx : *proposal.mutable_transactions()) {
+      shared_model::proto::Transaction transaction(tx);
+      benchmark::DoNotOptimize(transaction.hash());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TransactionHashesOneByOne)->Arg(100)->Arg(1000);
+
+/**
+ * Transactions of a proposal are wrapped and hashed at once, as it is done
+ * when a proposal is built
+ */
+static void BM_TransactionHashesAtOnce(benchmark::State &state) {
+  auto proposal = makeProposal(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<shared_model::proto::Transaction> transactions(
+        proposal.mutable_transactions()->begin(),
+        proposal.mutable_transactions()->end());
+    shared_model::proto::Transaction::computeHashes(transactions);
+    for (const auto &transaction : transactions) {
+      benchmark::DoNotOptimize(transaction.hash());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TransactionHashesAtOnce)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
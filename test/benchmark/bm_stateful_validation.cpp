@@ -0,0 +1,124 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Stateful validation may split a proposal into groups of transactions which
+ * touch disjoint parts of the state and validate the groups concurrently.
+ *
+ * The purpose of this benchmark is to measure the throughput of stateful
+ * validation of a proposal of independent transfers depending on the number
+ * of workers. Temporary wsvs are in-memory stubs; the second argument is a
+ * delay of every load of an entity in microseconds, which stands for a
+ * database round trip. With no delay the benchmark shows the cost of the
+ * conflict analysis and of merging the states of workers.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "datetime/time.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "module/irohad/ametsuchi/in_memory_temporary_wsv_stub.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validation/impl/stateful_validator_impl.hpp"
+
+using iroha::ametsuchi::GenesisWsvStateLoaderStub;
+using iroha::ametsuchi::InMemoryTemporaryFactoryStub;
+using iroha::ametsuchi::InMemoryTemporaryWsvStub;
+
+namespace {
+  constexpr size_t kAccountsCount = 1000;
+  constexpr size_t kTransactionsCount = 5000;
+
+  std::string accountId(size_t i) {
+    return GenesisWsvStateLoaderStub::accountId(i);
+  }
+
+  /// loader which waits before loading accounts and balances
+  class DelayedWsvStateLoader : public GenesisWsvStateLoaderStub {
+   public:
+    DelayedWsvStateLoader(size_t accounts_count,
+                          std::chrono::microseconds delay)
+        : GenesisWsvStateLoaderStub(accounts_count), delay_(delay) {}
+
+    boost::optional<iroha::ametsuchi::WsvAccount> loadAccount(
+        const std::string &id) override {
+      std::this_thread::sleep_for(delay_);
+      return GenesisWsvStateLoaderStub::loadAccount(id);
+    }
+
+    boost::optional<iroha::ametsuchi::WsvDecimal> loadBalance(
+        const std::string &account_id, const std::string &asset_id) override {
+      std::this_thread::sleep_for(delay_);
+      return GenesisWsvStateLoaderStub::loadBalance(account_id, asset_id);
+    }
+
+   private:
+    std::chrono::microseconds delay_;
+  };
+
+  /// transfers between pairs of accounts, each pair is independent
+  shared_model::proto::Proposal makeProposal() {
+    std::vector<shared_model::proto::Transaction> txs;
+    auto time = iroha::time::now();
+    for (size_t i = 0; i < kTransactionsCount; ++i) {
+      auto src = i * 2 % kAccountsCount;
+      txs.push_back(TestTransactionBuilder()
+                        .creatorAccountId(accountId(src))
+                        .createdTime(++time)
+                        .quorum(1)
+                        .transferAsset(accountId(src),
+                                       accountId(src + 1),
+                                       GenesisWsvStateLoaderStub::kAssetId,
+                                       "",
+                                       "0.01")
+                        .build());
+    }
+    return TestProposalBuilder()
+        .createdTime(iroha::time::now())
+        .height(2)
+        .transactions(txs)
+        .build();
+  }
+}  // namespace
+
+static void BM_StatefulValidation(benchmark::State &state) {
+  const auto workers = static_cast<size_t>(state.range(0));
+  auto proposal = makeProposal();
+  auto loader = std::make_shared<DelayedWsvStateLoader>(
+      kAccountsCount, std::chrono::microseconds(state.range(1)));
+  iroha::validation::StatefulValidatorImpl validator(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(),
+      std::make_shared<shared_model::interface::TransactionBatchParserImpl>(),
+      std::make_shared<InMemoryTemporaryFactoryStub>(loader),
+      workers,
+      logger::log("BM_SFV"));
+  logger::log("BM_SFV")->set_level(spdlog::level::err);
+
+  for (auto _ : state) {
+    InMemoryTemporaryWsvStub wsv(loader);
+    benchmark::DoNotOptimize(validator.validate(proposal, wsv));
+  }
+  state.SetItemsProcessed(state.iterations() * kTransactionsCount);
+}
+
+BENCHMARK(BM_StatefulValidation)
+    ->Args({1, 0})
+    ->Args({2, 0})
+    ->Args({4, 0})
+    ->Args({8, 0})
+    ->Args({1, 50})
+    ->Args({2, 50})
+    ->Args({4, 50})
+    ->Args({8, 50})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
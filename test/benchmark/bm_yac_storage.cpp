@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Every vote and every commit or reject message received by a peer is stored
+ * in the YAC vote storage, which looks up the storage of the round and of the
+ * voted block and checks that the voter has not voted yet.
+ *
+ * The purpose of this benchmark is to measure vote handling of one round
+ * depending on the number of peers, for commit and reject outcomes and for
+ * duplicate messages.
+ */
+
+#include <benchmark/benchmark.h>
+#include "consensus/yac/storage/buffered_cleanup_strategy.hpp"
+#include "consensus/yac/storage/yac_vote_storage.hpp"
+#include "module/irohad/consensus/yac/yac_test_util.hpp"
+
+using namespace iroha::consensus;
+using namespace iroha::consensus::yac;
+
+namespace {
+  /**
+   * @param peers - number of peers in the round
+   * @param blocks - number of distinct blocks, which the peers vote for
+   * @return votes of the peers
+   */
+  std::vector<VoteMessage> makeVotes(size_t peers, size_t blocks) {
+    std::vector<VoteMessage> votes;
+    for (size_t i = 0; i < peers; ++i) {
+      votes.push_back(
+          createVote(YacHash(Round{1, 1},
+                             "proposal",
+                             "block" + std::to_string(i % blocks)),
+                     "peer" + std::to_string(i)));
+    }
+    return votes;
+  }
+
+  YacVoteStorage makeStorage() {
+    return YacVoteStorage(std::make_shared<BufferedCleanupStrategy>());
+  }
+}  // namespace
+
+/**
+ * All peers vote for the same block, one vote per message
+ */
+static void BM_CommitRound(benchmark::State &state) {
+  const size_t peers = state.range(0);
+  const auto votes = makeVotes(peers, 1);
+
+  for (auto _ : state) {
+    auto storage = makeStorage();
+    for (const auto &vote : votes) {
+      benchmark::DoNotOptimize(storage.store({vote}, peers));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * peers);
+}
+BENCHMARK(BM_CommitRound)->Arg(4)->Arg(100);
+
+/**
+ * Every peer votes for its own block, so the round is rejected
+ */
+static void BM_RejectRound(benchmark::State &state) {
+  const size_t peers = state.range(0);
+  const auto votes = makeVotes(peers, peers);
+
+  for (auto _ : state) {
+    auto storage = makeStorage();
+    for (const auto &vote : votes) {
+      benchmark::DoNotOptimize(storage.store({vote}, peers));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * peers);
+}
+BENCHMARK(BM_RejectRound)->Arg(4)->Arg(100);
+
+/**
+ * The commit is received again from every peer after the round is committed
+ */
+static void BM_DuplicateCommits(benchmark::State &state) {
+  const size_t peers = state.range(0);
+  const auto votes = makeVotes(peers, 1);
+
+  for (auto _ : state) {
+    auto storage = makeStorage();
+    for (size_t i = 0; i < peers; ++i) {
+      benchmark::DoNotOptimize(storage.store(votes, peers));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * peers * peers);
+}
+BENCHMARK(BM_DuplicateCommits)->Arg(4)->Arg(100);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,138 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * A commit is propagated by every peer, which collects it, to all the peers,
+ * and every receiver deserializes and verifies all its votes.
+ *
+ * The purpose of this benchmark is to measure the size of a commit message
+ * and the time to build, parse and verify it, when the votes are sent one by
+ * one and as a certificate.
+ */
+
+#include <benchmark/benchmark.h>
+#include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
+#include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
+#include "consensus/yac/transport/yac_pb_converters.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "validators/field_validator.hpp"
+
+using namespace iroha::consensus;
+using namespace iroha::consensus::yac;
+
+namespace {
+  /**
+   * @param peers - number of peers in the round
+   * @return commit of the peers, which signed their votes and the block
+   */
+  std::vector<VoteMessage> makeCommit(size_t peers) {
+    using Factory = shared_model::proto::ProtoCommonObjectsFactory<
+        shared_model::validation::FieldValidator>;
+    auto factory = std::make_shared<Factory>();
+    // hex of hashes, as they are made by YacHashProvider
+    const std::string proposal_hash(64, 'a');
+    const std::string block_hash(64, 'b');
+
+    std::vector<VoteMessage> votes;
+    for (size_t i = 0; i < peers; ++i) {
+      auto keypair =
+          shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+      YacHash hash(Round{1, 0}, proposal_hash, block_hash);
+      auto block_signature = shared_model::crypto::CryptoSigner<>::sign(
+          shared_model::crypto::Blob(block_hash), keypair);
+      factory->createSignature(keypair.publicKey(), block_signature)
+          .match(
+              [&hash](iroha::expected::Value<
+                      std::unique_ptr<shared_model::interface::Signature>>
+                          &sig) {
+                hash.block_signature = std::move(sig.value);
+              },
+              [](iroha::expected::Error<std::string> &) {});
+      votes.push_back(CryptoProviderImpl(keypair, factory).getVote(hash));
+    }
+    return votes;
+  }
+
+  proto::State serializeVotes(const std::vector<VoteMessage> &votes) {
+    proto::State state;
+    for (const auto &vote : votes) {
+      *state.add_votes() = PbConverters::serializeVote(vote);
+    }
+    return state;
+  }
+
+  proto::State serializeCertificate(const std::vector<VoteMessage> &votes) {
+    proto::State state;
+    *state.mutable_certificate() = *PbConverters::serializeCertificate(votes);
+    return state;
+  }
+}  // namespace
+
+static void BM_SerializeVotes(benchmark::State &state) {
+  const auto commit = makeCommit(state.range(0));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(serializeVotes(commit).SerializeAsString());
+  }
+  state.counters["bytes"] = serializeVotes(commit).ByteSizeLong();
+}
+BENCHMARK(BM_SerializeVotes)->Arg(4)->Arg(100);
+
+static void BM_SerializeCertificate(benchmark::State &state) {
+  const auto commit = makeCommit(state.range(0));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(serializeCertificate(commit).SerializeAsString());
+  }
+  state.counters["bytes"] = serializeCertificate(commit).ByteSizeLong();
+}
+BENCHMARK(BM_SerializeCertificate)->Arg(4)->Arg(100);
+
+static void BM_DeserializeVotes(benchmark::State &state) {
+  const auto message =
+      serializeVotes(makeCommit(state.range(0))).SerializeAsString();
+
+  for (auto _ : state) {
+    proto::State pb_state;
+    pb_state.ParseFromString(message);
+    std::vector<VoteMessage> votes;
+    for (const auto &pb_vote : pb_state.votes()) {
+      votes.push_back(*PbConverters::deserializeVote(pb_vote));
+    }
+    benchmark::DoNotOptimize(votes);
+  }
+}
+BENCHMARK(BM_DeserializeVotes)->Arg(4)->Arg(100);
+
+static void BM_DeserializeCertificate(benchmark::State &state) {
+  const auto message =
+      serializeCertificate(makeCommit(state.range(0))).SerializeAsString();
+
+  for (auto _ : state) {
+    proto::State pb_state;
+    pb_state.ParseFromString(message);
+    benchmark::DoNotOptimize(
+        PbConverters::deserializeCertificate(pb_state.certificate()));
+  }
+}
+BENCHMARK(BM_DeserializeCertificate)->Arg(4)->Arg(100);
+
+/**
+ * Verification of all votes of a received commit
+ */
+static void BM_VerifyCommit(benchmark::State &state) {
+  const auto commit = makeCommit(state.range(0));
+  CryptoProviderImpl crypto_provider(
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair(),
+      nullptr);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto_provider.verify(commit));
+  }
+}
+BENCHMARK(BM_VerifyCommit)->Arg(4)->Arg(100);
+
+BENCHMARK_MAIN();
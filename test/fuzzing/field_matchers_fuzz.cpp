@@ -0,0 +1,24 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <cstdlib>
+#include <iostream>
+
+#include "module/shared_model/validators/field_regexes.hpp"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size) {
+  static FieldRegexes regexes;
+  std::string input(reinterpret_cast<const char *>(data), size);
+  for (const auto &c : regexes.cases) {
+    if (std::regex_match(input, c.regex) != c.matcher(input)) {
+      std::cerr << "Matcher " << c.name << " disagrees with regex on '"
+                << input << "'" << std::endl;
+      std::abort();
+    }
+  }
+  return 0;
+}
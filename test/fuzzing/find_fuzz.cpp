@@ -40,7 +40,7 @@ struct QueryFixture {
     auto query_response_factory_ =
         std::make_shared<shared_model::proto::ProtoQueryResponseFactory>();
     qry_processor_ = std::make_shared<iroha::torii::QueryProcessorImpl>(
-        storage_, storage_, pending_transactions_, query_response_factory_);
+        storage_, pending_transactions_, query_response_factory_);
 
     std::unique_ptr<shared_model::validation::AbstractValidator<
         shared_model::interface::Query>>
@@ -55,8 +55,8 @@ struct QueryFixture {
             shared_model::interface::Query,
             shared_model::proto::Query>>(std::move(query_validator),
                                          std::move(proto_query_validator));
-    service_ =
-        std::make_shared<torii::QueryService>(qry_processor_, query_factory);
+    service_ = std::make_shared<torii::QueryService>(
+        qry_processor_, query_factory, nullptr);
   }
 };
 
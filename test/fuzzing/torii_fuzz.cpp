@@ -20,6 +20,7 @@
 #include "synchronizer/synchronizer_common.hpp"
 #include "torii/impl/command_service_impl.hpp"
 #include "torii/impl/status_bus_impl.hpp"
+#include "torii/impl/transaction_intake.hpp"
 #include "torii/processor/transaction_processor_impl.hpp"
 #include "transaction.pb.h"
 #include "validators/default_validator.hpp"
@@ -102,6 +103,7 @@ struct CommandFixture {
 
     service_transport_ = std::make_shared<torii::CommandServiceTransportGrpc>(
         service_,
+        std::make_shared<torii::TransactionIntake>(service_, 1024, 1),
         status_bus,
         status_factory,
         transaction_factory,
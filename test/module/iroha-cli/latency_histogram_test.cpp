@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "latency_histogram.hpp"
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+using iroha_cli::LatencyHistogram;
+
+/**
+ * @given empty histogram
+ * @when its statistics are requested
+ * @then all of them are zero
+ */
+TEST(LatencyHistogramTest, Empty) {
+  LatencyHistogram histogram;
+
+  ASSERT_EQ(histogram.count(), 0u);
+  ASSERT_EQ(histogram.min(), 0u);
+  ASSERT_EQ(histogram.max(), 0u);
+  ASSERT_EQ(histogram.mean(), 0.);
+  ASSERT_EQ(histogram.valueAtPercentile(50), 0u);
+}
+
+/**
+ * @given histogram with 3 significant digits
+ * @when values from 1 to 1000 are recorded, which are below the limit of
+ * single unit resolution
+ * @then percentiles are exact
+ */
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+  LatencyHistogram histogram(3);
+  for (uint64_t value = 1000; value >= 1; --value) {
+    histogram.record(value);
+  }
+
+  ASSERT_EQ(histogram.count(), 1000u);
+  ASSERT_EQ(histogram.min(), 1u);
+  ASSERT_EQ(histogram.max(), 1000u);
+  ASSERT_DOUBLE_EQ(histogram.mean(), 500.5);
+  ASSERT_EQ(histogram.valueAtPercentile(0), 1u);
+  ASSERT_EQ(histogram.valueAtPercentile(0.1), 1u);
+  ASSERT_EQ(histogram.valueAtPercentile(50), 500u);
+  ASSERT_EQ(histogram.valueAtPercentile(99), 990u);
+  ASSERT_EQ(histogram.valueAtPercentile(99.95), 1000u);
+  ASSERT_EQ(histogram.valueAtPercentile(100), 1000u);
+}
+
+/**
+ * @given histogram with 3 significant digits
+ * @when values of very different magnitudes are recorded
+ * @then every percentile is within 0.1% of the recorded value and not
+ * greater than the maximum
+ */
+TEST(LatencyHistogramTest, LargeValuesKeepRelativePrecision) {
+  LatencyHistogram histogram(3);
+  const std::vector<uint64_t> values = {
+      3, 1234, 56789, 1000003, 123456789, 98765432101ull};
+  for (auto value : values) {
+    histogram.record(value);
+  }
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    auto percentile = 100. * (i + 0.5) / values.size();
+    auto value = histogram.valueAtPercentile(percentile);
+    EXPECT_GE(value, values[i]) << "percentile " << percentile;
+    EXPECT_LE(value, values[i] + values[i] / 1000) << "percentile "
+                                                   << percentile;
+  }
+  ASSERT_EQ(histogram.valueAtPercentile(100), values.back());
+}
+
+/**
+ * @given histogram with values from 1 to 100
+ * @when its percentile distribution is printed
+ * @then the distribution starts at the minimum and ends at 100% with all
+ * values counted
+ */
+TEST(LatencyHistogramTest, PrintPercentileDistribution) {
+  LatencyHistogram histogram;
+  for (uint64_t value = 1; value <= 100; ++value) {
+    histogram.record(value);
+  }
+  std::stringstream ss;
+
+  histogram.printPercentileDistribution(ss, 1);
+
+  auto output = ss.str();
+  EXPECT_NE(output.find("1.000       0.000000           1"),
+            std::string::npos)
+      << output;
+  EXPECT_NE(output.find("100.000       1.000000         100"),
+            std::string::npos)
+      << output;
+  EXPECT_NE(output.find("#[Mean = 50.500, Max = 100.000, Total count = 100]"),
+            std::string::npos)
+      << output;
+}
@@ -0,0 +1,194 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load_generator.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+
+using iroha_cli::LoadGenerator;
+using namespace std::chrono_literals;
+
+/**
+ * Peer, which accepts every transaction and replies to status requests with
+ * COMMITTED, except for the first transactions it receives, which never get
+ * a status
+ */
+class FakePeer {
+ public:
+  explicit FakePeer(size_t lost_count = 0) : lost_count_(lost_count) {}
+
+  class Transport : public LoadGenerator::Transport {
+   public:
+    explicit Transport(FakePeer &peer) : peer_(peer) {}
+
+    boost::optional<std::string> sendTxList(
+        const iroha::protocol::TxList &tx_list) override {
+      std::lock_guard<std::mutex> lock(peer_.mutex_);
+      peer_.send_times_.push_back(LoadGenerator::Clock::now());
+      for (const auto &tx : tx_list.transactions()) {
+        auto hash = shared_model::proto::Transaction(tx).hash();
+        if (peer_.received_++ >= peer_.lost_count_) {
+          peer_.pending_.insert(hash.hex());
+        }
+      }
+      peer_.max_outstanding_ = std::max(
+          peer_.max_outstanding_, peer_.received_ - peer_.answered_);
+      return boost::none;
+    }
+
+    void followTxStatuses(
+        const std::vector<std::string> &tx_hashes,
+        const std::function<void(const iroha::protocol::ToriiResponse &)>
+            &on_status) override {
+      std::vector<iroha::protocol::ToriiResponse> responses;
+      {
+        std::lock_guard<std::mutex> lock(peer_.mutex_);
+        for (const auto &hash : tx_hashes) {
+          auto it = peer_.pending_.find(hash);
+          if (it == peer_.pending_.end()) {
+            continue;
+          }
+          iroha::protocol::ToriiResponse response;
+          // as a real peer, the hash is reported in hex
+          response.set_tx_hash(*it);
+          response.set_tx_status(iroha::protocol::TxStatus::COMMITTED);
+          responses.push_back(std::move(response));
+          peer_.pending_.erase(it);
+          ++peer_.answered_;
+        }
+      }
+      for (const auto &response : responses) {
+        on_status(response);
+      }
+    }
+
+   private:
+    FakePeer &peer_;
+  };
+
+  LoadGenerator::TransportFactory factory() {
+    return [this] { return std::make_unique<Transport>(*this); };
+  }
+
+  /// times of sent requests in order of sending
+  std::vector<LoadGenerator::Clock::time_point> sendTimes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return send_times_;
+  }
+
+  /// largest number of received transactions without a status
+  size_t maxOutstanding() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_outstanding_;
+  }
+
+ private:
+  const size_t lost_count_;
+  mutable std::mutex mutex_;
+  /// hex hashes of transactions without a status
+  std::set<std::string> pending_;
+  std::vector<LoadGenerator::Clock::time_point> send_times_;
+  size_t received_ = 0;
+  size_t answered_ = 0;
+  size_t max_outstanding_ = 0;
+};
+
+class LoadGeneratorTest : public ::testing::Test {
+ public:
+  LoadGenerator::Config makeConfig(size_t transactions,
+                                   size_t batch_size,
+                                   double rate,
+                                   size_t max_in_flight) {
+    LoadGenerator::Config config;
+    config.account_id = "admin@test";
+    config.keypairs = {keypair};
+    config.transactions = transactions;
+    config.batch_size = batch_size;
+    config.rate = rate;
+    config.max_in_flight = max_in_flight;
+    config.senders = 4;
+    return config;
+  }
+
+  static std::string report(const LoadGenerator &generator) {
+    std::stringstream ss;
+    generator.printReport(ss);
+    return ss.str();
+  }
+
+  shared_model::crypto::Keypair keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+};
+
+/**
+ * @given peer, which commits every transaction
+ * @when load is generated in the closed loop
+ * @then all transactions are committed and the peer never has more
+ * transactions without a status than allowed
+ */
+TEST_F(LoadGeneratorTest, ClosedLoopLimitsTransactionsInFlight) {
+  FakePeer peer;
+  LoadGenerator generator(makeConfig(100, 10, 0, 20), peer.factory());
+
+  generator.run();
+
+  auto output = report(generator);
+  EXPECT_NE(output.find("COMMITTED: 100\n"), std::string::npos) << output;
+  EXPECT_LE(peer.maxOutstanding(), 20u);
+  EXPECT_EQ(peer.sendTimes().size(), 10u);
+}
+
+/**
+ * @given peer, which never replies with statuses
+ * @when load is generated in the open loop with a rate of 200 transactions
+ * per second
+ * @then all requests are sent regardless of statuses, and request k is not
+ * sent earlier than its scheduled time
+ */
+TEST_F(LoadGeneratorTest, OpenLoopKeepsRate) {
+  FakePeer peer(50);
+  LoadGenerator generator(makeConfig(50, 10, 200, 1), peer.factory());
+
+  generator.run();
+
+  auto times = peer.sendTimes();
+  ASSERT_EQ(times.size(), 5u);
+  for (size_t k = 1; k < times.size(); ++k) {
+    // a delay of the first request shortens the distance to the other ones
+    EXPECT_GE(times[k] - times[0], k * 50ms - 20ms) << "request " << k;
+  }
+  auto output = report(generator);
+  EXPECT_NE(output.find("without final status: 50\n"), std::string::npos)
+      << output;
+}
+
+/**
+ * @given peer, which never replies to the first batch of transactions
+ * @when load is generated in the closed loop, which has place for one batch
+ * only, with a status timeout
+ * @then the lost transactions are counted as failed after the timeout and
+ * the other ones are sent and committed
+ */
+TEST_F(LoadGeneratorTest, ClosedLoopTimesOutLostTransactions) {
+  FakePeer peer(10);
+  auto config = makeConfig(30, 10, 0, 10);
+  config.status_timeout = 200ms;
+  LoadGenerator generator(std::move(config), peer.factory());
+
+  generator.run();
+
+  auto output = report(generator);
+  EXPECT_NE(output.find("TIMEOUT: 10\n"), std::string::npos) << output;
+  EXPECT_NE(output.find("COMMITTED: 20\n"), std::string::npos) << output;
+  EXPECT_EQ(output.find("without final status"), std::string::npos)
+      << output;
+}
@@ -279,6 +279,32 @@ TEST_F(BlockQueryTest, HasTxWithRejectedHash) {
   });
 }
 
+/**
+ * @given block store with preinserted blocks
+ * @when checkTxPresence is invoked on committed, rejected and missing hashes
+ * at once
+ * @then statuses are returned in the order of the hashes
+ */
+TEST_F(BlockQueryTest, HasTxWithSeveralHashes) {
+  shared_model::crypto::Hash missing_tx_hash(zero_string);
+  std::vector<shared_model::crypto::Hash> hashes{
+      missing_tx_hash, tx_hashes.at(0), rejected_hash};
+  auto statuses = blocks->checkTxPresence(hashes);
+  ASSERT_TRUE(statuses);
+  ASSERT_EQ(statuses->size(), 3);
+  ASSERT_NO_THROW({
+    auto missing =
+        boost::get<tx_cache_status_responses::Missing>(statuses->at(0));
+    ASSERT_EQ(missing.hash, missing_tx_hash);
+    auto committed =
+        boost::get<tx_cache_status_responses::Committed>(statuses->at(1));
+    ASSERT_EQ(committed.hash, tx_hashes.at(0));
+    auto rejected =
+        boost::get<tx_cache_status_responses::Rejected>(statuses->at(2));
+    ASSERT_EQ(rejected.hash, rejected_hash);
+  });
+}
+
 /**
  * @given block store with preinserted blocks
  * @when getTopBlock is invoked on this block store
@@ -216,3 +216,53 @@ TEST_F(BlStore_Test, WriteDeniedFolder) {
   auto res = bl_store->add(id, block);
   ASSERT_FALSE(res);
 }
+
+/**
+ * @given block store with an entry added with its parts
+ * @when parts are read
+ * @then the same parts are returned, and each of them reads its bytes only
+ */
+TEST_F(BlStore_Test, ReadParts) {
+  auto store = FlatFile::create(block_store_path);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  auto id = 1u;
+  auto data = iroha::stringToBytes("[first,second]");
+  FlatFile::Parts parts{{1, 5}, {7, 6}};
+
+  ASSERT_TRUE(bl_store->add(id, data, parts));
+
+  auto res = bl_store->parts(id);
+  ASSERT_TRUE(res);
+  ASSERT_EQ(res->size(), parts.size());
+  auto first = bl_store->get(id, res->at(0));
+  auto second = bl_store->get(id, res->at(1));
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  ASSERT_EQ(iroha::bytesToString(*first), "first");
+  ASSERT_EQ(iroha::bytesToString(*second), "second");
+  ASSERT_FALSE(bl_store->get(id, FlatFile::Part{10, 10}));
+}
+
+/**
+ * @given block store with entries added with and without parts
+ * @when new block storage is initialized from the folder
+ * @then files with parts are not taken for entries, and entries without
+ * parts have none
+ */
+TEST_F(BlStore_Test, PartsAreNotEntries) {
+  {
+    auto store = FlatFile::create(block_store_path);
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    bl_store->add(1u, block, FlatFile::Parts{{0, 1}});
+    bl_store->add(2u, block);
+  }
+
+  auto store = FlatFile::create(block_store_path);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_EQ(bl_store->last_id(), 2);
+  ASSERT_TRUE(bl_store->parts(1u));
+  ASSERT_FALSE(bl_store->parts(2u));
+}
@@ -0,0 +1,445 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/in_memory_command_executor.hpp"
+
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/postgres_wsv_state_storage.hpp"
+#include "framework/result_fixture.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
+#include "module/shared_model/mock_objects_factories/mock_command_factory.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    using namespace framework::expected;
+    using shared_model::interface::permissions::Grantable;
+    using shared_model::interface::permissions::Role;
+
+    /// @return the value with the key, none if there is no such key
+    template <typename Map>
+    boost::optional<typename Map::mapped_type> found(
+        const Map &map, const typename Map::key_type &key) {
+      auto it = map.find(key);
+      if (it == map.end()) {
+        return boost::none;
+      }
+      return it->second;
+    }
+
+    /**
+     * Runs the same commands with Postgres and in-memory executors on the same
+     * initial state and checks that results and resulting tables are equal
+     */
+    class InMemoryCommandExecutorTest : public AmetsuchiTest {
+     public:
+      /// command applied to an executor
+      using Step = std::function<CommandResult(CommandExecutor &)>;
+
+      void SetUp() override {
+        AmetsuchiTest::SetUp();
+        sql = std::make_unique<soci::session>(*soci::factory_postgresql(),
+                                              pgopt_);
+        PostgresCommandExecutor::prepareStatements(*sql);
+      }
+
+      void TearDown() override {
+        sql->close();
+        AmetsuchiTest::TearDown();
+      }
+
+      /**
+       * Make a step which executes the command on behalf of the creator
+       * @param validate - whether permissions are checked
+       */
+      template <typename CommandPtr>
+      Step step(CommandPtr command,
+                bool validate = true,
+                const std::string &creator = "id@domain") {
+        std::shared_ptr<typename CommandPtr::element_type> shared =
+            std::move(command);
+        return [shared, validate, creator](CommandExecutor &executor) {
+          executor.doValidation(validate);
+          executor.setCreatorAccountId(creator);
+          return executor(*shared);
+        };
+      }
+
+      /**
+       * Steps which create the account "id@domain" with role "all", which has
+       * every permission, without validation, and an asset "coin#domain"
+       */
+      std::vector<Step> genesis() {
+        const auto &commands = *mock_command_factory;
+        shared_model::interface::RolePermissionSet all;
+        all.set();
+        std::vector<Step> steps;
+        steps.push_back(step(
+            commands.constructCreateRole("user", {Role::kReceive}), false));
+        steps.push_back(step(commands.constructCreateRole("all", all), false));
+        steps.push_back(
+            step(commands.constructCreateDomain("domain", "user"), false));
+        steps.push_back(step(
+            commands.constructCreateAccount("id", "domain", pubkey(1)), false));
+        steps.push_back(
+            step(commands.constructAppendRole("id@domain", "all"), false));
+        steps.push_back(
+            step(commands.constructCreateAsset("coin", "domain", 2), false));
+        return steps;
+      }
+
+      static shared_model::interface::types::PubkeyType pubkey(char c) {
+        return shared_model::interface::types::PubkeyType(std::string(32, c));
+      }
+
+      /// all WSV tables as JSON, rows are ordered
+      std::string dumpWsv() {
+        static const std::vector<std::string> kTables = {
+            "role",
+            "role_has_permissions",
+            "domain",
+            "signatory",
+            "account",
+            "account_has_signatory",
+            "peer",
+            "asset",
+            "account_has_asset",
+            "account_has_roles",
+            "account_has_grantable_permissions"};
+        std::string dump;
+        for (const auto &table : kTables) {
+          std::string rows;
+          *sql << "SELECT COALESCE(string_agg(row_to_json(t)::text, ',' "
+                  "ORDER BY row_to_json(t)::text), '') FROM "
+                  + table + " AS t",
+              soci::into(rows);
+          dump.append(table).append(": ").append(rows).append("\n");
+        }
+        return dump;
+      }
+
+      struct Outcome {
+        /// error code of every step, 0 if the step succeeded
+        std::vector<uint32_t> codes;
+        std::string wsv;
+      };
+
+      static uint32_t code(const CommandResult &result) {
+        auto error = err(result);
+        return error ? error->error.error_code : 0;
+      }
+
+      /**
+       * Apply steps with Postgres executor; a failed step is rolled back like
+       * a failed transaction
+       */
+      Outcome runPostgres(const std::vector<Step> &steps) {
+        Outcome outcome;
+        PostgresCommandExecutor executor(*sql, perm_converter_);
+        *sql << "BEGIN";
+        for (const auto &s : steps) {
+          *sql << "SAVEPOINT step";
+          outcome.codes.push_back(code(s(executor)));
+          *sql << (outcome.codes.back() ? "ROLLBACK TO SAVEPOINT step"
+                                        : "RELEASE SAVEPOINT step");
+        }
+        outcome.wsv = dumpWsv();
+        *sql << "ROLLBACK";
+        return outcome;
+      }
+
+      /**
+       * Apply steps with in-memory executor and write the state back
+       * @param write_each - write the state back after every step instead of
+       * once after all steps
+       */
+      Outcome runInMemory(const std::vector<Step> &steps,
+                          bool write_each = false) {
+        Outcome outcome;
+        auto storage = std::make_shared<PostgresWsvStateStorage>(*sql);
+        auto state = std::make_shared<InMemoryWsvState>(storage);
+        InMemoryCommandExecutor executor(state);
+        *sql << "BEGIN";
+        for (const auto &s : steps) {
+          auto savepoint = state->savepoint();
+          outcome.codes.push_back(code(s(executor)));
+          if (outcome.codes.back()) {
+            state->rollbackTo(savepoint);
+          }
+          if (write_each) {
+            storage->writeBack(*state);
+          }
+        }
+        storage->writeBack(*state);
+        outcome.wsv = dumpWsv();
+        *sql << "ROLLBACK";
+        return outcome;
+      }
+
+      /**
+       * Check that both executors give the same results and state
+       */
+      void checkSame(const std::vector<Step> &steps) {
+        auto expected = runPostgres(steps);
+        auto actual = runInMemory(steps);
+        EXPECT_EQ(expected.codes, actual.codes);
+        EXPECT_EQ(expected.wsv, actual.wsv);
+
+        auto actual_each = runInMemory(steps, true);
+        EXPECT_EQ(expected.codes, actual_each.codes);
+        EXPECT_EQ(expected.wsv, actual_each.wsv);
+      }
+
+      std::vector<Step> with(std::vector<Step> steps,
+                             std::vector<Step> more) {
+        steps.insert(steps.end(), more.begin(), more.end());
+        return steps;
+      }
+
+      std::unique_ptr<soci::session> sql;
+      std::unique_ptr<shared_model::interface::MockCommandFactory>
+          mock_command_factory =
+          std::make_unique<shared_model::interface::MockCommandFactory>();
+    };
+
+    /**
+     * @given account with an asset
+     * @when assets are added, subtracted and transferred, including amounts
+     * with different scales, overdrafts and transfers to missing accounts
+     * @then both executors give the same results and balances
+     */
+    TEST_F(InMemoryCommandExecutorTest, Assets) {
+      using shared_model::interface::Amount;
+      const auto &commands = *mock_command_factory;
+      std::vector<Step> steps;
+      steps.push_back(
+          step(commands.constructCreateAccount("dest", "domain", pubkey(2))));
+      steps.push_back(step(
+          commands.constructAddAssetQuantity("coin#domain", Amount("10.5"))));
+      steps.push_back(step(
+          commands.constructAddAssetQuantity("coin#domain", Amount("1.25"))));
+      steps.push_back(step(commands.constructSubtractAssetQuantity(
+          "coin#domain", Amount("100.00"))));
+      steps.push_back(step(commands.constructTransferAsset(
+          "id@domain", "dest@domain", "coin#domain", "", Amount("2.50"))));
+      steps.push_back(step(commands.constructTransferAsset(
+          "id@domain", "none@domain", "coin#domain", "", Amount("1.00"))));
+      steps.push_back(step(commands.constructTransferAsset(
+          "id@domain", "dest@domain", "coin#domain", "", Amount("100.00"))));
+      steps.push_back(step(
+          commands.constructAddAssetQuantity("none#domain", Amount("1.0"))));
+      steps.push_back(step(commands.constructSubtractAssetQuantity(
+          "coin#domain", Amount("9.25"))));
+      checkSame(with(genesis(), steps));
+    }
+
+    /**
+     * @given account with an asset
+     * @when it transfers the asset to itself, within its balance and over it
+     * @then the balance is unchanged with both executors, and the in-memory
+     * executor applies the transfer as a subtraction followed by an addition
+     * instead of failing with a general error
+     */
+    TEST_F(InMemoryCommandExecutorTest, TransferToItself) {
+      using shared_model::interface::Amount;
+      const auto &commands = *mock_command_factory;
+      std::vector<Step> steps;
+      steps.push_back(step(
+          commands.constructAddAssetQuantity("coin#domain", Amount("10.00"))));
+      steps.push_back(step(commands.constructTransferAsset(
+          "id@domain", "id@domain", "coin#domain", "", Amount("4.00"))));
+      steps.push_back(step(commands.constructTransferAsset(
+          "id@domain", "id@domain", "coin#domain", "", Amount("10.00"))));
+      steps.push_back(step(commands.constructTransferAsset(
+          "id@domain", "id@domain", "coin#domain", "", Amount("10.01"))));
+      steps.push_back(step(commands.constructSubtractAssetQuantity(
+          "coin#domain", Amount("10.00"))));
+      steps = with(genesis(), steps);
+      const auto first = genesis().size();
+
+      auto expected = runPostgres(steps);
+      for (auto write_each : {false, true}) {
+        auto actual = runInMemory(steps, write_each);
+        EXPECT_EQ(expected.wsv, actual.wsv);
+        ASSERT_EQ(expected.codes.size(), actual.codes.size());
+        for (size_t i = 0; i < first; ++i) {
+          EXPECT_EQ(expected.codes[i], actual.codes[i]);
+        }
+        EXPECT_EQ(actual.codes[first], 0u);
+        EXPECT_EQ(actual.codes[first + 1], 0u);
+        EXPECT_EQ(actual.codes[first + 2], 0u);
+        EXPECT_EQ(actual.codes[first + 3], 6u);
+        EXPECT_EQ(expected.codes[first + 3], 6u);
+        EXPECT_EQ(actual.codes[first + 4], 0u);
+        EXPECT_EQ(expected.codes[first + 4], 0u);
+      }
+    }
+
+    /**
+     * @given account with all permissions
+     * @when signatories and quorum are changed, including invalid changes
+     * @then both executors give the same results and signatories
+     */
+    TEST_F(InMemoryCommandExecutorTest, Signatories) {
+      const auto &commands = *mock_command_factory;
+      std::vector<Step> steps;
+      steps.push_back(
+          step(commands.constructAddSignatory(pubkey(2), "id@domain")));
+      steps.push_back(
+          step(commands.constructAddSignatory(pubkey(2), "id@domain")));
+      steps.push_back(step(commands.constructSetQuorum("id@domain", 2)));
+      steps.push_back(step(commands.constructSetQuorum("id@domain", 3)));
+      steps.push_back(
+          step(commands.constructRemoveSignatory("id@domain", pubkey(2))));
+      steps.push_back(step(commands.constructSetQuorum("id@domain", 1)));
+      steps.push_back(
+          step(commands.constructRemoveSignatory("id@domain", pubkey(2))));
+      steps.push_back(
+          step(commands.constructRemoveSignatory("id@domain", pubkey(1))));
+      steps.push_back(
+          step(commands.constructAddSignatory(pubkey(3), "none@domain")));
+      checkSame(with(genesis(), steps));
+    }
+
+    /**
+     * @given account with all permissions and another one with none
+     * @when roles are created, appended and detached and grantable
+     * permissions are granted and revoked, including commands without
+     * permissions
+     * @then both executors give the same results and tables
+     */
+    TEST_F(InMemoryCommandExecutorTest, RolesAndPermissions) {
+      const auto &commands = *mock_command_factory;
+      const std::string other = "other@domain";
+      std::vector<Step> steps;
+      steps.push_back(
+          step(commands.constructCreateAccount("other", "domain", pubkey(2))));
+      steps.push_back(
+          step(commands.constructCreateRole("reader", {Role::kGetMyAccount})));
+      steps.push_back(
+          step(commands.constructCreateRole("reader", {Role::kGetMyAccount})));
+      steps.push_back(step(commands.constructAppendRole(other, "reader")));
+      steps.push_back(step(commands.constructAppendRole(other, "reader")));
+      steps.push_back(step(commands.constructAppendRole(other, "missing")));
+      steps.push_back(step(
+          commands.constructGrantPermission(other, Grantable::kSetMyQuorum)));
+      steps.push_back(
+          step(commands.constructSetQuorum("id@domain", 1), true, other));
+      steps.push_back(step(
+          commands.constructRevokePermission(other, Grantable::kSetMyQuorum)));
+      steps.push_back(
+          step(commands.constructSetQuorum("id@domain", 1), true, other));
+      steps.push_back(
+          step(commands.constructCreateDomain("other", "reader"), true, other));
+      steps.push_back(step(commands.constructDetachRole(other, "reader")));
+      steps.push_back(step(commands.constructDetachRole(other, "reader")));
+      steps.push_back(step(commands.constructCreateDomain("other", "reader")));
+      steps.push_back(
+          step(commands.constructCreateAccount("third", "other", pubkey(3))));
+      checkSame(with(genesis(), steps));
+    }
+
+    /**
+     * @given account with all permissions
+     * @when account details are set by different writers and overwritten
+     * @then both executors give the same results and account data
+     */
+    TEST_F(InMemoryCommandExecutorTest, AccountDetails) {
+      const auto &commands = *mock_command_factory;
+      const std::string other = "other@domain";
+      std::vector<Step> steps;
+      steps.push_back(
+          step(commands.constructCreateAccount("other", "domain", pubkey(2))));
+      steps.push_back(
+          step(commands.constructSetAccountDetail("id@domain", "key", "v")));
+      steps.push_back(
+          step(commands.constructSetAccountDetail("id@domain", "key", "new")));
+      steps.push_back(
+          step(commands.constructSetAccountDetail(other, "key", "it's")));
+      steps.push_back(
+          step(commands.constructSetAccountDetail("id@domain", "key", "other"),
+               true,
+               other));
+      steps.push_back(
+          step(commands.constructSetAccountDetail("none@domain", "key", "v")));
+      checkSame(with(genesis(), steps));
+    }
+
+    /**
+     * @given state with accounts, roles, an asset, a balance and a grantable
+     * permission
+     * @when these and absent entities are loaded with one query
+     * @then the values are equal to the ones loaded one by one, and roles of
+     * the accounts are loaded as well
+     */
+    TEST_F(InMemoryCommandExecutorTest, LoadAllMatchesLoads) {
+      using shared_model::interface::Amount;
+      const auto &commands = *mock_command_factory;
+      std::vector<Step> steps;
+      steps.push_back(step(
+          commands.constructAddAssetQuantity("coin#domain", Amount("1.50"))));
+      steps.push_back(
+          step(commands.constructCreateAccount("dest", "domain", pubkey(2))));
+      steps.push_back(step(commands.constructGrantPermission(
+          "dest@domain", Grantable::kSetMyQuorum)));
+      PostgresCommandExecutor executor(*sql, perm_converter_);
+      *sql << "BEGIN";
+      for (const auto &s : with(genesis(), steps)) {
+        ASSERT_EQ(0u, code(s(executor)));
+      }
+
+      WsvStateKeys keys;
+      keys.domains = {"domain", "none"};
+      keys.accounts = {"id@domain", "dest@domain", "none@domain"};
+      keys.roles = {"user", "none"};
+      keys.assets = {"coin#domain", "none#domain"};
+      keys.balances = {{"id@domain", "coin#domain"},
+                       {"dest@domain", "coin#domain"}};
+      keys.grantable_permissions = {{"dest@domain", "id@domain"},
+                                    {"id@domain", "dest@domain"}};
+      PostgresWsvStateStorage storage(*sql);
+      auto values = storage.loadAll(keys);
+
+      auto role_ids = keys.roles;
+      for (const auto &domain_id : keys.domains) {
+        EXPECT_TRUE(storage.loadDomain(domain_id)
+                    == found(values.domains, domain_id));
+      }
+      for (const auto &account_id : keys.accounts) {
+        EXPECT_TRUE(storage.loadAccount(account_id)
+                    == found(values.accounts, account_id));
+        EXPECT_EQ(storage.loadSignatories(account_id),
+                  found(values.signatories, account_id)
+                      .value_or(std::set<std::string>{}));
+        auto roles = storage.loadAccountRoles(account_id);
+        EXPECT_EQ(roles,
+                  found(values.account_roles, account_id)
+                      .value_or(std::set<std::string>{}));
+        role_ids.insert(roles.begin(), roles.end());
+      }
+      ASSERT_EQ(1u, role_ids.count("all"));
+      for (const auto &role_id : role_ids) {
+        EXPECT_TRUE(storage.loadRole(role_id)
+                    == found(values.roles, role_id));
+      }
+      for (const auto &asset_id : keys.assets) {
+        EXPECT_TRUE(storage.loadAsset(asset_id)
+                    == found(values.assets, asset_id));
+      }
+      for (const auto &key : keys.balances) {
+        EXPECT_TRUE(storage.loadBalance(key.first, key.second)
+                    == found(values.balances, key));
+      }
+      for (const auto &key : keys.grantable_permissions) {
+        EXPECT_TRUE(storage.loadGrantablePermissions(key.first, key.second)
+                    == found(values.grantable_permissions, key));
+      }
+      EXPECT_EQ(1u, values.grantable_permissions.size());
+      *sql << "ROLLBACK";
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
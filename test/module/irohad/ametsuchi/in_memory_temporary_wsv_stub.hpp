@@ -0,0 +1,205 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_IN_MEMORY_TEMPORARY_WSV_STUB_HPP
+#define IROHA_IN_MEMORY_TEMPORARY_WSV_STUB_HPP
+
+#include <map>
+
+#include "ametsuchi/impl/in_memory_command_executor.hpp"
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
+#include "ametsuchi/temporary_factory.hpp"
+#include "ametsuchi/temporary_wsv.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Stub of the initial state of the ledger: domain "test" with accounts
+     * "user<i>@test", which have a role with all permissions and a balance of
+     * 10.00 of asset "coin#test"
+     */
+    class GenesisWsvStateLoaderStub : public WsvStateLoader {
+     public:
+      static constexpr auto kDomainId = "test";
+      static constexpr auto kRoleId = "user";
+      static constexpr auto kAssetId = "coin#test";
+      static constexpr auto kBalance = "10.00";
+
+      static std::string accountId(size_t i) {
+        return "user" + std::to_string(i) + "@" + kDomainId;
+      }
+
+      explicit GenesisWsvStateLoaderStub(size_t accounts_count) {
+        for (size_t i = 0; i < accounts_count; ++i) {
+          accounts_.emplace(accountId(i), WsvAccount{kDomainId, 1});
+        }
+      }
+
+      boost::optional<std::string> loadDomain(const std::string &id) override {
+        return boost::make_optional<std::string>(id == kDomainId, kRoleId);
+      }
+
+      boost::optional<WsvAccount> loadAccount(const std::string &id) override {
+        auto it = accounts_.find(id);
+        if (it == accounts_.end()) {
+          return boost::none;
+        }
+        return it->second;
+      }
+
+      std::set<std::string> loadSignatories(const std::string &) override {
+        return {};
+      }
+
+      std::set<std::string> loadAccountRoles(const std::string &id) override {
+        if (accounts_.count(id) == 0) {
+          return {};
+        }
+        return {kRoleId};
+      }
+
+      boost::optional<shared_model::interface::RolePermissionSet> loadRole(
+          const std::string &id) override {
+        shared_model::interface::RolePermissionSet all;
+        all.set();
+        return boost::make_optional(id == kRoleId, all);
+      }
+
+      boost::optional<shared_model::interface::GrantablePermissionSet>
+      loadGrantablePermissions(const std::string &,
+                               const std::string &) override {
+        return boost::none;
+      }
+
+      boost::optional<WsvAsset> loadAsset(const std::string &id) override {
+        return boost::make_optional(id == kAssetId, WsvAsset{kDomainId, 2});
+      }
+
+      boost::optional<WsvDecimal> loadBalance(
+          const std::string &account_id, const std::string &asset_id) override {
+        if (accounts_.count(account_id) == 0 or asset_id != kAssetId) {
+          return boost::none;
+        }
+        return WsvDecimal::fromString(kBalance);
+      }
+
+      boost::optional<std::string> loadPeerAddress(
+          const std::string &) override {
+        return boost::none;
+      }
+
+      bool loadPeerAddressTaken(const std::string &) override {
+        return false;
+      }
+
+     private:
+      std::map<std::string, WsvAccount> accounts_;
+    };
+
+    /**
+     * Stub of temporary wsv which applies commands with the in-memory
+     * executor and does not check signatures. Each instance has a state of
+     * its own, so instances may be used from different threads.
+     */
+    class InMemoryTemporaryWsvStub : public TemporaryWsv {
+     public:
+      struct SavepointWrapperStub : public TemporaryWsv::SavepointWrapper {
+        explicit SavepointWrapperStub(InMemoryWsvState &state)
+            : state_(state), savepoint_(state.savepoint()) {}
+
+        void release() override {
+          is_released_ = true;
+        }
+
+        ~SavepointWrapperStub() override {
+          if (not is_released_) {
+            state_.rollbackTo(savepoint_);
+          }
+        }
+
+       private:
+        InMemoryWsvState &state_;
+        InMemoryWsvState::Savepoint savepoint_;
+        bool is_released_ = false;
+      };
+
+      explicit InMemoryTemporaryWsvStub(std::shared_ptr<WsvStateLoader> loader)
+          : state(std::make_shared<InMemoryWsvState>(std::move(loader))),
+            command_executor_(state) {}
+
+      expected::Result<void, validation::CommandError> apply(
+          const shared_model::interface::Transaction &transaction) override {
+        SavepointWrapperStub savepoint(*state);
+        command_executor_.setCreatorAccountId(transaction.creatorAccountId());
+        command_executor_.doValidation(true);
+        const auto &commands = transaction.commands();
+        for (size_t i = 0; i < commands.size(); ++i) {
+          auto result =
+              boost::apply_visitor(command_executor_, commands[i].get());
+          if (auto error = boost::get<expected::Error<CommandError>>(&result)) {
+            return expected::makeError(
+                validation::CommandError{error->error.command_name,
+                                         error->error.error_code,
+                                         error->error.error_extra,
+                                         true,
+                                         i});
+          }
+        }
+        savepoint.release();
+        return {};
+      }
+
+      std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
+          const std::string &) override {
+        return std::make_unique<SavepointWrapperStub>(*state);
+      }
+
+      bool merge(TemporaryWsv &other) override {
+        auto stub = dynamic_cast<InMemoryTemporaryWsvStub *>(&other);
+        if (not stub or not merge_enabled) {
+          return false;
+        }
+        state->merge(stub->state->changes());
+        return true;
+      }
+
+      /// whether changes of other stubs are taken over or replayed
+      bool merge_enabled = true;
+
+      std::shared_ptr<InMemoryWsvState> state;
+
+     private:
+      InMemoryCommandExecutor command_executor_;
+    };
+
+    /**
+     * Stub of temporary factory, which creates in-memory temporary wsvs over
+     * the same initial state
+     */
+    class InMemoryTemporaryFactoryStub : public TemporaryFactory {
+     public:
+      explicit InMemoryTemporaryFactoryStub(
+          std::shared_ptr<WsvStateLoader> loader)
+          : loader_(std::move(loader)) {}
+
+      expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+      createTemporaryWsv() override {
+        return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+            std::make_unique<InMemoryTemporaryWsvStub>(loader_));
+      }
+
+      void prepareBlock(std::unique_ptr<TemporaryWsv>) override {}
+
+     private:
+      std::shared_ptr<WsvStateLoader> loader_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_IN_MEMORY_TEMPORARY_WSV_STUB_HPP
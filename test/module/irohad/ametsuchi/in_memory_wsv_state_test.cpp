@@ -0,0 +1,315 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/in_memory_wsv_state.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "ametsuchi/impl/postgres_wsv_state_storage.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Field;
+using ::testing::HasSubstr;
+using ::testing::Return;
+
+namespace {
+  class MockWsvStateLoader : public WsvStateLoader {
+   public:
+    MOCK_METHOD1(loadDomain,
+                 boost::optional<std::string>(const std::string &));
+    MOCK_METHOD1(loadAccount, boost::optional<WsvAccount>(const std::string &));
+    MOCK_METHOD1(loadSignatories, std::set<std::string>(const std::string &));
+    MOCK_METHOD1(loadAccountRoles, std::set<std::string>(const std::string &));
+    MOCK_METHOD1(loadRole,
+                 boost::optional<shared_model::interface::RolePermissionSet>(
+                     const std::string &));
+    MOCK_METHOD2(
+        loadGrantablePermissions,
+        boost::optional<shared_model::interface::GrantablePermissionSet>(
+            const std::string &, const std::string &));
+    MOCK_METHOD1(loadAsset, boost::optional<WsvAsset>(const std::string &));
+    MOCK_METHOD2(loadBalance,
+                 boost::optional<WsvDecimal>(const std::string &,
+                                             const std::string &));
+    MOCK_METHOD1(loadPeerAddress,
+                 boost::optional<std::string>(const std::string &));
+    MOCK_METHOD1(loadPeerAddressTaken, bool(const std::string &));
+    MOCK_METHOD1(loadAll, WsvStateValues(const WsvStateKeys &));
+  };
+
+  WsvDecimal decimal(const std::string &str) {
+    return *WsvDecimal::fromString(str);
+  }
+}  // namespace
+
+class InMemoryWsvStateTest : public ::testing::Test {
+ public:
+  std::shared_ptr<MockWsvStateLoader> loader =
+      std::make_shared<MockWsvStateLoader>();
+  InMemoryWsvState state{loader};
+
+  const std::string account_id = "id@domain";
+  const std::string asset_id = "coin#domain";
+};
+
+/**
+ * @given state with an account in the loader
+ * @when the account is read several times
+ * @then it is loaded only once
+ */
+TEST_F(InMemoryWsvStateTest, LoadsOnce) {
+  EXPECT_CALL(*loader, loadAccount(account_id))
+      .WillOnce(Return(WsvAccount{"domain", 1}));
+
+  ASSERT_TRUE(state.account(account_id));
+  EXPECT_EQ(WsvAccount({"domain", 1}), *state.account(account_id));
+}
+
+/**
+ * @given state without the account in the loader
+ * @when the missing account is read several times
+ * @then the absence is cached as well
+ */
+TEST_F(InMemoryWsvStateTest, LoadsAbsentOnce) {
+  EXPECT_CALL(*loader, loadAccount(account_id))
+      .WillOnce(Return(boost::none));
+
+  EXPECT_FALSE(state.account(account_id));
+  EXPECT_FALSE(state.account(account_id));
+}
+
+/**
+ * @given state with a balance changed after a savepoint
+ * @when the state is rolled back to the savepoint
+ * @then the balance before the savepoint is restored and there are no changes
+ */
+TEST_F(InMemoryWsvStateTest, RollbackRestoresValues) {
+  EXPECT_CALL(*loader, loadBalance(account_id, asset_id))
+      .WillOnce(Return(decimal("1.0")));
+
+  auto savepoint = state.savepoint();
+  state.putBalance(account_id, asset_id, decimal("2.0"));
+  state.putBalance(account_id, asset_id, decimal("3.0"));
+  state.appendAccountDetail({account_id, account_id, "key", "\"value\""});
+  ASSERT_EQ(decimal("3.0"), *state.balance(account_id, asset_id));
+
+  state.rollbackTo(savepoint);
+
+  EXPECT_EQ(decimal("1.0"), *state.balance(account_id, asset_id));
+  EXPECT_TRUE(state.changes().empty());
+}
+
+/**
+ * @given state with nested savepoints
+ * @when the state is rolled back to the inner one
+ * @then only writes after the inner savepoint are undone
+ */
+TEST_F(InMemoryWsvStateTest, RollbackToInnerSavepoint) {
+  EXPECT_CALL(*loader, loadDomain("domain")).WillOnce(Return(boost::none));
+  EXPECT_CALL(*loader, loadDomain("other")).WillOnce(Return(boost::none));
+
+  state.putDomain("domain", "user");
+  auto savepoint = state.savepoint();
+  state.putDomain("other", "user");
+  state.rollbackTo(savepoint);
+
+  EXPECT_TRUE(state.domain("domain"));
+  EXPECT_FALSE(state.domain("other"));
+}
+
+/**
+ * @given state with loaded signatories and accounts
+ * @when signatories are changed, an account is changed and restored and
+ * another one is created
+ * @then changes contain only the net difference against loaded values
+ */
+TEST_F(InMemoryWsvStateTest, ChangesAreNet) {
+  EXPECT_CALL(*loader, loadSignatories(account_id))
+      .WillOnce(Return(std::set<std::string>{"a", "b"}));
+  EXPECT_CALL(*loader, loadAccount(account_id))
+      .WillOnce(Return(WsvAccount{"domain", 1}));
+  EXPECT_CALL(*loader, loadAccount("new@domain"))
+      .WillOnce(Return(boost::none));
+
+  state.putSignatories(account_id, {"b", "c"});
+  state.putAccount(account_id, {"domain", 2});
+  state.putAccount(account_id, {"domain", 1});
+  state.putAccount("new@domain", {"domain", 1});
+
+  auto changes = state.changes();
+  ASSERT_EQ(1u, changes.signatories.size());
+  EXPECT_EQ(account_id, changes.signatories[0].account_id);
+  EXPECT_EQ(std::vector<std::string>{"c"}, changes.signatories[0].added);
+  EXPECT_EQ(std::vector<std::string>{"a"}, changes.signatories[0].removed);
+  EXPECT_TRUE(changes.updated_accounts.empty());
+  ASSERT_EQ(1u, changes.created_accounts.size());
+  EXPECT_EQ("new@domain", changes.created_accounts[0].first);
+}
+
+/**
+ * @given state with changes
+ * @when the state is marked as written
+ * @then there are no changes and values are kept in memory
+ */
+TEST_F(InMemoryWsvStateTest, MarkWritten) {
+  EXPECT_CALL(*loader, loadAsset(asset_id)).WillOnce(Return(boost::none));
+
+  state.putAsset(asset_id, {"domain", 2});
+  ASSERT_FALSE(state.changes().empty());
+
+  state.markWritten();
+
+  EXPECT_TRUE(state.changes().empty());
+  EXPECT_TRUE(state.asset(asset_id));
+}
+
+/**
+ * @given state with a loaded account
+ * @when the state is cleared
+ * @then the account is loaded again on the next access
+ */
+TEST_F(InMemoryWsvStateTest, ClearReloads) {
+  EXPECT_CALL(*loader, loadAccount(account_id))
+      .Times(2)
+      .WillRepeatedly(Return(WsvAccount{"domain", 1}));
+
+  state.account(account_id);
+  state.clear();
+  state.account(account_id);
+}
+
+/**
+ * @given account with two roles
+ * @when account permissions are requested
+ * @then they are the union of permissions of the roles
+ */
+TEST_F(InMemoryWsvStateTest, AccountPermissionsAreUnion) {
+  using shared_model::interface::RolePermissionSet;
+  using shared_model::interface::permissions::Role;
+  EXPECT_CALL(*loader, loadAccountRoles(account_id))
+      .WillOnce(Return(std::set<std::string>{"first", "second"}));
+  EXPECT_CALL(*loader, loadRole("first"))
+      .WillOnce(Return(RolePermissionSet{Role::kReceive}));
+  EXPECT_CALL(*loader, loadRole("second"))
+      .WillOnce(Return(RolePermissionSet{Role::kTransfer}));
+
+  auto permissions = state.accountPermissions(account_id);
+
+  EXPECT_TRUE(permissions.test(Role::kReceive));
+  EXPECT_TRUE(permissions.test(Role::kTransfer));
+  EXPECT_FALSE(permissions.test(Role::kAddPeer));
+}
+
+/**
+ * @given state with a domain loaded on access
+ * @when domains, an account with its role, an asset and a balance are
+ * preloaded twice
+ * @then only the entities, which are not in memory, are loaded with one call
+ * AND found and absent entities are then served from memory
+ */
+TEST_F(InMemoryWsvStateTest, PreloadLoadsMissingOnce) {
+  using shared_model::interface::RolePermissionSet;
+  using shared_model::interface::permissions::Role;
+  EXPECT_CALL(*loader, loadDomain("domain")).WillOnce(Return(boost::none));
+  state.domain("domain");
+
+  WsvStateKeys keys;
+  keys.domains = {"domain", "other"};
+  keys.accounts = {account_id};
+  keys.assets = {asset_id};
+  keys.balances = {{account_id, asset_id}};
+  WsvStateValues values;
+  values.accounts.emplace(account_id, WsvAccount{"domain", 1});
+  values.signatories[account_id] = {"a"};
+  values.account_roles[account_id] = {"user"};
+  values.roles.emplace("user", RolePermissionSet{Role::kReceive});
+  values.assets.emplace(asset_id, WsvAsset{"domain", 2});
+  EXPECT_CALL(*loader,
+              loadAll(Field(&WsvStateKeys::domains, ElementsAre("other"))))
+      .WillOnce(Return(values));
+  EXPECT_CALL(*loader, loadAccount(_)).Times(0);
+  EXPECT_CALL(*loader, loadRole(_)).Times(0);
+  EXPECT_CALL(*loader, loadBalance(_, _)).Times(0);
+
+  state.preload(keys);
+  state.preload(keys);
+
+  EXPECT_FALSE(state.domain("other"));
+  EXPECT_EQ(WsvAccount({"domain", 1}), *state.account(account_id));
+  EXPECT_EQ(std::set<std::string>{"a"}, state.signatories(account_id));
+  EXPECT_TRUE(state.accountPermissions(account_id).test(Role::kReceive));
+  EXPECT_EQ(WsvAsset({"domain", 2}), *state.asset(asset_id));
+  EXPECT_FALSE(state.balance(account_id, asset_id));
+}
+
+/**
+ * @given decimals with different scales
+ * @when they are added and subtracted
+ * @then the result has the largest scale, like Postgres numeric
+ */
+TEST(WsvDecimalTest, ScaleOfResultIsLargest) {
+  EXPECT_EQ("3.50", (decimal("1.5") + decimal("2.00")).toString());
+  EXPECT_EQ("-0.50", (decimal("1.5") - decimal("2.00")).toString());
+  EXPECT_TRUE((decimal("1.5") - decimal("2.00")).isNegative());
+  EXPECT_EQ("0.0", (decimal("1.0") - decimal("1")).toString());
+}
+
+/**
+ * @given decimals with equal values and different scales
+ * @when they are compared
+ * @then they are different, because they are stored differently
+ */
+TEST(WsvDecimalTest, EqualityIsScaleSensitive) {
+  EXPECT_NE(decimal("1.0"), decimal("1.00"));
+  EXPECT_EQ(decimal("1.0"), decimal("1.0"));
+}
+
+/**
+ * @given malformed numbers
+ * @when they are parsed
+ * @then none is returned
+ */
+TEST(WsvDecimalTest, MalformedStrings) {
+  EXPECT_FALSE(WsvDecimal::fromString(""));
+  EXPECT_FALSE(WsvDecimal::fromString("1."));
+  EXPECT_FALSE(WsvDecimal::fromString("1.2.3"));
+  EXPECT_FALSE(WsvDecimal::fromString("a"));
+}
+
+/**
+ * @given decimal close to 2^256
+ * @when it is checked against the power of two
+ * @then the check is exact
+ */
+TEST(WsvDecimalTest, PowerOfTwoBound) {
+  auto max = decimal(
+      "115792089237316195423570985008687907853269984665640564039457584007913"
+      "129639935.0");  // 2^256 - 1
+  EXPECT_TRUE(max.lessThanPowerOfTwo(256));
+  EXPECT_FALSE((max + decimal("1")).lessThanPowerOfTwo(256));
+}
+
+/**
+ * @given changes with quotes in ids and an account detail
+ * @when write back query is made
+ * @then values are escaped and details are written after accounts
+ */
+TEST(PostgresWsvStateStorageTest, WriteBackQuery) {
+  InMemoryWsvState::Changes changes;
+  changes.created_accounts.emplace_back("o'neil@domain",
+                                        WsvAccount{"domain", 1});
+  changes.account_details.push_back(
+      {"o'neil@domain", "o'neil@domain", "key", "\"value\""});
+
+  auto query = PostgresWsvStateStorage::makeWriteBackQuery(changes);
+
+  EXPECT_THAT(query, HasSubstr("'o''neil@domain'"));
+  EXPECT_LT(query.find("INSERT INTO account"), query.find("UPDATE account"));
+  EXPECT_TRUE(
+      PostgresWsvStateStorage::makeWriteBackQuery(InMemoryWsvState::Changes{})
+          .empty());
+}
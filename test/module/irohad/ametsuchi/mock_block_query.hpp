@@ -26,6 +26,9 @@ namespace iroha {
       MOCK_METHOD1(checkTxPresence,
                    boost::optional<TxCacheStatusType>(
                        const shared_model::crypto::Hash &));
+      MOCK_METHOD1(checkTxPresence,
+                   boost::optional<std::vector<TxCacheStatusType>>(
+                       const std::vector<shared_model::crypto::Hash> &));
       MOCK_METHOD0(getTopBlockHeight, uint32_t(void));
     };
 
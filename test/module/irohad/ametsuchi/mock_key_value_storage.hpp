@@ -16,7 +16,10 @@ namespace iroha {
     class MockKeyValueStorage : public KeyValueStorage {
      public:
       MOCK_METHOD2(add, bool(Identifier, const Bytes &));
+      MOCK_METHOD3(add, bool(Identifier, const Bytes &, const Parts &));
       MOCK_CONST_METHOD1(get, boost::optional<Bytes>(Identifier));
+      MOCK_CONST_METHOD1(parts, boost::optional<Parts>(Identifier));
+      MOCK_CONST_METHOD2(get, boost::optional<Bytes>(Identifier, const Part &));
       MOCK_CONST_METHOD0(directory, std::string(void));
       MOCK_CONST_METHOD0(last_id, Identifier(void));
       MOCK_METHOD0(dropAll, void(void));
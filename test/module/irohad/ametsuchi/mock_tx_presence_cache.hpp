@@ -15,6 +15,8 @@ namespace iroha {
 
     class MockTxPresenceCache : public TxPresenceCache {
      public:
+      using TxPresenceCache::check;
+
       MOCK_CONST_METHOD1(check,
                          boost::optional<TxCacheStatusType>(
                              const shared_model::crypto::Hash &hash));
@@ -1982,5 +1982,59 @@ namespace iroha {
       CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 7, query_args);
     }
 
+    /**
+     * @given account with an asset
+     * @when two transfers are executed deferred, and the second one overdraws
+     * the account
+     * @then both commands report success until the deferred queries are
+     * executed, which applies the first transfer and returns the same error
+     * as immediate execution of the second one
+     */
+    TEST_F(TransferAccountAssetTest, DeferredOverdraft) {
+      addAllPerms();
+      addAllPerms(account2_id, "all2");
+      addAsset();
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructAddAssetQuantity(
+                      asset_id, asset_amount_one_zero),
+                  true));
+      auto &postgres_executor =
+          static_cast<PostgresCommandExecutor &>(*executor);
+
+      postgres_executor.deferExecution();
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructTransferAsset(
+                      account_id,
+                      account2_id,
+                      asset_id,
+                      "desc",
+                      shared_model::interface::Amount{"0.5"}),
+                  true));
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructTransferAsset(
+                      account_id,
+                      account2_id,
+                      asset_id,
+                      "desc",
+                      shared_model::interface::Amount{"2.0"}),
+                  true));
+      ASSERT_EQ("1.0",
+                sql_query->getAccountAsset(account_id, asset_id)
+                    .get()
+                    ->balance()
+                    .toStringRepr());
+
+      auto cmd_result = postgres_executor.executeDeferred();
+
+      std::vector<std::string> query_args{
+          account_id, account2_id, asset_id, "2.0", "1"};
+      CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 6, query_args);
+      ASSERT_EQ("0.5",
+                sql_query->getAccountAsset(account_id, asset_id)
+                    .get()
+                    ->balance()
+                    .toStringRepr());
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
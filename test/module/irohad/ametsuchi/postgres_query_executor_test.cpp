@@ -1749,5 +1749,66 @@ namespace iroha {
       executeQuery(query);
     }
 
+    /**
+     * @given initialized storage
+     * @when get pending transactions with pagination meta
+     * @then the page from pending txs storage is returned along with the
+     * next page hash and the number of all pending transactions
+     */
+    TEST_F(QueryExecutorTest, PendingTransactionsPage) {
+      auto tx = std::make_shared<shared_model::proto::Transaction>(
+          TestTransactionBuilder()
+              .creatorAccountId(account_id)
+              .createRole("user", {})
+              .build());
+      auto next_tx = TestTransactionBuilder()
+                         .creatorAccountId(account_id)
+                         .createRole("admin", {})
+                         .build();
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getPendingTransactions(1)
+                       .build();
+
+      EXPECT_CALL(*pending_txs_storage,
+                  getPendingTransactions(
+                      account_id, 1, boost::optional<types::HashType>{}))
+          .WillOnce(::testing::Return(iroha::expected::makeValue(
+              PendingTransactionStorage::Response{{tx}, 2, next_tx.hash()})));
+
+      auto result = executeQuery(query);
+      checkSuccessfulResult<shared_model::interface::TransactionsPageResponse>(
+          std::move(result), [&](const auto &cast_resp) {
+            ASSERT_EQ(cast_resp.transactions().size(), 1);
+            EXPECT_EQ(cast_resp.transactions().front().hash(), tx->hash());
+            EXPECT_EQ(cast_resp.allTransactionsSize(), 2);
+            EXPECT_EQ(cast_resp.nextTxHash(), next_tx.hash());
+          });
+    }
+
+    /**
+     * @given initialized storage
+     * @when get pending transactions starting from a transaction, which is
+     * not pending
+     * @then invalid pagination error is returned
+     */
+    TEST_F(QueryExecutorTest, PendingTransactionsInvalidPaginationHash) {
+      const types::HashType unknown_hash(zero_string);
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getPendingTransactions(1, unknown_hash)
+                       .build();
+
+      EXPECT_CALL(*pending_txs_storage,
+                  getPendingTransactions(
+                      account_id, 1, boost::make_optional(unknown_hash)))
+          .WillOnce(::testing::Return(iroha::expected::makeError(
+              PendingTransactionStorage::ErrorCode::kNotFound)));
+
+      auto result = executeQuery(query);
+      checkStatefulError<shared_model::interface::StatefulFailedErrorResponse>(
+          std::move(result), kInvalidPagination);
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -103,3 +103,58 @@ TEST_F(StorageInitTest, CreateStorageWithInvalidPgOpt) {
           },
           [](const Error<std::string> &) { SUCCEED(); });
 }
+
+/**
+ * @given database created with hashes stored as hex varchar, as the schema
+ * before bytea hashes did
+ * @when Create storage on top of that database
+ * @then hash columns are converted to bytea and keep the decoded hashes
+ */
+TEST_F(StorageInitTest, MigrateTextHashesToBytea) {
+  {
+    soci::session sql(*soci::factory_postgresql(), pg_opt_without_dbname_);
+    std::string query = "CREATE DATABASE " + dbname_;
+    sql << query;
+  }
+  {
+    soci::session sql(*soci::factory_postgresql(), pgopt_);
+    sql << "CREATE TABLE position_by_hash (hash varchar, height text, "
+           "index text)";
+    sql << "CREATE INDEX position_by_hash_hash_index ON position_by_hash "
+           "USING hash (hash)";
+    sql << "CREATE TABLE tx_status_by_hash (hash varchar, status boolean)";
+    sql << "INSERT INTO position_by_hash VALUES ('00ff', '1', '0')";
+    sql << "INSERT INTO tx_status_by_hash VALUES ('00ff', true)";
+  }
+
+  std::shared_ptr<StorageImpl> storage;
+  StorageImpl::create(
+      block_store_path, pgopt_, factory, converter, perm_converter_)
+      .match(
+          [&storage](const Value<std::shared_ptr<StorageImpl>> &value) {
+            storage = value.value;
+          },
+          [](const Error<std::string> &error) { FAIL() << error.error; });
+  ASSERT_TRUE(storage);
+
+  {
+    soci::session sql(*soci::factory_postgresql(), pgopt_);
+    int bytea_columns;
+    sql << "SELECT COUNT(*) FROM information_schema.columns WHERE "
+           "table_name IN ('position_by_hash', 'tx_status_by_hash') AND "
+           "column_name = 'hash' AND data_type = 'bytea'",
+        soci::into(bytea_columns);
+    EXPECT_EQ(bytea_columns, 2);
+
+    int found;
+    sql << "SELECT COUNT(*) FROM position_by_hash "
+           "WHERE hash = decode('00ff', 'hex')",
+        soci::into(found);
+    EXPECT_EQ(found, 1);
+    sql << "SELECT COUNT(*) FROM tx_status_by_hash "
+           "WHERE hash = decode('00ff', 'hex')",
+        soci::into(found);
+    EXPECT_EQ(found, 1);
+  }
+  storage->dropStorage();
+}
@@ -17,6 +17,8 @@ namespace iroha {
      */
     template <typename T>
     struct TxPresenceCacheStub final : public TxPresenceCache {
+      using TxPresenceCache::check;
+
       boost::optional<TxCacheStatusType> check(
           const shared_model::crypto::Hash &hash) const override {
         return boost::make_optional<TxCacheStatusType>(T{hash});
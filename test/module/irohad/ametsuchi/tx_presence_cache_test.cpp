@@ -166,3 +166,82 @@ TEST_F(TxPresenceCacheTest, BatchHashTest) {
         FAIL() << error.error;
       });
 }
+
+/**
+ * @given two batches with Committed and Missing transactions
+ * @when cache asked for statuses of both batches at once
+ * @then one storage query is used for all the transactions
+ * AND statuses are returned for each batch in the same order
+ */
+TEST_F(TxPresenceCacheTest, BatchesCheckedWithOneStorageQuery) {
+  shared_model::crypto::Hash hash1("1");
+  shared_model::crypto::Hash hash2("2");
+  shared_model::crypto::Hash hash3("3");
+  EXPECT_CALL(*mock_storage, getBlockQuery())
+      .WillOnce(Return(mock_block_query));
+  EXPECT_CALL(*mock_block_query,
+              checkTxPresence(
+                  std::vector<shared_model::crypto::Hash>{hash1, hash2, hash3}))
+      .WillOnce(Return(boost::make_optional(std::vector<TxCacheStatusType>{
+          tx_cache_status_responses::Committed(hash1),
+          tx_cache_status_responses::Missing(hash2),
+          tx_cache_status_responses::Missing(hash3)})));
+
+  TxPresenceCache::BatchesType batches{
+      createMockBatchWithTransactions({createMockTransactionWithHash(hash1),
+                                       createMockTransactionWithHash(hash2)},
+                                      "a"),
+      createMockBatchWithTransactions({createMockTransactionWithHash(hash3)},
+                                      "b")};
+  TxPresenceCacheImpl cache(mock_storage);
+
+  auto statuses = cache.check(batches);
+  ASSERT_EQ(2, statuses.size());
+  ASSERT_TRUE(statuses.at(0));
+  ASSERT_TRUE(statuses.at(1));
+  ASSERT_EQ(2, statuses.at(0)->size());
+  ASSERT_EQ(1, statuses.at(1)->size());
+  ASSERT_NO_THROW(
+      boost::get<tx_cache_status_responses::Committed>(statuses.at(0)->at(0)));
+  ASSERT_NO_THROW(
+      boost::get<tx_cache_status_responses::Missing>(statuses.at(0)->at(1)));
+  ASSERT_NO_THROW(
+      boost::get<tx_cache_status_responses::Missing>(statuses.at(1)->at(0)));
+
+  // committed transaction is answered from the memory
+  ASSERT_NO_THROW(boost::get<tx_cache_status_responses::Committed>(
+      *cache.check(hash1)));
+}
+
+/**
+ * @given two batches, where the transaction of the first one is in the
+ * memory cache and the storage query fails for the second one
+ * @when cache asked for statuses of both batches at once
+ * @then statuses of the first batch are returned
+ * AND there is no answer for the second batch
+ */
+TEST_F(TxPresenceCacheTest, FailedQueryFailsOnlyQueriedBatches) {
+  shared_model::crypto::Hash hash1("1");
+  shared_model::crypto::Hash hash2("2");
+  EXPECT_CALL(*mock_block_query, checkTxPresence(hash1))
+      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
+          tx_cache_status_responses::Committed(hash1))));
+  EXPECT_CALL(*mock_block_query,
+              checkTxPresence(std::vector<shared_model::crypto::Hash>{hash2}))
+      .WillOnce(Return(boost::none));
+
+  TxPresenceCache::BatchesType batches{
+      createMockBatchWithTransactions({createMockTransactionWithHash(hash1)},
+                                      "a"),
+      createMockBatchWithTransactions({createMockTransactionWithHash(hash2)},
+                                      "b")};
+  TxPresenceCacheImpl cache(mock_storage);
+  cache.check(hash1);
+
+  auto statuses = cache.check(batches);
+  ASSERT_EQ(2, statuses.size());
+  ASSERT_TRUE(statuses.at(0));
+  ASSERT_FALSE(statuses.at(1));
+  ASSERT_NO_THROW(
+      boost::get<tx_cache_status_responses::Committed>(statuses.at(0)->at(0)));
+}
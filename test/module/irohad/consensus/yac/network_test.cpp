@@ -7,6 +7,7 @@
 
 #include <grpc++/grpc++.h>
 
+#include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "module/irohad/consensus/yac/mock_yac_crypto_provider.hpp"
 #include "module/irohad/consensus/yac/mock_yac_network.hpp"
 #include "module/irohad/consensus/yac/yac_test_util.hpp"
@@ -94,6 +95,44 @@ namespace iroha {
         ASSERT_EQ(1, state.size());
         ASSERT_EQ(message, state.front());
       }
+
+      /**
+       * @given initialized network
+       * @when send votes of a commit to itself, which are sent as a
+       * certificate
+       * @then the same votes are handled
+       */
+      TEST_F(YacNetworkTest, CommitHandledWhenCommitSent) {
+        bool processed = false;
+
+        std::vector<VoteMessage> commit;
+        for (auto key : {"one", "two", "three"}) {
+          VoteMessage vote;
+          vote.hash = message.hash;
+          vote.hash.block_signature = nullptr;
+          vote.signature = createSig(key);
+          commit.push_back(vote);
+        }
+        ASSERT_TRUE(PbConverters::serializeCertificate(commit));
+
+        std::vector<VoteMessage> state;
+        EXPECT_CALL(*notifications, onState(_))
+            .Times(1)
+            .WillRepeatedly(DoAll(SaveArg<0>(&state), InvokeWithoutArgs([&] {
+                                    std::lock_guard<std::mutex> lock(mtx);
+                                    processed = true;
+                                    cv.notify_all();
+                                  })));
+
+        network->sendState(*peer, commit);
+
+        // wait for response reader thread
+        std::unique_lock<std::mutex> lk(mtx);
+        ASSERT_TRUE(cv.wait_for(
+            lk, std::chrono::seconds(5), [&] { return processed; }));
+
+        ASSERT_EQ(commit, state);
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
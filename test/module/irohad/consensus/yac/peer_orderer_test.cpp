@@ -14,10 +14,13 @@
 #include <boost/range/counting_range.hpp>
 #include <boost/range/numeric.hpp>
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
+#include "datetime/time.hpp"
 
 #include "module/irohad/ametsuchi/mock_peer_query.hpp"
 #include "module/irohad/ametsuchi/mock_peer_query_factory.hpp"
 #include "module/irohad/consensus/yac/yac_test_util.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 #include "module/shared_model/interface_mocks.hpp"
 
 using namespace boost::adaptors;
@@ -34,15 +37,33 @@ size_t N_PEERS = 4;
 
 class YacPeerOrdererTest : public ::testing::Test {
  public:
-  YacPeerOrdererTest() : orderer(make_shared<MockPeerQueryFactory>()) {}
-
   void SetUp() override {
     wsv = make_shared<MockPeerQuery>();
     pbfactory = make_shared<MockPeerQueryFactory>();
     EXPECT_CALL(*pbfactory, createPeerQuery())
         .WillRepeatedly(testing::Return(boost::make_optional(
             std::shared_ptr<iroha::ametsuchi::PeerQuery>(wsv))));
-    orderer = PeerOrdererImpl(pbfactory);
+    orderer = std::make_unique<PeerOrdererImpl>(pbfactory,
+                                                commits.get_observable());
+  }
+
+  /**
+   * Commit a block with a transaction of the given command
+   */
+  template <typename Builder>
+  void commit(Builder &&builder) {
+    auto tx = builder.creatorAccountId("admin@test")
+                  .createdTime(iroha::time::now())
+                  .quorum(1)
+                  .build();
+    commits.get_subscriber().on_next(
+        std::make_shared<shared_model::proto::Block>(
+            TestBlockBuilder()
+                .height(2)
+                .createdTime(iroha::time::now())
+                .transactions(
+                    std::vector<shared_model::proto::Transaction>{tx})
+                .build()));
   }
 
   std::vector<std::shared_ptr<shared_model::interface::Peer>> peers = [] {
@@ -80,14 +101,16 @@ class YacPeerOrdererTest : public ::testing::Test {
 
   shared_ptr<MockPeerQuery> wsv;
   shared_ptr<MockPeerQueryFactory> pbfactory;
-  PeerOrdererImpl orderer;
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
+      commits;
+  std::unique_ptr<PeerOrdererImpl> orderer;
 };
 
 TEST_F(YacPeerOrdererTest, PeerOrdererInitialOrderWhenInvokeNormalCase) {
   cout << "----------| InitialOrder() => valid object |----------" << endl;
 
   EXPECT_CALL(*wsv, getLedgerPeers()).WillOnce(Return(s_peers));
-  auto order = orderer.getInitialOrdering();
+  auto order = orderer->getInitialOrdering();
 
   ASSERT_EQ(order.value().getPeers(), s_peers);
 }
@@ -96,7 +119,7 @@ TEST_F(YacPeerOrdererTest, PeerOrdererInitialOrderWhenInvokeFailCase) {
   cout << "----------| InitialOrder() => nullopt case |----------" << endl;
 
   EXPECT_CALL(*wsv, getLedgerPeers()).WillOnce(Return(boost::none));
-  auto order = orderer.getInitialOrdering();
+  auto order = orderer->getInitialOrdering();
   ASSERT_EQ(order, boost::none);
 }
 
@@ -104,7 +127,7 @@ TEST_F(YacPeerOrdererTest, PeerOrdererOrderingWhenInvokeNormalCase) {
   cout << "----------| Order() => valid object |----------" << endl;
 
   EXPECT_CALL(*wsv, getLedgerPeers()).WillOnce(Return(s_peers));
-  auto order = orderer.getOrdering(YacHash());
+  auto order = orderer->getOrdering(YacHash());
   ASSERT_EQ(order.value().getPeers().size(), peers.size());
 }
 
@@ -112,7 +135,7 @@ TEST_F(YacPeerOrdererTest, PeerOrdererOrderingWhenInvokeFaillCase) {
   cout << "----------| Order() => nullopt case |----------" << endl;
 
   EXPECT_CALL(*wsv, getLedgerPeers()).WillOnce(Return(boost::none));
-  auto order = orderer.getOrdering(YacHash());
+  auto order = orderer->getOrdering(YacHash());
   ASSERT_EQ(order, boost::none);
 }
 
@@ -128,15 +151,13 @@ TEST_F(YacPeerOrdererTest, FairnessTest) {
   double exp_val = 30;
   int times = comb * exp_val;
   std::unordered_map<std::string, int> histogram;
-  EXPECT_CALL(*wsv, getLedgerPeers())
-      .Times(times)
-      .WillRepeatedly(Return(s_peers));
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillOnce(Return(s_peers));
 
   auto peers_set =
       transform(boost::counting_range(1, times + 1), [this](const auto &i) {
         std::string hash = std::to_string(i);
         return orderer
-            .getOrdering(YacHash(iroha::consensus::Round{1, 1}, hash, hash))
+            ->getOrdering(YacHash(iroha::consensus::Round{1, 1}, hash, hash))
             .value()
             .getPeers();
       });
@@ -161,3 +182,47 @@ TEST_F(YacPeerOrdererTest, FairnessTest) {
                      << std::to_string(p);
   ASSERT_EQ(comb, histogram.size());
 }
+
+/**
+ * @given peers loaded by the orderer
+ * @when orderings are requested again and a block which does not change peers
+ * is committed
+ * @then peers are not loaded from the storage again
+ */
+TEST_F(YacPeerOrdererTest, PeersAreCached) {
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillOnce(Return(s_peers));
+
+  ASSERT_EQ(orderer->getInitialOrdering().value().getPeers(), s_peers);
+  commit(TestTransactionBuilder().setAccountQuorum("admin@test", 1));
+  for (auto i = 0; i < 10; ++i) {
+    std::string hash = std::to_string(i);
+    auto order =
+        orderer->getOrdering(YacHash(iroha::consensus::Round{1, 1}, hash, hash))
+            .value();
+    ASSERT_EQ(order.getPeers().size(), s_peers.size());
+    for (const auto &peer : s_peers) {
+      ASSERT_EQ(order.findPeer(peer->pubkey()), peer);
+    }
+  }
+}
+
+/**
+ * @given peers loaded by the orderer
+ * @when a block which adds a peer is committed
+ * @then peers are loaded from the storage again
+ */
+TEST_F(YacPeerOrdererTest, PeersAreReloadedAfterAddPeer) {
+  auto new_peers = s_peers;
+  new_peers.push_back(iroha::consensus::yac::makePeer("5"));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillOnce(Return(s_peers))
+      .WillOnce(Return(new_peers));
+
+  ASSERT_EQ(orderer->getInitialOrdering().value().getPeers(), s_peers);
+  commit(TestTransactionBuilder().addPeer(
+      "5", shared_model::crypto::PublicKey(std::string(32, '5'))));
+  auto order = orderer->getOrdering(YacHash()).value();
+  ASSERT_EQ(order.getPeers().size(), new_peers.size());
+  ASSERT_EQ(order.findPeer(new_peers.back()->pubkey()), new_peers.back());
+  ASSERT_EQ(orderer->getInitialOrdering().value().getPeers(), new_peers);
+}
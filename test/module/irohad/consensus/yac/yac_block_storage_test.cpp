@@ -85,3 +85,25 @@ TEST_F(YacBlockStorageTest, YacBlockStorageWhenIsContains) {
   ASSERT_TRUE(storage.isContains(valid_votes.at(0)));
   ASSERT_FALSE(storage.isContains(valid_votes.at(3)));
 }
+
+/**
+ * @given block storage with a vote
+ * @when the vote is inserted again, alone and along with new votes
+ * @then only the new votes are stored
+ */
+TEST_F(YacBlockStorageTest, YacBlockStorageWhenDuplicateVotes) {
+  storage.insert(valid_votes.at(0));
+
+  ASSERT_EQ(boost::none, storage.insert(valid_votes.at(0)));
+  ASSERT_EQ(1, storage.getNumberOfVotes());
+
+  auto insert_commit = storage.insert(
+      std::vector<VoteMessage>{valid_votes.at(0),
+                               valid_votes.at(1),
+                               valid_votes.at(1),
+                               valid_votes.at(2)});
+  ASSERT_EQ(3, boost::get<CommitMessage>(*insert_commit).votes.size());
+  ASSERT_EQ(std::vector<VoteMessage>(valid_votes.begin(),
+                                     valid_votes.begin() + 3),
+            storage.getVotes());
+}
@@ -88,6 +88,32 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify({vote}));
       }
 
+      /**
+       * @given votes for the same hash with different block signatures
+       * @when they are verified together and one of them is changed
+       * @then the votes are valid only until the change
+       */
+      TEST_F(YacCryptoProviderTest, ValidWhenVotesShareHash) {
+        EXPECT_CALL(*factory, createSignature(keypair.publicKey(), _))
+            .WillRepeatedly(Invoke([this](auto &pubkey, auto &sig) {
+              return expected::makeValue(this->makeSignature(pubkey, sig));
+            }));
+
+        std::vector<VoteMessage> votes;
+        for (auto block_signature : {"a", "b", "c"}) {
+          YacHash hash(Round{1, 1}, "1", "1");
+          hash.block_signature =
+              makeSignature(keypair.publicKey(),
+                            shared_model::crypto::Signed(block_signature));
+          votes.push_back(crypto_provider->getVote(hash));
+        }
+
+        ASSERT_TRUE(crypto_provider->verify(votes));
+
+        votes.at(1).hash.block_signature = makeSignature();
+        ASSERT_FALSE(crypto_provider->verify(votes));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -375,3 +375,51 @@ TEST(StateTest, RemovingTestWhenByTimeHasExpired) {
 
   ASSERT_EQ(2, diff_state.getBatches().size());
 }
+
+/**
+ * @given a state with an expired batch, which was inserted after a batch,
+ * which is not expired yet
+ * @when erase by time is called
+ * @then only the expired batch is erased
+ */
+TEST(StateTest, EraseByTimeErasesOnlyExpiredBatches) {
+  auto time = iroha::time::now();
+  auto live_batch = addSignatures(
+      makeTestBatch(txBuilder(1, time + 10)), 0, makeSignature("1", "1"));
+  auto expired_batch = addSignatures(
+      makeTestBatch(txBuilder(2, time)), 0, makeSignature("2", "2"));
+
+  auto state = MstState::empty(completer_);
+  state += live_batch;
+  state += expired_batch;
+
+  auto expired_state = state.eraseByTime(time + 1);
+  ASSERT_EQ(1, expired_state.getBatches().size());
+  ASSERT_TRUE(expired_state.contains(expired_batch));
+  ASSERT_EQ(1, state.getBatches().size());
+  ASSERT_TRUE(state.contains(live_batch));
+}
+
+/**
+ * @given a state, from which a batch was removed upon completion
+ * @when erase by time is called after expiration of the batch
+ * @then the completed batch is not in the expired state
+ */
+TEST(StateTest, CompletedBatchDoesNotExpire) {
+  auto quorum = 2u;
+  auto time = iroha::time::now();
+
+  auto state = MstState::empty(completer_);
+  state += addSignatures(makeTestBatch(txBuilder(1, time, quorum)),
+                         0,
+                         makeSignature("1_1", "1_1"));
+  auto result =
+      state += addSignatures(makeTestBatch(txBuilder(1, time, quorum)),
+                             0,
+                             makeSignature("1_2", "1_2"));
+  ASSERT_EQ(1, result.completed_state_->getBatches().size());
+
+  auto expired_state = state.eraseByTime(time + 1);
+  ASSERT_TRUE(expired_state.isEmpty());
+  ASSERT_TRUE(state.isEmpty());
+}
@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batch_backlog.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ordering;
+
+using testing::NiceMock;
+using testing::ReturnRefOfCopy;
+
+using BatchesType = std::vector<BatchBacklog::TransactionBatchType>;
+
+class BatchBacklogTest : public ::testing::Test {
+ public:
+  /**
+   * @param account - creator of the transactions
+   * @param size - number of transactions
+   * @return batch of the given transactions
+   */
+  BatchBacklog::TransactionBatchType makeBatch(const std::string &account,
+                                               size_t size = 1) {
+    shared_model::interface::types::SharedTxsCollectionType txs;
+    for (size_t i = 0; i < size; ++i) {
+      auto tx = std::make_shared<NiceMock<MockTransaction>>();
+      ON_CALL(*tx, creatorAccountId()).WillByDefault(ReturnRefOfCopy(account));
+      txs.push_back(tx);
+    }
+    return createMockBatchWithTransactions(
+        txs, account + std::to_string(counter_++));
+  }
+
+  BatchBacklog::Clock::time_point now = BatchBacklog::Clock::now();
+
+ private:
+  size_t counter_ = 0;
+};
+
+/**
+ * @given backlog of 4 transactions with 3 batches of account a and 1 batch
+ * of account b
+ * @when a batch of account c is added
+ * @then the newest batch of account a is dropped
+ * AND the other batches keep their order
+ */
+TEST_F(BatchBacklogTest, FullBacklogDropsFromLargestAccount) {
+  BatchBacklog backlog({4, std::chrono::minutes(1)});
+  BatchesType batches{
+      makeBatch("a"), makeBatch("b"), makeBatch("a"), makeBatch("a")};
+  for (const auto &batch : batches) {
+    ASSERT_TRUE(backlog.add(batch, now));
+  }
+
+  auto batch = makeBatch("c");
+  ASSERT_TRUE(backlog.add(batch, now));
+
+  ASSERT_EQ(backlog.batches(),
+            (BatchesType{batches[0], batches[1], batches[2], batch}));
+  ASSERT_EQ(backlog.transactions(), 4);
+  ASSERT_EQ(backlog.dropped(), 1);
+  ASSERT_EQ(backlog.carriedOver(), 5);
+}
+
+/**
+ * @given full backlog, where account a has the most transactions
+ * @when another batch of account a is added
+ * @then the added batch is dropped
+ */
+TEST_F(BatchBacklogTest, FullBacklogDropsBatchOfLargestAccount) {
+  BatchBacklog backlog({3, std::chrono::minutes(1)});
+  BatchesType batches{makeBatch("a", 2), makeBatch("b")};
+  for (const auto &batch : batches) {
+    ASSERT_TRUE(backlog.add(batch, now));
+  }
+
+  ASSERT_FALSE(backlog.add(makeBatch("a"), now));
+
+  ASSERT_EQ(backlog.batches(), batches);
+  ASSERT_EQ(backlog.dropped(), 1);
+  ASSERT_EQ(backlog.carriedOver(), 3);
+}
+
+/**
+ * @given backlog with batches added at different times
+ * @when the expired batches are evicted
+ * AND batches are removed by their hashes
+ * @then only the batches, which are not expired and not removed, are left
+ * AND they are not counted for their account when the backlog is full
+ */
+TEST_F(BatchBacklogTest, ExpiredAndRemovedBatchesLeave) {
+  BatchBacklog backlog({4, std::chrono::seconds(10)});
+  auto old_batch = makeBatch("a");
+  BatchesType removed{makeBatch("a"), makeBatch("a")};
+  auto batch = makeBatch("b");
+  backlog.add(old_batch, now - std::chrono::seconds(10));
+  backlog.add(removed[0], now);
+  backlog.add(removed[1], now);
+  backlog.add(batch, now);
+
+  backlog.evictExpired(now);
+  backlog.remove(
+      {shared_model::crypto::FixedHash(removed[0]->reducedHash()),
+       shared_model::crypto::FixedHash(removed[1]->reducedHash())});
+
+  ASSERT_EQ(backlog.batches(), BatchesType{batch});
+  ASSERT_EQ(backlog.evicted(), 1);
+  ASSERT_FALSE(backlog.contains(
+      shared_model::crypto::FixedHash(removed[0]->reducedHash())));
+
+  // account b is the largest one, so its newest batch is dropped
+  BatchesType batches{
+      batch, makeBatch("b"), makeBatch("a"), makeBatch("c"), makeBatch("d")};
+  for (size_t i = 1; i < batches.size(); ++i) {
+    ASSERT_TRUE(backlog.add(batches[i], now));
+  }
+  ASSERT_EQ(backlog.batches(),
+            (BatchesType{batches[0], batches[2], batches[3], batches[4]}));
+  ASSERT_EQ(backlog.dropped(), 1);
+}
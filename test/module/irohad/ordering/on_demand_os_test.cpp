@@ -5,6 +5,7 @@
 
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
+#include <future>
 #include <memory>
 #include <thread>
 
@@ -17,6 +18,7 @@
 #include "module/shared_model/interface_mocks.hpp"
 #include "module/shared_model/validators/validators.hpp"
 #include "ordering/impl/on_demand_common.hpp"
+#include "ordering/impl/proposal_packing_policies.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
@@ -47,6 +49,23 @@ class OnDemandOsTest : public ::testing::Test {
   NiceMock<iroha::ametsuchi::MockTxPresenceCache> *mock_cache;
 
   void SetUp() override {
+    makeService({});
+  }
+
+  /**
+   * Replace the service with a new one
+   * @param backlog_limits - limits of the backlog of the service
+   * @param packing_policy - policy of the service, packs batches in arrival
+   * order if not set
+   * @return the new service
+   */
+  std::shared_ptr<OnDemandOrderingServiceImpl> makeService(
+      BacklogLimits backlog_limits,
+      std::shared_ptr<ProposalPackingPolicy> packing_policy = nullptr) {
+    if (not packing_policy) {
+      packing_policy = std::make_shared<FifoPackingPolicy>(
+          ProposalLimits{transaction_limit});
+    }
     // TODO: nickaleks IR-1811 use mock factory
     auto factory = std::make_unique<
         shared_model::proto::ProtoProposalFactory<MockProposalValidator>>();
@@ -61,25 +80,32 @@ class OnDemandOsTest : public ::testing::Test {
                 _)))
         .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
             iroha::ametsuchi::tx_cache_status_responses::Missing()}));
-    os = std::make_shared<OnDemandOrderingServiceImpl>(transaction_limit,
-                                                       std::move(factory),
-                                                       std::move(tx_cache),
-                                                       proposal_limit,
-                                                       initial_round);
+    auto service =
+        std::make_shared<OnDemandOrderingServiceImpl>(std::move(packing_policy),
+                                                      std::move(factory),
+                                                      std::move(tx_cache),
+                                                      proposal_limit,
+                                                      initial_round,
+                                                      backlog_limits);
+    os = service;
+    return service;
   }
 
   /**
    * Generate transactions with provided range
    * @param os - ordering service for insertion
    * @param range - pair of [from, to)
+   * @param creator - creator account of the transactions
    */
   void generateTransactionsAndInsert(consensus::Round round,
-                                     std::pair<uint64_t, uint64_t> range) {
-    os->onBatches(round, generateTransactions(range));
+                                     std::pair<uint64_t, uint64_t> range,
+                                     const std::string &creator = "foo@bar") {
+    os->onBatches(round, generateTransactions(range, creator));
   }
 
   OnDemandOrderingService::CollectionType generateTransactions(
-      std::pair<uint64_t, uint64_t> range) {
+      std::pair<uint64_t, uint64_t> range,
+      const std::string &creator = "foo@bar") {
     auto now = iroha::time::now();
     OnDemandOrderingService::CollectionType collection;
 
@@ -90,7 +116,7 @@ class OnDemandOsTest : public ::testing::Test {
                   std::make_unique<shared_model::proto::Transaction>(
                       shared_model::proto::TransactionBuilder()
                           .createdTime(now + i)
-                          .creatorAccountId("foo@bar")
+                          .creatorAccountId(creator)
                           .createAsset("asset", "domain", 1)
                           .quorum(1)
                           .build()
@@ -144,9 +170,11 @@ TEST_F(OnDemandOsTest, NormalRound) {
  * @when  send number of transactions greater that limit
  * AND initiate next round
  * @then  check that previous round has only limit of transactions
- * AND the rest of transactions isn't appeared in next after next round
+ * AND the rest of transactions appears in the proposal of the next round
+ * AND they leave the backlog after that proposal is requested
  */
 TEST_F(OnDemandOsTest, OverflowRound) {
+  auto service = makeService({});
   generateTransactionsAndInsert(target_round, {1, transaction_limit * 2});
 
   os->onCollaborationOutcome(commit_round);
@@ -154,6 +182,147 @@ TEST_F(OnDemandOsTest, OverflowRound) {
   ASSERT_TRUE(os->onRequestProposal(target_round));
   ASSERT_EQ(transaction_limit,
             (*os->onRequestProposal(target_round))->transactions().size());
+  ASSERT_EQ(service->metrics().backlog_transactions, transaction_limit - 1);
+
+  os->onCollaborationOutcome(target_round);
+
+  const consensus::Round next_round = {target_round.block_round + 1,
+                                       kNextCommitRoundConsumer};
+  ASSERT_TRUE(os->onRequestProposal(next_round));
+  ASSERT_EQ(transaction_limit - 1,
+            (*os->onRequestProposal(next_round))->transactions().size());
+  ASSERT_EQ(service->metrics().backlog_transactions, transaction_limit - 1);
+
+  os->onCollaborationOutcome(next_round);
+
+  auto metrics = service->metrics();
+  ASSERT_EQ(metrics.carried_over, transaction_limit - 1);
+  ASSERT_EQ(metrics.backlog_batches, 0);
+  ASSERT_EQ(metrics.backlog_transactions, 0);
+}
+
+/**
+ * @given initialized on-demand OS
+ * @when  send more transactions than fit a proposal
+ * AND the next proposals, which carry the rest of them, are not requested
+ * @then  the rest of transactions stays in the backlog
+ * AND appears in the proposal after them
+ */
+TEST_F(OnDemandOsTest, OverflowKeptUntilRequested) {
+  auto service = makeService({});
+  generateTransactionsAndInsert(target_round, {1, transaction_limit * 2});
+
+  os->onCollaborationOutcome(commit_round);
+  ASSERT_TRUE(os->onRequestProposal(target_round));
+
+  // proposals of round (5, 0) and (4, 1) carry the rest, but another peer is
+  // asked for them
+  os->onCollaborationOutcome(target_round);
+  const consensus::Round carried_round = {target_round.block_round + 1,
+                                          kNextCommitRoundConsumer};
+  os->onCollaborationOutcome(carried_round);
+  ASSERT_EQ(service->metrics().backlog_transactions, transaction_limit - 1);
+
+  const consensus::Round next_round = {carried_round.block_round + 1,
+                                       kNextCommitRoundConsumer};
+  auto proposal = os->onRequestProposal(next_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(transaction_limit - 1, (*proposal)->transactions().size());
+
+  os->onCollaborationOutcome(next_round);
+  ASSERT_EQ(service->metrics().backlog_transactions, 0);
+}
+
+/**
+ * @given initialized on-demand OS with transactions in the backlog
+ * @when  the transactions are committed by the proposal of another peer
+ * AND initiate next round
+ * @then  they leave the backlog and the next proposal is empty
+ */
+TEST_F(OnDemandOsTest, CommittedOverflowRemoved) {
+  auto service = makeService({});
+  generateTransactionsAndInsert(target_round, {1, transaction_limit * 2});
+  os->onCollaborationOutcome(commit_round);
+  ASSERT_EQ(service->metrics().backlog_transactions, transaction_limit - 1);
+
+  ON_CALL(
+      *mock_cache,
+      check(testing::Matcher<const shared_model::interface::TransactionBatch &>(
+          _)))
+      .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Committed()}));
+  os->onCollaborationOutcome(target_round);
+
+  ASSERT_FALSE(os->onRequestProposal(
+      {target_round.block_round + 1, kNextCommitRoundConsumer}));
+  ASSERT_EQ(service->metrics().backlog_transactions, 0);
+}
+
+/**
+ * @given initialized on-demand OS with a backlog of 5 transactions
+ * @when  send more transactions than fit a proposal and the backlog
+ * AND initiate next round
+ * @then  the transactions which do not fit the backlog are dropped
+ */
+TEST_F(OnDemandOsTest, OverflowDroppedWhenBacklogIsFull) {
+  auto service = makeService({5, std::chrono::minutes(1)});
+  generateTransactionsAndInsert(target_round, {0, transaction_limit + 10});
+
+  os->onCollaborationOutcome(commit_round);
+
+  auto metrics = service->metrics();
+  ASSERT_EQ(metrics.backlog_batches, 5);
+  ASSERT_EQ(metrics.backlog_transactions, 5);
+  ASSERT_EQ(metrics.carried_over, 5);
+  ASSERT_EQ(metrics.dropped, 5);
+}
+
+/**
+ * @given initialized on-demand OS, whose backlog keeps no batch for long
+ * @when  send more transactions than fit a proposal
+ * AND initiate next rounds
+ * @then  the transactions which did not fit are evicted from the backlog
+ * AND they do not appear in the next proposal
+ */
+TEST_F(OnDemandOsTest, ExpiredOverflowEvicted) {
+  auto service = makeService({100, std::chrono::milliseconds(0)});
+  generateTransactionsAndInsert(target_round, {0, transaction_limit + 10});
+
+  os->onCollaborationOutcome(commit_round);
+  os->onCollaborationOutcome(target_round);
+
+  ASSERT_FALSE(os->onRequestProposal(
+      {target_round.block_round + 1, kNextCommitRoundConsumer}));
+  auto metrics = service->metrics();
+  ASSERT_EQ(metrics.evicted, 10);
+  ASSERT_EQ(metrics.backlog_transactions, 0);
+}
+
+/**
+ * @given initialized on-demand OS, which packs proposals fairly
+ * @when  one account sends more transactions than fit a proposal
+ * AND then another account sends a transaction
+ * AND initiate next round
+ * @then  the proposal contains the transaction of the other account
+ */
+TEST_F(OnDemandOsTest, FairPolicyServesEveryAccount) {
+  makeService(
+      {},
+      std::make_shared<FairPackingPolicy>(ProposalLimits{transaction_limit}));
+  const auto heavy_txs = transaction_limit * 2;
+  generateTransactionsAndInsert(target_round, {0, heavy_txs});
+  generateTransactionsAndInsert(
+      target_round, {heavy_txs, heavy_txs + 1}, "baz@bar");
+
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(transaction_limit, (*proposal)->transactions().size());
+  auto txs = (*proposal)->transactions();
+  ASSERT_TRUE(std::any_of(txs.begin(), txs.end(), [](const auto &tx) {
+    return tx.creatorAccountId() == "baz@bar";
+  }));
 }
 
 /**
@@ -365,3 +534,86 @@ TEST_F(OnDemandOsTest, SeveralTransactionsOneCommited) {
   // already processed transaction is no present in the proposal
   EXPECT_TRUE(std::find(txs.begin(), txs.end(), batch2_tx) == txs.end());
 }
+
+/**
+ * @given initialized on-demand OS
+ * @when add 2 batches, with the first one being already commited
+ * AND initiate next round
+ * @then the commited batch is counted as replayed
+ * AND lock hold times are reported
+ */
+TEST_F(OnDemandOsTest, ReplayedBatchesCounted) {
+  auto service = makeService({});
+  auto batches = generateTransactions({1, 3});
+
+  EXPECT_CALL(*mock_cache, check(batchRef(*batches.at(0))))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Committed()}));
+  EXPECT_CALL(*mock_cache, check(batchRef(*batches.at(1))))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Missing()}));
+
+  os->onBatches(target_round, batches);
+  os->onCollaborationOutcome(commit_round);
+
+  ASSERT_EQ(1, (*os->onRequestProposal(target_round))->transactions().size());
+  auto metrics = service->metrics();
+  ASSERT_EQ(metrics.replayed, 1);
+  ASSERT_GE(metrics.max_packing_lock_hold_us,
+            metrics.last_packing_lock_hold_us);
+}
+
+/**
+ * @given initialized on-demand OS
+ * @when a round is switched while received batches are checked for already
+ * processed transactions
+ * @then the round is switched without waiting for the check
+ */
+TEST_F(OnDemandOsTest, PackingDoesNotWaitForReplayCheck) {
+  auto batches = generateTransactions({1, 2});
+  std::future<void> packing;
+  bool packed_during_check = false;
+
+  EXPECT_CALL(*mock_cache, check(batchRef(*batches.at(0))))
+      .WillOnce(Invoke([&](const auto &) {
+        packing = std::async(std::launch::async, [this] {
+          os->onCollaborationOutcome(commit_round);
+        });
+        packed_during_check = packing.wait_for(std::chrono::seconds(5))
+            == std::future_status::ready;
+        return boost::make_optional(
+            std::vector<iroha::ametsuchi::TxCacheStatusType>{
+                iroha::ametsuchi::tx_cache_status_responses::Missing()});
+      }));
+
+  os->onBatches(target_round, batches);
+  packing.get();
+
+  ASSERT_TRUE(packed_during_check);
+}
+
+/**
+ * @given initialized on-demand OS
+ * @when add 2 batches, with the check of the first one failing
+ * AND initiate next round
+ * @then only the first batch is dropped
+ * AND the second one is present in the proposal
+ */
+TEST_F(OnDemandOsTest, FailedCheckDropsOnlyItsBatch) {
+  auto batches = generateTransactions({1, 3});
+
+  EXPECT_CALL(*mock_cache, check(batchRef(*batches.at(0))))
+      .WillOnce(Return(boost::none));
+  EXPECT_CALL(*mock_cache, check(batchRef(*batches.at(1))))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Missing()}));
+
+  os->onBatches(target_round, batches);
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(1, (*proposal)->transactions().size());
+  ASSERT_EQ(batches.at(1)->transactions().front()->hash(),
+            (*proposal)->transactions().begin()->hash());
+}
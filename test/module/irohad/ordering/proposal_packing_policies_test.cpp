@@ -0,0 +1,150 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_packing_policies.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ordering;
+
+using testing::NiceMock;
+using testing::ReturnRefOfCopy;
+
+using BatchesType = ProposalPackingPolicy::BatchesType;
+
+class ProposalPackingPolicyTest : public ::testing::Test {
+ public:
+  /**
+   * @param account - creator of the transactions
+   * @param size - number of transactions
+   * @param tx_bytes - size of every transaction
+   * @return batch of the given transactions
+   */
+  std::shared_ptr<shared_model::interface::TransactionBatch> makeBatch(
+      const std::string &account, size_t size = 1, size_t tx_bytes = 1) {
+    shared_model::interface::types::SharedTxsCollectionType txs;
+    for (size_t i = 0; i < size; ++i) {
+      auto tx = std::make_shared<NiceMock<MockTransaction>>();
+      ON_CALL(*tx, creatorAccountId()).WillByDefault(ReturnRefOfCopy(account));
+      ON_CALL(*tx, blob())
+          .WillByDefault(ReturnRefOfCopy(shared_model::crypto::Blob(
+              std::string(tx_bytes, 'a'))));
+      txs.push_back(tx);
+    }
+    return createMockBatchWithTransactions(
+        txs, account + std::to_string(counter_++));
+  }
+
+ private:
+  size_t counter_ = 0;
+};
+
+/**
+ * @given batches of different accounts and sizes
+ * @when they are packed in arrival order
+ * @then batches are taken in arrival order while the proposal is not full
+ * AND the last batch is not broken
+ * AND the rest keep their order
+ */
+TEST_F(ProposalPackingPolicyTest, FifoTakesBatchesInArrivalOrder) {
+  BatchesType candidates{
+      makeBatch("a"), makeBatch("a", 2), makeBatch("b"), makeBatch("a")};
+  auto expected_proposal = BatchesType{candidates[0], candidates[1]};
+  auto expected_rest = BatchesType{candidates[2], candidates[3]};
+
+  BatchesType proposal;
+  FifoPackingPolicy({2}).pack(proposal, candidates);
+
+  ASSERT_EQ(proposal, expected_proposal);
+  ASSERT_EQ(candidates, expected_rest);
+}
+
+/**
+ * @given batches of 4 bytes long transactions
+ * @when they are packed with the limit of 10 bytes
+ * @then the proposal is packed until its size exceeds the limit
+ */
+TEST_F(ProposalPackingPolicyTest, FifoLimitsBytes) {
+  BatchesType candidates{makeBatch("a", 1, 4),
+                         makeBatch("a", 1, 4),
+                         makeBatch("a", 1, 4),
+                         makeBatch("a", 1, 4)};
+  auto expected_proposal =
+      BatchesType{candidates[0], candidates[1], candidates[2]};
+
+  BatchesType proposal;
+  FifoPackingPolicy({100, 10}).pack(proposal, candidates);
+
+  ASSERT_EQ(proposal, expected_proposal);
+  ASSERT_EQ(candidates.size(), 1);
+}
+
+/**
+ * @given many batches of one account followed by batches of other accounts
+ * @when they are packed fairly
+ * @then every account gets its batch into the proposal
+ * AND the rest of the batches of the first account keep their order
+ */
+TEST_F(ProposalPackingPolicyTest, FairInterleavesAccounts) {
+  BatchesType candidates;
+  for (int i = 0; i < 6; ++i) {
+    candidates.push_back(makeBatch("heavy"));
+  }
+  candidates.push_back(makeBatch("b"));
+  candidates.push_back(makeBatch("c"));
+  auto expected_proposal =
+      BatchesType{candidates[0], candidates[6], candidates[7], candidates[1]};
+  auto expected_rest = BatchesType(candidates.begin() + 2,
+                                   candidates.begin() + 6);
+
+  BatchesType proposal;
+  FairPackingPolicy({4}).pack(proposal, candidates);
+
+  ASSERT_EQ(proposal, expected_proposal);
+  ASSERT_EQ(candidates, expected_rest);
+}
+
+/**
+ * @given a batch of three transactions followed by single transaction
+ * batches of another account
+ * @when they are packed fairly
+ * @then the large batch waits until it has been deficient for as many
+ * transactions as the small batches, which are taken meanwhile
+ */
+TEST_F(ProposalPackingPolicyTest, FairCountsTransactions) {
+  BatchesType candidates{
+      makeBatch("a", 3), makeBatch("b"), makeBatch("b"), makeBatch("b")};
+  auto expected_proposal =
+      BatchesType{candidates[1], candidates[2], candidates[0]};
+  auto expected_rest = BatchesType{candidates[3]};
+
+  BatchesType proposal;
+  FairPackingPolicy({4}).pack(proposal, candidates);
+
+  ASSERT_EQ(proposal, expected_proposal);
+  ASSERT_EQ(candidates, expected_rest);
+}
+
+/**
+ * @given a proposal with a batch of one account, and more batches of the
+ * account and of another one
+ * @when they are packed with the account share of a half of the proposal
+ * @then the account takes no more than its share though the proposal is not
+ * full
+ */
+TEST_F(ProposalPackingPolicyTest, FairLimitsAccountShare) {
+  BatchesType proposal{makeBatch("a")};
+  BatchesType candidates{
+      makeBatch("a"), makeBatch("a"), makeBatch("a"), makeBatch("b")};
+  auto expected_proposal =
+      BatchesType{proposal[0], candidates[0], candidates[3]};
+  auto expected_rest = BatchesType{candidates[1], candidates[2]};
+
+  FairPackingPolicy({4}, 0.5).pack(proposal, candidates);
+
+  ASSERT_EQ(proposal, expected_proposal);
+  ASSERT_EQ(candidates, expected_rest);
+}
@@ -16,6 +16,13 @@ namespace iroha {
     MOCK_CONST_METHOD1(getPendingTransactions,
                  shared_model::interface::types::SharedTxsCollectionType(
                      const shared_model::interface::types::AccountIdType &accountId));
+    MOCK_CONST_METHOD3(
+        getPendingTransactions,
+        expected::Result<Response, ErrorCode>(
+            const shared_model::interface::types::AccountIdType &account_id,
+            shared_model::interface::types::TransactionsNumberType page_size,
+            const boost::optional<shared_model::interface::types::HashType>
+                &first_tx_hash));
   };
 
 }  // namespace iroha
@@ -282,3 +282,109 @@ TEST_F(PendingTxsStorageFixture, ExpiredBatch) {
   auto pending = storage.getPendingTransactions("alice@iroha");
   ASSERT_EQ(pending.size(), 0);
 }
+
+/**
+ * Pages consist of whole batches in order of their arrival
+ * @given three batches of alice with two, one and two transactions, which
+ * arrive one after another
+ * @when alice requests pages of two transactions
+ * @then the first page has the first batch, the second page has only the
+ * second batch, since the third one does not fit, and the last page has the
+ * third batch without the next page hash
+ */
+TEST_F(PendingTxsStorageFixture, PaginationKeepsBatchesWhole) {
+  std::vector<std::shared_ptr<iroha::MstState>> states;
+  std::vector<std::shared_ptr<Batch>> batches{
+      addSignatures(
+          makeTestBatch(txBuilder(2, getUniqueTime(), 2, "alice@iroha"),
+                        txBuilder(2, getUniqueTime(), 2, "alice@iroha")),
+          0,
+          makeSignature("1", "pub_key_1")),
+      addSignatures(
+          makeTestBatch(txBuilder(2, getUniqueTime(), 2, "alice@iroha")),
+          0,
+          makeSignature("1", "pub_key_1")),
+      addSignatures(
+          makeTestBatch(txBuilder(2, getUniqueTime(), 2, "alice@iroha"),
+                        txBuilder(2, getUniqueTime(), 2, "bob@iroha")),
+          0,
+          makeSignature("1", "pub_key_1"))};
+  for (const auto &batch : batches) {
+    states.push_back(
+        std::make_shared<iroha::MstState>(iroha::MstState::empty(completer_)));
+    *states.back() += batch;
+  }
+
+  auto updates = rxcpp::observable<>::create<std::shared_ptr<iroha::MstState>>(
+      [&states](auto s) {
+        for (const auto &state : states) {
+          s.on_next(state);
+        }
+        s.on_completed();
+      });
+  auto dummy = rxcpp::observable<>::create<std::shared_ptr<Batch>>(
+      [](auto s) { s.on_completed(); });
+
+  iroha::PendingTransactionStorageImpl storage(updates, dummy, dummy);
+  auto page = [&storage](const auto &first_hash) {
+    auto result =
+        storage.getPendingTransactions("alice@iroha", 2, first_hash);
+    auto value = boost::get<iroha::expected::Value<
+        iroha::PendingTransactionStorage::Response>>(&result);
+    EXPECT_TRUE(value);
+    return value ? value->value : iroha::PendingTransactionStorage::Response{};
+  };
+  auto first_hash = [&batches](size_t i) {
+    return boost::make_optional(batches[i]->transactions().front()->hash());
+  };
+
+  auto first_page = page(boost::none);
+  ASSERT_EQ(first_page.transactions.size(), 2);
+  ASSERT_EQ(first_page.all_transactions_size, 5);
+  ASSERT_EQ(first_page.next_tx_hash, first_hash(1));
+
+  auto second_page = page(first_page.next_tx_hash);
+  ASSERT_EQ(second_page.transactions.size(), 1);
+  ASSERT_EQ(*second_page.transactions.front(),
+            *batches[1]->transactions().front());
+  ASSERT_EQ(second_page.next_tx_hash, first_hash(2));
+
+  auto last_page = page(second_page.next_tx_hash);
+  ASSERT_EQ(last_page.transactions.size(), 2);
+  ASSERT_FALSE(last_page.next_tx_hash);
+}
+
+/**
+ * Unknown first transaction of a page is reported
+ * @given storage with a batch of alice
+ * @when alice requests a page starting from a transaction, which is not
+ * pending
+ * @then kNotFound error is returned
+ */
+TEST_F(PendingTxsStorageFixture, PaginationUnknownHash) {
+  auto state =
+      std::make_shared<iroha::MstState>(iroha::MstState::empty(completer_));
+  *state += addSignatures(
+      makeTestBatch(txBuilder(2, getUniqueTime(), 2, "alice@iroha")),
+      0,
+      makeSignature("1", "pub_key_1"));
+
+  auto updates = rxcpp::observable<>::create<decltype(state)>([&state](auto s) {
+    s.on_next(state);
+    s.on_completed();
+  });
+  auto dummy = rxcpp::observable<>::create<std::shared_ptr<Batch>>(
+      [](auto s) { s.on_completed(); });
+
+  iroha::PendingTransactionStorageImpl storage(updates, dummy, dummy);
+  auto unknown_hash = txBuilder(2, getUniqueTime(), 2, "alice@iroha")
+                          .build()
+                          .hash();
+  auto result = storage.getPendingTransactions(
+      "alice@iroha", 10, boost::make_optional(unknown_hash));
+  auto error = boost::get<iroha::expected::Error<
+      iroha::PendingTransactionStorage::ErrorCode>>(&result);
+  ASSERT_TRUE(error);
+  ASSERT_EQ(error->error,
+            iroha::PendingTransactionStorage::ErrorCode::kNotFound);
+}
@@ -0,0 +1,169 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/blocks_broadcast.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "backend/protobuf/block.hpp"
+#include "module/irohad/ametsuchi/mock_block_query.hpp"
+#include "module/irohad/ametsuchi/mock_block_query_factory.hpp"
+#include "qry_responses.pb.h"
+
+using namespace iroha::torii;
+using namespace std::chrono_literals;
+
+using ::testing::Return;
+
+class BlocksBroadcastTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    block_query = std::make_shared<iroha::ametsuchi::MockBlockQuery>();
+    block_query_factory =
+        std::make_shared<iroha::ametsuchi::MockBlockQueryFactory>();
+    EXPECT_CALL(*block_query_factory, createBlockQuery())
+        .WillRepeatedly(Return(
+            boost::make_optional<std::shared_ptr<iroha::ametsuchi::BlockQuery>>(
+                block_query)));
+    EXPECT_CALL(*block_query, getTopBlockHeight())
+        .WillRepeatedly(Return(kTopHeight));
+  }
+
+  void init(size_t queue_size, BlocksBroadcast::OverflowPolicy policy) {
+    broadcast = std::make_shared<BlocksBroadcast>(
+        commits.get_observable(), block_query_factory, queue_size, policy);
+  }
+
+  std::shared_ptr<shared_model::interface::Block> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    iroha::protocol::Block_v1 block;
+    block.mutable_payload()->set_height(height);
+    return std::make_shared<shared_model::proto::Block>(std::move(block));
+  }
+
+  void commit(shared_model::interface::types::HeightType height) {
+    commits.get_subscriber().on_next(makeBlock(height));
+  }
+
+  /// expect the block of the height to be read from the block store
+  void expectStored(shared_model::interface::types::HeightType height) {
+    EXPECT_CALL(*block_query, getBlocks(height, 1))
+        .WillOnce(Return(
+            std::vector<std::shared_ptr<shared_model::interface::Block>>{
+                makeBlock(height)}));
+  }
+
+  /// @return height of the next block of the subscriber, 0 if there is none
+  shared_model::interface::types::HeightType nextHeight(
+      BlocksBroadcast::Subscriber &subscriber) {
+    auto block = subscriber.next(0ms);
+    return block ? (*block)->height : 0;
+  }
+
+  const shared_model::interface::types::HeightType kTopHeight = 3;
+
+  std::shared_ptr<iroha::ametsuchi::MockBlockQuery> block_query;
+  std::shared_ptr<iroha::ametsuchi::MockBlockQueryFactory> block_query_factory;
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
+      commits;
+  std::shared_ptr<BlocksBroadcast> broadcast;
+};
+
+/**
+ * @given two subscribers
+ * @when a block is committed
+ * @then both of them receive the same serialized block, which is a valid
+ * block response
+ */
+TEST_F(BlocksBroadcastTest, BlockIsSerializedOnce) {
+  init(10, BlocksBroadcast::OverflowPolicy::kDropOldest);
+  auto first = broadcast->subscribe(0);
+  auto second = broadcast->subscribe(0);
+
+  commit(kTopHeight + 1);
+
+  auto first_block = first->next(0ms);
+  auto second_block = second->next(0ms);
+  ASSERT_TRUE(first_block);
+  ASSERT_TRUE(second_block);
+  ASSERT_EQ(*first_block, *second_block);
+  iroha::protocol::BlockResponse response;
+  ASSERT_TRUE(response.ParseFromString((*first_block)->block_response));
+  ASSERT_EQ(response.block().block_v1().payload().height(), kTopHeight + 1);
+}
+
+/**
+ * @given subscriber from a height below the top block
+ * @when a block is committed
+ * @then stored blocks are received first, then the committed one
+ */
+TEST_F(BlocksBroadcastTest, ResumeFromHeight) {
+  init(10, BlocksBroadcast::OverflowPolicy::kDropOldest);
+  expectStored(kTopHeight - 1);
+  expectStored(kTopHeight);
+  auto subscriber = broadcast->subscribe(kTopHeight - 1);
+
+  commit(kTopHeight + 1);
+
+  ASSERT_EQ(nextHeight(*subscriber), kTopHeight - 1);
+  ASSERT_EQ(nextHeight(*subscriber), kTopHeight);
+  ASSERT_EQ(nextHeight(*subscriber), kTopHeight + 1);
+  ASSERT_EQ(nextHeight(*subscriber), 0);
+}
+
+/**
+ * @given subscriber with a full queue and the drop policy
+ * @when a block is committed
+ * @then the oldest block is dropped from the queue and read from the block
+ * store later, so no block is missed
+ */
+TEST_F(BlocksBroadcastTest, DroppedBlockIsReadFromStore) {
+  init(1, BlocksBroadcast::OverflowPolicy::kDropOldest);
+  auto subscriber = broadcast->subscribe(0);
+
+  commit(kTopHeight + 1);
+  commit(kTopHeight + 2);
+
+  expectStored(kTopHeight + 1);
+  ASSERT_EQ(nextHeight(*subscriber), kTopHeight + 1);
+  ASSERT_EQ(nextHeight(*subscriber), kTopHeight + 2);
+  ASSERT_FALSE(subscriber->disconnected());
+}
+
+/**
+ * @given subscriber with a full queue and the disconnect policy
+ * @when a block is committed
+ * @then the subscriber is disconnected
+ */
+TEST_F(BlocksBroadcastTest, SlowSubscriberIsDisconnected) {
+  init(1, BlocksBroadcast::OverflowPolicy::kDisconnect);
+  auto subscriber = broadcast->subscribe(0);
+
+  commit(kTopHeight + 1);
+  commit(kTopHeight + 2);
+
+  ASSERT_EQ(nextHeight(*subscriber), 0);
+  ASSERT_TRUE(subscriber->disconnected());
+  ASSERT_TRUE(subscriber->closed());
+}
+
+/**
+ * @given subscriber with a queued block
+ * @when commits are over
+ * @then the queued block is received and then the subscriber is closed
+ */
+TEST_F(BlocksBroadcastTest, SubscriberIsClosedWhenCommitsAreOver) {
+  init(10, BlocksBroadcast::OverflowPolicy::kDropOldest);
+  auto subscriber = broadcast->subscribe(0);
+
+  commit(kTopHeight + 1);
+  commits.get_subscriber().on_completed();
+
+  ASSERT_FALSE(subscriber->closed());
+  ASSERT_EQ(nextHeight(*subscriber), kTopHeight + 1);
+  ASSERT_TRUE(subscriber->closed());
+  ASSERT_TRUE(broadcast->subscribe(0)->closed());
+}
@@ -123,3 +123,38 @@ TEST_F(CommandSyncClientTest, StatusStream) {
   ASSERT_EQ(responses.size(), 1);
   ASSERT_EQ(responses[0].tx_hash(), resp.tx_hash());
 }
+
+/**
+ * @given command client
+ * @when ListStatusStream is called
+ * @then the stub handles passed data correctly and statuses from all received
+ * lists are returned in order of arrival
+ */
+TEST_F(CommandSyncClientTest, ListStatusStream) {
+  iroha::protocol::TxStatusListRequest request, intermediary_request;
+  request.add_tx_hashes(kTxHash);
+  request.add_tx_hashes(std::string(kHashLength, '2'));
+  iroha::protocol::ToriiResponseList first, second;
+  first.add_responses()->set_tx_hash(request.tx_hashes(0));
+  first.add_responses()->set_tx_hash(request.tx_hashes(1));
+  second.add_responses()->set_tx_hash(request.tx_hashes(1));
+  std::vector<iroha::protocol::ToriiResponse> responses;
+  auto reader = std::make_unique<
+      grpc::testing::MockClientReader<::iroha::protocol::ToriiResponseList>>();
+
+  EXPECT_CALL(*reader, Read(_))
+      .WillOnce(DoAll(::testing::SetArgPointee<0>(first), Return(true)))
+      .WillOnce(DoAll(::testing::SetArgPointee<0>(second), Return(true)))
+      .WillOnce(Return(false));
+  EXPECT_CALL(*reader, Finish()).WillOnce(Return(::grpc::Status::OK));
+
+  EXPECT_CALL(*stub, ListStatusStreamRaw(_, _))
+      .WillOnce(::testing::DoAll(::testing::SaveArg<1>(&intermediary_request),
+                                 Return(reader.release())));
+  client->ListStatusStream(request, responses);
+  ASSERT_EQ(intermediary_request.tx_hashes_size(), 2);
+  ASSERT_EQ(responses.size(), 3);
+  ASSERT_EQ(responses[0].tx_hash(), request.tx_hashes(0));
+  ASSERT_EQ(responses[1].tx_hash(), request.tx_hashes(1));
+  ASSERT_EQ(responses[2].tx_hash(), request.tx_hashes(1));
+}
@@ -9,6 +9,7 @@
 #include "torii/processor/query_processor.hpp"
 
 #include <gmock/gmock.h>
+#include "interfaces/query_responses/block_query_response.hpp"
 
 namespace iroha {
   namespace torii {
@@ -19,9 +20,8 @@ namespace iroha {
                    std::unique_ptr<shared_model::interface::QueryResponse>(
                        const shared_model::interface::Query &));
       MOCK_METHOD1(
-          blocksQueryHandle,
-          rxcpp::observable<
-              std::shared_ptr<shared_model::interface::BlockQueryResponse>>(
+          validateBlocksQuery,
+          std::unique_ptr<shared_model::interface::BlockQueryResponse>(
               const shared_model::interface::BlocksQuery &));
     };
 
@@ -9,14 +9,12 @@
 #include "backend/protobuf/query_responses/proto_error_query_response.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "cryptography/keypair.hpp"
-#include "framework/test_subscriber.hpp"
 #include "interfaces/query_responses/block_query_response.hpp"
 #include "module/irohad/ametsuchi/mock_block_query.hpp"
 #include "module/irohad/ametsuchi/mock_query_executor.hpp"
 #include "module/irohad/ametsuchi/mock_storage.hpp"
 #include "module/irohad/ametsuchi/mock_wsv_query.hpp"
 #include "module/irohad/validation/validation_mocks.hpp"
-#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_query_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 #include "network/ordering_gate.hpp"
@@ -27,7 +25,6 @@
 using namespace iroha;
 using namespace iroha::ametsuchi;
 using namespace iroha::validation;
-using namespace framework::test_subscriber;
 
 using ::testing::_;
 using ::testing::A;
@@ -42,7 +39,7 @@ class QueryProcessorTest : public ::testing::Test {
     query_response_factory =
         std::make_shared<shared_model::proto::ProtoQueryResponseFactory>();
     qpi = std::make_shared<torii::QueryProcessorImpl>(
-        storage, storage, nullptr, query_response_factory);
+        storage, nullptr, query_response_factory);
     EXPECT_CALL(*storage, getBlockQuery())
         .WillRepeatedly(Return(block_queries));
     EXPECT_CALL(*storage, createQueryExecutor(_, _))
@@ -137,55 +134,30 @@ TEST_F(QueryProcessorTest, QueryProcessorWithWrongKey) {
 /**
  * @given account, ametsuchi queries
  * @when valid block query is sent
- * @then Query Processor should start emitting BlockQueryResponses to the
- * observable
+ * @then Query Processor accepts the query
  */
 TEST_F(QueryProcessorTest, GetBlocksQuery) {
-  auto block_number = 5;
   auto block_query = getBlocksQuery(kAccountId);
 
   EXPECT_CALL(*qry_exec, validate(_, _)).WillOnce(Return(true));
 
-  auto wrapper = make_test_subscriber<CallExact>(
-      qpi->blocksQueryHandle(block_query), block_number);
-  wrapper.subscribe([](auto response) {
-    ASSERT_NO_THROW({
-      boost::get<const shared_model::interface::BlockResponse &>(
-          response->get());
-    });
-  });
-  for (int i = 0; i < block_number; i++) {
-    storage->notifier.get_subscriber().on_next(
-        clone(TestBlockBuilder().build()));
-  }
-  ASSERT_TRUE(wrapper.validate());
+  ASSERT_FALSE(qpi->validateBlocksQuery(block_query));
 }
 
 /**
  * @given account, ametsuchi queries
  * @when valid block query is invalid (no can_get_blocks permission)
- * @then Query Processor should return an observable with BlockError
+ * @then Query Processor should return BlockError
  */
 TEST_F(QueryProcessorTest, GetBlocksQueryNoPerms) {
-  auto block_number = 5;
   auto block_query = getBlocksQuery(kAccountId);
 
   EXPECT_CALL(*qry_exec, validate(_, _)).WillOnce(Return(false));
 
-  auto wrapper =
-      make_test_subscriber<CallExact>(qpi->blocksQueryHandle(block_query), 1);
-  wrapper.subscribe([](auto response) {
-    ASSERT_NO_THROW({
-      boost::get<const shared_model::interface::BlockErrorResponse &>(
-          response->get());
-    });
+  auto response = qpi->validateBlocksQuery(block_query);
+  ASSERT_TRUE(response);
+  ASSERT_NO_THROW({
+    boost::get<const shared_model::interface::BlockErrorResponse &>(
+        response->get());
   });
-  for (int i = 0; i < block_number; i++) {
-    storage->notifier.get_subscriber().on_next(
-        clone(TestBlockBuilder()
-                  .height(1)
-                  .prevHash(shared_model::crypto::Hash(std::string(32, '0')))
-                  .build()));
-  }
-  ASSERT_TRUE(wrapper.validate());
 }
@@ -54,8 +54,8 @@ class QueryServiceTest : public ::testing::Test {
   }
 
   void init() {
-    query_service =
-        std::make_shared<QueryService>(query_processor, query_factory);
+    query_service = std::make_shared<QueryService>(
+        query_processor, query_factory, nullptr);
   }
 
   std::unique_ptr<shared_model::interface::QueryResponse> getResponse() {
@@ -0,0 +1,172 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/submitted_transactions_registry.hpp"
+
+#include <gtest/gtest.h>
+
+using iroha::torii::SubmittedTransactionsRegistry;
+using shared_model::crypto::Hash;
+
+class SubmittedTransactionsRegistryTest : public ::testing::Test {
+ public:
+  Hash hash(char c) {
+    return Hash(std::string(32, c));
+  }
+
+  const std::string kConnection = "ipv4:127.0.0.1:50051";
+  const std::string kOtherConnection = "ipv4:127.0.0.1:50052";
+};
+
+/**
+ * @given registry with hashes submitted from two connections
+ * @when hashes of each connection are requested
+ * @then only the hashes of the connection are returned in submission order
+ */
+TEST_F(SubmittedTransactionsRegistryTest, SeparatesConnections) {
+  SubmittedTransactionsRegistry registry(10, 10);
+  auto stream = registry.attach(kConnection);
+  auto other_stream = registry.attach(kOtherConnection);
+  registry.add(kConnection, {hash('a'), hash('b')});
+  registry.add(kOtherConnection, {hash('c')});
+  registry.add(kConnection, {hash('a'), hash('d')});
+
+  ASSERT_EQ(registry.get(kConnection, stream),
+            (std::vector<Hash>{hash('a'), hash('b'), hash('d')}));
+  ASSERT_EQ(registry.get(kOtherConnection, other_stream),
+            (std::vector<Hash>{hash('c')}));
+  ASSERT_TRUE(registry.contains(kConnection, stream, hash('b')));
+  ASSERT_FALSE(registry.contains(kOtherConnection, other_stream, hash('b')));
+}
+
+/**
+ * @given registry limited to two hashes per connection
+ * @when three hashes are submitted
+ * @then the oldest one is forgotten
+ */
+TEST_F(SubmittedTransactionsRegistryTest, EvictsOldestHash) {
+  SubmittedTransactionsRegistry registry(10, 2);
+  auto stream = registry.attach(kConnection);
+  registry.add(kConnection, {hash('a'), hash('b'), hash('c')});
+
+  ASSERT_EQ(registry.get(kConnection, stream),
+            (std::vector<Hash>{hash('b'), hash('c')}));
+  ASSERT_FALSE(registry.contains(kConnection, stream, hash('a')));
+}
+
+/**
+ * @given registry limited to one connection
+ * @when the second connection submits a hash
+ * @then the first connection is forgotten
+ */
+TEST_F(SubmittedTransactionsRegistryTest, EvictsLeastRecentConnection) {
+  SubmittedTransactionsRegistry registry(1, 10);
+  auto stream = registry.attach(kConnection);
+  auto other_stream = registry.attach(kOtherConnection);
+  registry.add(kConnection, {hash('a')});
+  registry.add(kOtherConnection, {hash('b')});
+
+  ASSERT_TRUE(registry.get(kConnection, stream).empty());
+  ASSERT_EQ(registry.get(kOtherConnection, other_stream),
+            (std::vector<Hash>{hash('b')}));
+}
+
+/**
+ * @given registry with hashes of a connection
+ * @when all of them are removed
+ * @then nothing is remembered for the connection and removing again is a no-op
+ */
+TEST_F(SubmittedTransactionsRegistryTest, Remove) {
+  SubmittedTransactionsRegistry registry(10, 10);
+  auto stream = registry.attach(kConnection);
+  registry.add(kConnection, {hash('a'), hash('b')});
+  registry.remove(kConnection, stream, hash('a'));
+
+  ASSERT_EQ(registry.get(kConnection, stream), (std::vector<Hash>{hash('b')}));
+
+  registry.remove(kConnection, stream, hash('b'));
+  registry.remove(kConnection, stream, hash('b'));
+  registry.remove(kOtherConnection, stream, hash('b'));
+
+  ASSERT_TRUE(registry.get(kConnection, stream).empty());
+}
+
+/**
+ * @given registry with a status stream attached to one connection
+ * @when both connections submit hashes
+ * @then only the hashes of the attached connection are remembered
+ */
+TEST_F(SubmittedTransactionsRegistryTest, IgnoresDetachedConnections) {
+  SubmittedTransactionsRegistry registry(10, 10);
+  registry.add(kConnection, {hash('a')});
+  auto stream = registry.attach(kConnection);
+  registry.add(kConnection, {hash('b')});
+  registry.add(kOtherConnection, {hash('c')});
+
+  ASSERT_EQ(registry.get(kConnection, stream), (std::vector<Hash>{hash('b')}));
+  ASSERT_TRUE(registry.get(kOtherConnection, stream).empty());
+}
+
+/**
+ * @given registry with two status streams attached to a connection
+ * @when they are detached one by one
+ * @then the hashes are remembered until the last stream is detached
+ * AND nothing is remembered for the connection after that
+ */
+TEST_F(SubmittedTransactionsRegistryTest, ForgetsOnLastDetach) {
+  SubmittedTransactionsRegistry registry(10, 10);
+  auto first = registry.attach(kConnection);
+  auto second = registry.attach(kConnection);
+  registry.add(kConnection, {hash('a')});
+
+  registry.detach(kConnection, first);
+  ASSERT_EQ(registry.get(kConnection, second), (std::vector<Hash>{hash('a')}));
+
+  registry.detach(kConnection, second);
+  ASSERT_TRUE(registry.get(kConnection, second).empty());
+  registry.add(kConnection, {hash('b')});
+  ASSERT_TRUE(registry.get(kConnection, second).empty());
+}
+
+/**
+ * @given registry with two status streams attached to a connection
+ * @when one of them delivers the final status of a submitted hash
+ * @then the other stream still follows the hash
+ * AND the hash is forgotten when the other stream delivers it as well
+ */
+TEST_F(SubmittedTransactionsRegistryTest, StreamsFollowHashesSeparately) {
+  SubmittedTransactionsRegistry registry(10, 10);
+  auto first = registry.attach(kConnection);
+  auto second = registry.attach(kConnection);
+  registry.add(kConnection, {hash('a'), hash('b')});
+
+  registry.remove(kConnection, first, hash('a'));
+  ASSERT_FALSE(registry.contains(kConnection, first, hash('a')));
+  ASSERT_TRUE(registry.contains(kConnection, second, hash('a')));
+  ASSERT_EQ(registry.get(kConnection, first), (std::vector<Hash>{hash('b')}));
+
+  registry.remove(kConnection, second, hash('a'));
+  ASSERT_EQ(registry.get(kConnection, second), (std::vector<Hash>{hash('b')}));
+}
+
+/**
+ * @given registry with a status stream attached to a connection, which has
+ * delivered the final status of one of its hashes
+ * @when another stream is attached to the connection
+ * @then the new stream follows the hashes, which are still remembered
+ * AND they are not forgotten when the first stream is detached
+ */
+TEST_F(SubmittedTransactionsRegistryTest, AttachedStreamFollowsRemembered) {
+  SubmittedTransactionsRegistry registry(10, 10);
+  auto first = registry.attach(kConnection);
+  registry.add(kConnection, {hash('a'), hash('b')});
+  registry.remove(kConnection, first, hash('a'));
+
+  auto second = registry.attach(kConnection);
+  ASSERT_EQ(registry.get(kConnection, second), (std::vector<Hash>{hash('b')}));
+
+  registry.detach(kConnection, first);
+  ASSERT_TRUE(registry.contains(kConnection, second, hash('b')));
+}
@@ -73,11 +73,11 @@ class ToriiQueriesTest : public testing::Test {
             std::shared_ptr<QueryExecutor>(query_executor))));
 
     auto qpi = std::make_shared<iroha::torii::QueryProcessorImpl>(
-        storage, storage, pending_txs_storage, query_response_factory);
+        storage, pending_txs_storage, query_response_factory);
 
     //----------- Server run ----------------
     initQueryFactory();
-    runner->append(std::make_unique<QueryService>(qpi, query_factory))
+    runner->append(std::make_unique<QueryService>(qpi, query_factory, nullptr))
         .run()
         .match(
             [this](iroha::expected::Value<int> port) {
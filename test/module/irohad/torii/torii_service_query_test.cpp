@@ -12,6 +12,8 @@
 #include "builders/default_builders.hpp"
 #include "builders/protobuf/queries.hpp"
 #include "main/server_runner.hpp"
+#include "module/irohad/ametsuchi/mock_block_query.hpp"
+#include "module/irohad/ametsuchi/mock_block_query_factory.hpp"
 #include "module/irohad/torii/processor/mock_query_processor.hpp"
 #include "module/shared_model/builders/protobuf/test_query_builder.hpp"
 #include "torii/query_client.hpp"
@@ -21,6 +23,7 @@
 using ::testing::_;
 using ::testing::A;
 using ::testing::An;
+using ::testing::ByMove;
 using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::Truly;
@@ -35,12 +38,26 @@ class ToriiQueryServiceTest : public ::testing::Test {
 
     // ----------- Command Service --------------
     query_processor = std::make_shared<iroha::torii::MockQueryProcessor>();
+    block_query = std::make_shared<iroha::ametsuchi::MockBlockQuery>();
+    auto block_query_factory =
+        std::make_shared<iroha::ametsuchi::MockBlockQueryFactory>();
+    EXPECT_CALL(*block_query_factory, createBlockQuery())
+        .WillRepeatedly(Return(
+            boost::make_optional<std::shared_ptr<iroha::ametsuchi::BlockQuery>>(
+                block_query)));
+    EXPECT_CALL(*block_query, getTopBlockHeight())
+        .WillRepeatedly(Return(kTopHeight));
+    blocks_broadcast = std::make_shared<iroha::torii::BlocksBroadcast>(
+        commits.get_observable(),
+        block_query_factory,
+        1,
+        iroha::torii::BlocksBroadcast::OverflowPolicy::kDropOldest);
 
     //----------- Server run ----------------
     initQueryFactory();
     runner
-        ->append(std::make_unique<iroha::torii::QueryService>(query_processor,
-                                                              query_factory))
+        ->append(std::make_unique<iroha::torii::QueryService>(
+            query_processor, query_factory, blocks_broadcast))
         .run()
         .match(
             [this](iroha::expected::Value<int> port) {
@@ -68,8 +85,14 @@ class ToriiQueryServiceTest : public ::testing::Test {
                                      std::move(proto_query_validator));
   }
 
+  const shared_model::interface::types::HeightType kTopHeight = 123;
+
   std::unique_ptr<ServerRunner> runner;
   std::shared_ptr<iroha::torii::MockQueryProcessor> query_processor;
+  std::shared_ptr<iroha::ametsuchi::MockBlockQuery> block_query;
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
+      commits;
+  std::shared_ptr<iroha::torii::BlocksBroadcast> blocks_broadcast;
   std::shared_ptr<iroha::torii::QueryService::QueryFactoryType> query_factory;
 
   iroha::protocol::Block block;
@@ -82,10 +105,10 @@ class ToriiQueryServiceTest : public ::testing::Test {
 };
 
 /**
- * @given valid blocks query
- * @when blocks query is executed
- * @then valid blocks response is received and contains block emitted by query
- * processor
+ * @given valid blocks query from the height of the top block
+ * @when blocks query is executed and commits are over
+ * @then valid blocks response is received and contains the block read from
+ * the block store
  */
 TEST_F(ToriiQueryServiceTest, FetchBlocksWhenValidQuery) {
   auto blocks_query = std::make_shared<shared_model::proto::BlocksQuery>(
@@ -100,23 +123,24 @@ TEST_F(ToriiQueryServiceTest, FetchBlocksWhenValidQuery) {
           .finish());
 
   iroha::protocol::Block block;
-  block.mutable_block_v1()->mutable_payload()->set_height(123);
-  auto proto_block =
-      std::make_unique<shared_model::proto::Block>(block.block_v1());
-  std::shared_ptr<shared_model::interface::BlockQueryResponse> block_response =
-      shared_model::proto::ProtoQueryResponseFactory().createBlockQueryResponse(
-          std::move(proto_block));
+  block.mutable_block_v1()->mutable_payload()->set_height(kTopHeight);
 
   EXPECT_CALL(*query_processor,
-              blocksQueryHandle(Truly([&blocks_query](auto &query) {
+              validateBlocksQuery(Truly([&blocks_query](auto &query) {
                 return query == *blocks_query;
               })))
-      .WillOnce(Return(rxcpp::observable<>::just(block_response)));
+      .WillOnce(Return(ByMove(nullptr)));
+  EXPECT_CALL(*block_query, getBlocks(kTopHeight, 1))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::BlockQuery::wBlock>{
+          std::make_shared<shared_model::proto::Block>(block.block_v1())}));
+  commits.get_subscriber().on_completed();
 
   auto client = torii_utils::QuerySyncClient(ip, port);
   auto proto_blocks_query =
       std::static_pointer_cast<shared_model::proto::BlocksQuery>(blocks_query);
-  auto responses = client.FetchCommits(proto_blocks_query->getTransport());
+  auto request = proto_blocks_query->getTransport();
+  request.set_start_height(kTopHeight);
+  auto responses = client.FetchCommits(request);
 
   ASSERT_EQ(responses.size(), 1);
   auto response = responses.at(0);
@@ -131,7 +155,7 @@ TEST_F(ToriiQueryServiceTest, FetchBlocksWhenValidQuery) {
  * @then block error response is received
  */
 TEST_F(ToriiQueryServiceTest, FetchBlocksWhenInvalidQuery) {
-  EXPECT_CALL(*query_processor, blocksQueryHandle(_)).Times(0);
+  EXPECT_CALL(*query_processor, validateBlocksQuery(_)).Times(0);
 
   auto blocks_query = std::make_shared<shared_model::proto::BlocksQuery>(
       TestUnsignedBlocksQueryBuilder()
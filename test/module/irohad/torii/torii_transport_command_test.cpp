@@ -6,6 +6,7 @@
 #include "torii/impl/command_service_transport_grpc.hpp"
 
 #include <algorithm>
+#include <future>
 #include <iterator>
 #include <string>
 #include <utility>
@@ -25,10 +26,12 @@
 #include "module/shared_model/validators/validators.hpp"
 #include "module/vendor/grpc_mocks.hpp"
 #include "torii/impl/status_bus_impl.hpp"
+#include "torii/impl/transaction_intake.hpp"
 #include "validators/protobuf/proto_transaction_validator.hpp"
 
 using ::testing::_;
 using ::testing::A;
+using ::testing::DoAll;
 using ::testing::Invoke;
 using ::testing::Property;
 using ::testing::Return;
@@ -76,8 +79,18 @@ class CommandServiceTransportGrpcTest : public testing::Test {
     status_bus = std::make_shared<MockStatusBus>();
     command_service = std::make_shared<MockCommandService>();
 
+    initTransport(kIntakeCapacity);
+  }
+
+  /**
+   * Create the transport
+   * @param intake_capacity - how many batches may wait for the command service
+   */
+  void initTransport(size_t intake_capacity) {
     transport_grpc = std::make_shared<CommandServiceTransportGrpc>(
         command_service,
+        std::make_shared<TransactionIntake>(
+            command_service, intake_capacity, 1),
         status_bus,
         status_factory,
         transaction_factory,
@@ -108,6 +121,7 @@ class CommandServiceTransportGrpcTest : public testing::Test {
 
   const size_t kHashLength = 32;
   const size_t kTimes = 5;
+  const size_t kIntakeCapacity = 100;
 };
 
 /**
@@ -239,6 +253,43 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiPartialInvalid) {
   transport_grpc->ListTorii(&context, &request, &response);
 }
 
+/**
+ * @given torii service with room for one batch, which is being handled
+ * @when calling ListTorii
+ * @then RESOURCE_EXHAUSTED is returned and the batch is not handled
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiResourceExhausted) {
+  initTransport(1);
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+  iroha::protocol::TxList request;
+  request.add_transactions();
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .Times(2)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .Times(2)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+      .Times(2);
+
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  EXPECT_CALL(*command_service, handleTransactionBatch(_))
+      .WillOnce(Invoke([released](auto) { released.wait(); }));
+
+  auto accepted = transport_grpc->ListTorii(&context, &request, &response);
+  auto rejected = transport_grpc->ListTorii(&context, &request, &response);
+  release.set_value();
+
+  ASSERT_TRUE(accepted.ok());
+  ASSERT_EQ(rejected.error_code(), grpc::StatusCode::RESOURCE_EXHAUSTED);
+}
+
 /**
  * @given torii service and command_service with empty status stream
  * @when calling StatusStream on transport
@@ -288,3 +339,148 @@ TEST_F(CommandServiceTransportGrpcTest, StatusStreamOnNotReceived) {
                           &response_writer))
                   .ok());
 }
+
+/**
+ * @given torii service and two transactions which are not received yet
+ *        and a status bus which commits both of them
+ * @when calling ListStatusStream for both hashes
+ * @then ServerWriter is called once with the latest statuses of both
+ *       transactions coalesced into a single list
+ *       and the stream is completed once both statuses are final
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListStatusStreamCoalescesUpdates) {
+  grpc::ServerContext context;
+  iroha::protocol::TxStatusListRequest request;
+  iroha::MockServerWriter<iroha::protocol::ToriiResponseList> response_writer;
+
+  const shared_model::crypto::Hash hash1(std::string(kHashLength, '1'));
+  const shared_model::crypto::Hash hash2(std::string(kHashLength, '2'));
+  request.add_tx_hashes(hash1.hex());
+  request.add_tx_hashes(hash2.hex());
+
+  EXPECT_CALL(*command_service, getStatus(_))
+      .Times(2)
+      .WillRepeatedly(Invoke([this](const auto &hash) {
+        return status_factory->makeNotReceived(hash, {});
+      }));
+
+  std::vector<StatusBus::Objects> statuses{
+      status_factory->makeStatelessValid(hash1, {}),
+      status_factory->makeCommitted(hash1, {}),
+      status_factory->makeCommitted(hash2, {})};
+  EXPECT_CALL(*status_bus, statuses())
+      .WillOnce(Return(rxcpp::observable<>::iterate(statuses)));
+
+  iroha::protocol::ToriiResponseList written;
+  EXPECT_CALL(response_writer, Write(_, _))
+      .WillOnce(DoAll(::testing::SaveArg<0>(&written), Return(true)));
+
+  ASSERT_TRUE(
+      transport_grpc
+          ->ListStatusStream(
+              &context,
+              &request,
+              reinterpret_cast<
+                  grpc::ServerWriter<iroha::protocol::ToriiResponseList> *>(
+                  &response_writer))
+          .ok());
+
+  ASSERT_EQ(written.responses_size(), 2);
+  for (const auto &response : written.responses()) {
+    EXPECT_EQ(response.tx_status(), iroha::protocol::TxStatus::COMMITTED);
+  }
+  EXPECT_EQ(written.responses(0).tx_hash(), hash1.hex());
+  EXPECT_EQ(written.responses(1).tx_hash(), hash2.hex());
+}
+
+/**
+ * @given torii service and a transaction which is already committed
+ * @when calling ListStatusStream for its hash
+ * @then the committed status is written once
+ *       and the stream is completed without subscribing to the status bus
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListStatusStreamAlreadyFinal) {
+  grpc::ServerContext context;
+  iroha::protocol::TxStatusListRequest request;
+  iroha::MockServerWriter<iroha::protocol::ToriiResponseList> response_writer;
+
+  const shared_model::crypto::Hash hash(std::string(kHashLength, '1'));
+  request.add_tx_hashes(hash.hex());
+
+  EXPECT_CALL(*command_service, getStatus(hash))
+      .WillOnce(Return(status_factory->makeCommitted(hash, {})));
+  EXPECT_CALL(*status_bus, statuses()).Times(0);
+  EXPECT_CALL(response_writer,
+              Write(Property(&iroha::protocol::ToriiResponseList::responses_size,
+                             1),
+                    _))
+      .WillOnce(Return(true));
+
+  ASSERT_TRUE(
+      transport_grpc
+          ->ListStatusStream(
+              &context,
+              &request,
+              reinterpret_cast<
+                  grpc::ServerWriter<iroha::protocol::ToriiResponseList> *>(
+                  &response_writer))
+          .ok());
+}
+
+/**
+ * @given torii service and a status stream opened without hashes, but with
+ *        submitted_on_connection flag set
+ * @when a transaction is sent via ListTorii on the same connection
+ * @then the transaction is followed and its statuses are written
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListStatusStreamSubmittedOnConnection) {
+  grpc::ServerContext context;
+  shared_model::crypto::Hash hash;
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .WillOnce(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .WillOnce(Invoke([&hash](const auto &tx) {
+        hash = tx.hash();
+        return shared_model::validation::Answer{};
+      }));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+      .Times(1);
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(1);
+
+  iroha::protocol::TxStatusListRequest request;
+  request.set_submitted_on_connection(true);
+  iroha::MockServerWriter<iroha::protocol::ToriiResponseList> response_writer;
+
+  EXPECT_CALL(*status_bus, statuses()).WillOnce(Invoke([&] {
+    // the transaction is sent after the stream has started
+    google::protobuf::Empty empty;
+    iroha::protocol::TxList tx_list;
+    tx_list.add_transactions();
+    transport_grpc->ListTorii(&context, &tx_list, &empty);
+    return rxcpp::observable<>::just(
+        StatusBus::Objects(status_factory->makeCommitted(hash, {})));
+  }));
+
+  iroha::protocol::ToriiResponseList written;
+  EXPECT_CALL(response_writer, Write(_, _))
+      .WillOnce(DoAll(::testing::SaveArg<0>(&written), Return(true)));
+
+  ASSERT_TRUE(
+      transport_grpc
+          ->ListStatusStream(
+              &context,
+              &request,
+              reinterpret_cast<
+                  grpc::ServerWriter<iroha::protocol::ToriiResponseList> *>(
+                  &response_writer))
+          .ok());
+
+  ASSERT_EQ(written.responses_size(), 1);
+  EXPECT_EQ(written.responses(0).tx_hash(), hash.hex());
+  EXPECT_EQ(written.responses(0).tx_status(),
+            iroha::protocol::TxStatus::COMMITTED);
+}
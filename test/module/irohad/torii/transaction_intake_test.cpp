@@ -0,0 +1,132 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/transaction_intake.hpp"
+
+#include <future>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "module/irohad/torii/torii_mocks.hpp"
+
+using namespace iroha::torii;
+
+using ::testing::_;
+using ::testing::Invoke;
+
+class TransactionIntakeTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    command_service = std::make_shared<MockCommandService>();
+  }
+
+  /**
+   * Create the intake with one worker, which waits for the release in the
+   * first batch
+   * @param capacity - capacity of the intake
+   */
+  void initBlocked(size_t capacity) {
+    auto released = release.get_future().share();
+    EXPECT_CALL(*command_service, handleTransactionBatch(_))
+        .WillOnce(Invoke([released](auto) { released.wait(); }))
+        .WillRepeatedly(Invoke([](auto) {}));
+    intake = std::make_shared<TransactionIntake>(command_service, capacity, 1);
+  }
+
+  /// @return batches for push
+  std::vector<TransactionIntake::BatchPtr> batches(size_t count) {
+    return std::vector<TransactionIntake::BatchPtr>(count);
+  }
+
+  std::shared_ptr<MockCommandService> command_service;
+  std::promise<void> release;
+  std::shared_ptr<TransactionIntake> intake;
+};
+
+/**
+ * @given intake with several workers
+ * @when batches are pushed and the intake is destroyed
+ * @then all of them are passed to the command service
+ */
+TEST_F(TransactionIntakeTest, AllBatchesAreHandled) {
+  const size_t kBatches = 100;
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(kBatches);
+  intake = std::make_shared<TransactionIntake>(command_service, kBatches, 4);
+
+  for (size_t i = 0; i < kBatches; ++i) {
+    ASSERT_TRUE(intake->push(batches(1)));
+  }
+  intake.reset();
+}
+
+/**
+ * @given intake, which is full
+ * @when a batch is pushed
+ * @then the batch is rejected, and the rejection is counted
+ */
+TEST_F(TransactionIntakeTest, RejectedWhenFull) {
+  initBlocked(2);
+
+  auto first = intake->push(batches(2));
+  auto second = intake->push(batches(1));
+  auto metrics = intake->metrics();
+  release.set_value();
+
+  ASSERT_TRUE(first);
+  ASSERT_FALSE(second);
+  ASSERT_EQ(metrics.capacity, 2u);
+  ASSERT_EQ(metrics.occupancy, 2u);
+  ASSERT_EQ(metrics.max_occupancy, 2u);
+  ASSERT_EQ(metrics.accepted, 2u);
+  ASSERT_EQ(metrics.rejected, 1u);
+}
+
+/**
+ * @given intake with room for one more batch
+ * @when two batches of one request are pushed
+ * @then none of them are admitted, while a single batch is admitted
+ */
+TEST_F(TransactionIntakeTest, RequestIsAdmittedAsAWhole) {
+  initBlocked(3);
+
+  auto first = intake->push(batches(2));
+  auto second = intake->push(batches(2));
+  auto third = intake->push(batches(1));
+  release.set_value();
+
+  ASSERT_TRUE(first);
+  ASSERT_FALSE(second);
+  ASSERT_TRUE(third);
+}
+
+/**
+ * @given intake, whose only worker is busy
+ * @when a request with more batches than the capacity is pushed
+ * @then the request is admitted and its batches are handled before the push
+ * returns, without the worker
+ */
+TEST_F(TransactionIntakeTest, OversizedRequestIsHandledInPlace) {
+  std::promise<void> started;
+  auto released = release.get_future().share();
+  EXPECT_CALL(*command_service, handleTransactionBatch(_))
+      .WillOnce(Invoke([&started, released](auto) {
+        started.set_value();
+        released.wait();
+      }))
+      .WillRepeatedly(Invoke([](auto) {}));
+  intake = std::make_shared<TransactionIntake>(command_service, 2, 1);
+  ASSERT_TRUE(intake->push(batches(1)));
+  started.get_future().wait();
+
+  auto oversized = intake->push(batches(3));
+  auto metrics = intake->metrics();
+  release.set_value();
+
+  ASSERT_TRUE(oversized);
+  ASSERT_EQ(metrics.occupancy, 1u);
+  ASSERT_EQ(metrics.accepted, 4u);
+  ASSERT_EQ(metrics.handled_in_place, 3u);
+  ASSERT_EQ(metrics.rejected, 0u);
+}
@@ -0,0 +1,281 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/stateful_validator_impl.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <set>
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "datetime/time.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "module/irohad/ametsuchi/in_memory_temporary_wsv_stub.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validation/impl/transaction_access.hpp"
+
+using namespace iroha::validation;
+using namespace iroha::ametsuchi;
+
+namespace {
+  const std::string kAssetId = GenesisWsvStateLoaderStub::kAssetId;
+
+  std::string accountId(size_t i) {
+    return GenesisWsvStateLoaderStub::accountId(i);
+  }
+
+  /**
+   * Factory of in-memory temporary wsvs, of which only a limited number may
+   * exist at the same time, like temporary wsvs holding sessions of a
+   * connection pool. A released wsv goes to the latest waiting request, as a
+   * pool gives no guarantees of order.
+   */
+  class PooledTemporaryFactoryStub : public TemporaryFactory {
+   public:
+    PooledTemporaryFactoryStub(std::shared_ptr<WsvStateLoader> loader,
+                               size_t pool_size)
+        : loader_(std::move(loader)), pool_size_(pool_size) {}
+
+    iroha::expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+    createTemporaryWsv() override {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto ticket = next_ticket_++;
+      waiting_.insert(ticket);
+      released_.wait(lock, [this, ticket] {
+        return leased_ < pool_size_ and ticket == *waiting_.rbegin();
+      });
+      waiting_.erase(ticket);
+      ++leased_;
+      return iroha::expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+          std::make_unique<PooledTemporaryWsvStub>(loader_, *this));
+    }
+
+    void prepareBlock(std::unique_ptr<TemporaryWsv>) override {}
+
+   private:
+    class PooledTemporaryWsvStub : public InMemoryTemporaryWsvStub {
+     public:
+      PooledTemporaryWsvStub(std::shared_ptr<WsvStateLoader> loader,
+                             PooledTemporaryFactoryStub &pool)
+          : InMemoryTemporaryWsvStub(std::move(loader)), pool_(pool) {}
+
+      ~PooledTemporaryWsvStub() override {
+        {
+          std::lock_guard<std::mutex> lock(pool_.mutex_);
+          --pool_.leased_;
+        }
+        pool_.released_.notify_all();
+      }
+
+     private:
+      PooledTemporaryFactoryStub &pool_;
+    };
+
+    std::shared_ptr<WsvStateLoader> loader_;
+    const size_t pool_size_;
+    size_t leased_ = 0;
+    size_t next_ticket_ = 0;
+    std::set<size_t> waiting_;
+    std::mutex mutex_;
+    std::condition_variable released_;
+  };
+
+  /// outcome of validation, which has to be the same for any workers count
+  struct Outcome {
+    std::vector<std::string> verified_hashes;
+    /// hash, error code and command index of each rejected transaction
+    std::vector<std::tuple<std::string, uint32_t, size_t>> errors;
+    /// balances written by the validation
+    std::vector<std::string> balances;
+
+    bool operator==(const Outcome &other) const {
+      return verified_hashes == other.verified_hashes
+          and errors == other.errors and balances == other.balances;
+    }
+  };
+}  // namespace
+
+class ParallelStatefulValidatorTest : public ::testing::Test {
+ public:
+  static constexpr size_t kAccountsCount = 64;
+  /// accounts mostly transfer within clusters, which form independent groups
+  static constexpr size_t kClusterSize = 8;
+
+  /**
+   * Random transfers and asset additions between accounts; a part of them
+   * overdraws and fails, some of them form atomic batches and a few of them
+   * join clusters
+   */
+  shared_model::proto::Proposal makeProposal(unsigned seed,
+                                             size_t transactions_count) {
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<size_t> account(0, kAccountsCount - 1);
+    std::uniform_int_distribution<int> cents(1, 700);
+    std::uniform_int_distribution<size_t> in_cluster(0, kClusterSize - 1);
+    std::uniform_int_distribution<int> kind(0, 49);
+    auto amount = [&] {
+      auto value = cents(random);
+      return std::to_string(value / 100) + "." + std::to_string(value / 10 % 10)
+          + std::to_string(value % 10);
+    };
+    auto neighbour = [&](size_t account) {
+      return account / kClusterSize * kClusterSize + in_cluster(random);
+    };
+    auto transfer = [&](size_t creator, size_t dest, auto created_time) {
+      return TestTransactionBuilder()
+          .creatorAccountId(accountId(creator))
+          .createdTime(created_time)
+          .quorum(1)
+          .transferAsset(accountId(creator),
+                         accountId(dest),
+                         kAssetId,
+                         "",
+                         amount());
+    };
+
+    std::vector<shared_model::proto::Transaction> txs;
+    auto time = iroha::time::now();
+    while (txs.size() < transactions_count) {
+      auto creator = account(random);
+      auto tx_kind = kind(random);
+      if (tx_kind < 5) {
+        txs.push_back(TestTransactionBuilder()
+                          .creatorAccountId(accountId(creator))
+                          .createdTime(++time)
+                          .quorum(1)
+                          .addAssetQuantity(kAssetId, amount())
+                          .build());
+      } else if (tx_kind < 10) {
+        // atomic batch of two transfers
+        auto second_creator = neighbour(creator);
+        auto first = transfer(creator, neighbour(creator), ++time);
+        auto second =
+            transfer(second_creator, neighbour(second_creator), ++time);
+        std::vector<shared_model::interface::types::HashType> hashes{
+            first.build().reducedHash(), second.build().reducedHash()};
+        txs.push_back(
+            first
+                .batchMeta(shared_model::interface::types::BatchType::ATOMIC,
+                           hashes)
+                .build());
+        txs.push_back(
+            second
+                .batchMeta(shared_model::interface::types::BatchType::ATOMIC,
+                           hashes)
+                .build());
+      } else if (tx_kind == 10) {
+        txs.push_back(transfer(creator, account(random), ++time).build());
+      } else {
+        txs.push_back(transfer(creator, neighbour(creator), ++time).build());
+      }
+    }
+    return TestProposalBuilder()
+        .createdTime(iroha::time::now())
+        .height(2)
+        .transactions(txs)
+        .build();
+  }
+
+  /**
+   * @param merge - whether changes of workers are merged or their
+   * transactions are applied again
+   */
+  Outcome validate(const shared_model::proto::Proposal &proposal,
+                   size_t workers,
+                   bool merge = true) {
+    auto loader = std::make_shared<GenesisWsvStateLoaderStub>(kAccountsCount);
+    return validate(proposal,
+                    workers,
+                    loader,
+                    std::make_shared<InMemoryTemporaryFactoryStub>(loader),
+                    merge);
+  }
+
+  /**
+   * @param factory - source of temporary wsvs of workers
+   */
+  Outcome validate(const shared_model::proto::Proposal &proposal,
+                   size_t workers,
+                   std::shared_ptr<WsvStateLoader> loader,
+                   std::shared_ptr<TemporaryFactory> factory,
+                   bool merge) {
+    StatefulValidatorImpl validator(
+        std::make_unique<shared_model::proto::ProtoProposalFactory<
+            shared_model::validation::DefaultProposalValidator>>(),
+        std::make_shared<shared_model::interface::TransactionBatchParserImpl>(),
+        factory,
+        workers);
+    InMemoryTemporaryWsvStub wsv(loader);
+    wsv.merge_enabled = merge;
+
+    auto result = validator.validate(proposal, wsv);
+
+    Outcome outcome;
+    for (const auto &tx : result->verified_proposal->transactions()) {
+      outcome.verified_hashes.push_back(tx.hash().hex());
+    }
+    for (const auto &error : result->rejected_transactions) {
+      outcome.errors.emplace_back(
+          error.tx_hash.hex(), error.error.error_code, error.error.index);
+    }
+    for (const auto &balance : wsv.state->changes().balances) {
+      outcome.balances.push_back(std::get<0>(balance) + " "
+                                 + std::get<2>(balance).toString());
+    }
+    std::sort(outcome.balances.begin(), outcome.balances.end());
+    return outcome;
+  }
+};
+
+/**
+ * @given proposals of random transfers with conflicting and independent
+ * transactions
+ * @when they are validated sequentially and with several workers, whose
+ * changes are either merged or applied again
+ * @then verified transactions, errors and the resulting state are the same
+ */
+TEST_F(ParallelStatefulValidatorTest, SameOutcomeAsSequential) {
+  for (unsigned seed = 0; seed < 20; ++seed) {
+    auto proposal = makeProposal(seed, 200);
+    std::vector<AccessSet> accesses;
+    for (const auto &tx : proposal.transactions()) {
+      accesses.push_back(accessSetOf(tx));
+    }
+    auto groups = independentGroups(accesses);
+    ASSERT_LT(1u, std::set<size_t>(groups.begin(), groups.end()).size());
+
+    auto sequential = validate(proposal, 1);
+    ASSERT_FALSE(sequential.verified_hashes.empty());
+    ASSERT_FALSE(sequential.errors.empty());
+    for (size_t workers : {2, 3, 8}) {
+      EXPECT_TRUE(sequential == validate(proposal, workers))
+          << "seed " << seed << ", workers " << workers;
+      EXPECT_TRUE(sequential == validate(proposal, workers, false))
+          << "seed " << seed << ", workers " << workers << ", replayed";
+    }
+  }
+}
+
+/**
+ * @given proposal with many independent groups of transactions and a factory
+ * which can provide a temporary wsv to only one worker at a time
+ * @when the proposal is validated with several workers
+ * @then validation finishes, because a finished worker releases its wsv
+ * before the next worker is waited for, and the outcome is the same as with
+ * sequential validation
+ */
+TEST_F(ParallelStatefulValidatorTest, WorkersShareSmallPool) {
+  auto proposal = makeProposal(0, 200);
+  auto sequential = validate(proposal, 1);
+  for (auto merge : {true, false}) {
+    auto loader = std::make_shared<GenesisWsvStateLoaderStub>(kAccountsCount);
+    auto factory = std::make_shared<PooledTemporaryFactoryStub>(loader, 1);
+    EXPECT_TRUE(sequential == validate(proposal, 8, loader, factory, merge))
+        << "merge " << merge;
+  }
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/transaction_access.hpp"
+
+#include <gtest/gtest.h>
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::validation;
+
+namespace {
+  const std::string kAssetId = "coin#test";
+
+  std::string accountId(size_t i) {
+    return "user" + std::to_string(i) + "@test";
+  }
+}  // namespace
+
+/**
+ * @given transactions of different creators with disjoint accounts
+ * @when groups are built
+ * @then every transaction is in its own group
+ */
+TEST(TransactionAccessTest, DisjointTransactionsAreIndependent) {
+  std::vector<AccessSet> units;
+  for (size_t i = 0; i < 4; ++i) {
+    units.push_back(accessSetOf(TestTransactionBuilder()
+                                    .creatorAccountId(accountId(2 * i))
+                                    .createdTime(iroha::time::now())
+                                    .quorum(1)
+                                    .transferAsset(accountId(2 * i),
+                                                   accountId(2 * i + 1),
+                                                   kAssetId,
+                                                   "",
+                                                   "1.00")
+                                    .build()));
+  }
+
+  EXPECT_EQ(std::vector<size_t>({0, 1, 2, 3}), independentGroups(units));
+}
+
+/**
+ * @given transfers which read the same asset and a chain of transfers which
+ * share accounts
+ * @when groups are built
+ * @then reads of the asset do not join groups and the chain is in one group
+ */
+TEST(TransactionAccessTest, SharedAccountsJoinGroups) {
+  auto transfer = [](size_t src, size_t dest) {
+    return accessSetOf(TestTransactionBuilder()
+                           .creatorAccountId(accountId(src))
+                           .createdTime(iroha::time::now())
+                           .quorum(1)
+                           .transferAsset(accountId(src),
+                                          accountId(dest),
+                                          kAssetId,
+                                          "",
+                                          "1.00")
+                           .build());
+  };
+  std::vector<AccessSet> units{
+      transfer(0, 1), transfer(2, 3), transfer(1, 4), transfer(5, 6)};
+
+  EXPECT_TRUE(units[0].conflictsWith(units[2]));
+  EXPECT_FALSE(units[0].conflictsWith(units[1]));
+  EXPECT_EQ(std::vector<size_t>({0, 1, 0, 2}), independentGroups(units));
+}
+
+/**
+ * @given a transaction which creates an asset and a later one which only
+ * reads it
+ * @when groups are built
+ * @then both transactions are in the same group
+ */
+TEST(TransactionAccessTest, ReaderAfterWriterIsJoined) {
+  AccessSet create, first_reader, second_reader;
+  create.writes = {"asset/coin#test"};
+  first_reader.reads = {"asset/coin#test"};
+  second_reader.reads = {"asset/coin#test"};
+
+  EXPECT_EQ(std::vector<size_t>({0, 0, 0}),
+            independentGroups({create, first_reader, second_reader}));
+  EXPECT_EQ(std::vector<size_t>({0, 1}),
+            independentGroups({first_reader, second_reader}));
+}
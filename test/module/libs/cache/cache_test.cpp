@@ -179,3 +179,24 @@ TEST(CacheTest, InsertCustomSize) {
   ASSERT_TRUE(cache.findItem("key2"));
   ASSERT_EQ(cache.findItem("key2").value(), "value2");
 }
+
+/**
+ * @given cache with an item
+ * @when the item is added again only if it is absent
+ * @then its value is not replaced
+ * AND the item is evicted together with the items added at the same time
+ */
+TEST(CacheTest, AddIfAbsent) {
+  Cache<std::string, std::string> cache(2, 1);
+  ASSERT_TRUE(cache.addItemIfAbsent("key", "value"));
+  ASSERT_FALSE(cache.addItemIfAbsent("key", "other"));
+  ASSERT_EQ(cache.getCacheItemCount(), 1);
+  ASSERT_EQ(cache.findItem("key").value(), "value");
+
+  ASSERT_TRUE(cache.addItemIfAbsent("key2", "value2"));
+  ASSERT_TRUE(cache.addItemIfAbsent("key3", "value3"));
+  ASSERT_EQ(cache.getCacheItemCount(), cache.getIndexSizeLow());
+  ASSERT_FALSE(cache.findItem("key"));
+  ASSERT_FALSE(cache.findItem("key2"));
+  ASSERT_TRUE(cache.findItem("key3"));
+}
@@ -0,0 +1,97 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/bounded_mpmc_queue.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::BoundedMpmcQueue;
+
+/**
+ * @given empty queue
+ * @when elements are pushed until it is full and then popped
+ * @then the elements are popped in the same order, and the queue does not
+ * accept an element when it is full
+ */
+TEST(BoundedMpmcQueueTest, FifoUntilFull) {
+  BoundedMpmcQueue<int> queue(3);
+  ASSERT_EQ(queue.capacity(), 4u);
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.tryPush(int(i)));
+  }
+  ASSERT_FALSE(queue.tryPush(4));
+
+  for (int i = 0; i < 4; ++i) {
+    auto value = queue.tryPop();
+    ASSERT_TRUE(value);
+    ASSERT_EQ(*value, i);
+  }
+  ASSERT_FALSE(queue.tryPop());
+}
+
+/**
+ * @given queue, which was filled and emptied several times
+ * @when elements are pushed and popped one by one
+ * @then the cells are reused
+ */
+TEST(BoundedMpmcQueueTest, WrapsAround) {
+  BoundedMpmcQueue<int> queue(2);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(queue.tryPush(int(i)));
+    auto value = queue.tryPop();
+    ASSERT_TRUE(value);
+    ASSERT_EQ(*value, i);
+  }
+}
+
+/**
+ * @given several producers and consumers of the same queue
+ * @when every producer pushes its own range of elements
+ * @then every element is popped exactly once
+ */
+TEST(BoundedMpmcQueueTest, ConcurrentProducersAndConsumers) {
+  const int kThreads = 4;
+  const int kPerProducer = 10000;
+  BoundedMpmcQueue<int> queue(64);
+
+  std::vector<std::vector<int>> popped(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&queue, t] {
+      for (int i = t * kPerProducer; i < (t + 1) * kPerProducer; ++i) {
+        while (not queue.tryPush(int(i))) {
+          std::this_thread::yield();
+        }
+      }
+    });
+    threads.emplace_back([&queue, &popped, t] {
+      while (popped[t].size() < size_t(kPerProducer)) {
+        if (auto value = queue.tryPop()) {
+          popped[t].push_back(*value);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  std::vector<int> all;
+  for (const auto &values : popped) {
+    all.insert(all.end(), values.begin(), values.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), size_t(kThreads * kPerProducer));
+  for (int i = 0; i < kThreads * kPerProducer; ++i) {
+    ASSERT_EQ(all[i], i);
+  }
+}
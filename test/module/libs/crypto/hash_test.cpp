@@ -139,3 +139,45 @@ TEST(Hash, sha3_512_RU_text_LOOP) {
                  res.c_str());
   }
 }
+
+/**
+ * @given messages of different sizes, which are shorter than a block, fill
+ * exactly one or several blocks, or are longer than that
+ * @when they are hashed at once
+ * @then every digest is equal to the digest of the message hashed alone
+ */
+TEST(Hash, sha3_256_multiple_messages) {
+  std::vector<std::string> messages;
+  for (size_t size : {0, 1, 135, 136, 137, 271, 272, 1000, 30, 200, 5}) {
+    std::string message(size, 0);
+    for (size_t i = 0; i < size; ++i) {
+      message[i] = static_cast<char>(i * 7 + size);
+    }
+    messages.push_back(message);
+  }
+
+  for (size_t count = 0; count <= messages.size(); ++count) {
+    std::vector<iroha::hash256_t> digests(count);
+    std::vector<uint8_t *> outputs;
+    std::vector<const uint8_t *> inputs;
+    std::vector<size_t> sizes;
+    for (size_t i = 0; i < count; ++i) {
+      outputs.push_back(digests[i].data());
+      inputs.push_back(reinterpret_cast<const uint8_t *>(messages[i].data()));
+      sizes.push_back(messages[i].size());
+    }
+    sha3_256(outputs.data(), inputs.data(), sizes.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+      ASSERT_EQ(digests[i], sha3_256(messages[i])) << count << " " << i;
+    }
+  }
+}
+
+TEST(Hash, sha3_256_long_text) {
+  // 200 bytes of 0xa3 from NIST examples
+  std::string res =
+      "79f38adec5c20307a98ef76e8324afbfd46cfd81b22e3973c65fa1bd9de31787";
+  std::string str(200, '\xa3');
+  ASSERT_EQ(sha3_256(str).to_hexstring(), res);
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/proto_block_json_converter.hpp"
+
+#include <gtest/gtest.h>
+
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/transaction.hpp"
+
+using namespace shared_model;
+
+class ProtoBlockJsonConverterTest : public ::testing::Test {
+ public:
+  /// @return block with transactions of given creators
+  proto::Block makeBlock(const std::vector<std::string> &creators) {
+    iroha::protocol::Block_v1 block;
+    block.mutable_payload()->set_height(1);
+    for (const auto &creator : creators) {
+      auto tx = block.mutable_payload()->add_transactions();
+      auto payload = tx->mutable_payload()->mutable_reduced_payload();
+      payload->set_creator_account_id(creator);
+      payload->add_commands()->mutable_set_account_detail()->set_value(
+          "quote \" and brackets ]}");
+    }
+    return proto::Block(std::move(block));
+  }
+
+  proto::ProtoBlockJsonConverter converter;
+};
+
+/**
+ * @given json of a block with transactions
+ * @when positions of transactions are found
+ * @then each position holds json of the corresponding transaction
+ */
+TEST_F(ProtoBlockJsonConverterTest, TransactionPositions) {
+  auto block = makeBlock({"a@test", "b@test", "c@test"});
+  auto json = boost::get<iroha::expected::Value<std::string>>(
+                  converter.serialize(block))
+                  .value;
+
+  auto positions =
+      boost::get<iroha::expected::Value<
+          std::vector<interface::BlockJsonSerializer::TransactionPosition>>>(
+          converter.transactionPositions(json))
+          .value;
+
+  ASSERT_EQ(positions.size(), block.transactions().size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    auto tx = boost::get<iroha::expected::Value<
+        std::unique_ptr<interface::Transaction>>>(
+        converter.deserializeTransaction(
+            json.substr(positions[i].offset, positions[i].size)));
+    ASSERT_EQ(*tx.value, block.transactions()[i]);
+  }
+}
+
+/**
+ * @given json of a block without transactions
+ * @when positions of transactions are found
+ * @then there are no positions
+ */
+TEST_F(ProtoBlockJsonConverterTest, NoTransactionPositions) {
+  auto json = boost::get<iroha::expected::Value<std::string>>(
+                  converter.serialize(makeBlock({})))
+                  .value;
+
+  auto positions = converter.transactionPositions(json);
+
+  auto value = boost::get<iroha::expected::Value<
+      std::vector<interface::BlockJsonSerializer::TransactionPosition>>>(
+      &positions);
+  ASSERT_TRUE(value);
+  ASSERT_TRUE(value->value.empty());
+}
+
+/**
+ * @given truncated json of a block
+ * @when positions of transactions are found
+ * @then an error is returned
+ */
+TEST_F(ProtoBlockJsonConverterTest, MalformedJson) {
+  auto json = boost::get<iroha::expected::Value<std::string>>(
+                  converter.serialize(makeBlock({"a@test"})))
+                  .value;
+  json.resize(json.size() / 2);
+
+  auto positions = converter.transactionPositions(json);
+
+  ASSERT_TRUE(boost::get<iroha::expected::Error<std::string>>(&positions));
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/block.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "backend/protobuf/transaction.hpp"
+#include "backend/protobuf/util.hpp"
+#include "cryptography/hash_providers/sha3_256.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+using namespace shared_model;
+
+class ProtoBlockTest : public ::testing::Test {
+ public:
+  ProtoBlockTest() {
+    auto payload = transport.mutable_payload();
+    payload->set_height(1);
+    for (int i = 0; i < 3; ++i) {
+      payload->add_transactions()
+          ->mutable_payload()
+          ->mutable_reduced_payload()
+          ->set_creator_account_id("user" + std::to_string(i) + "@test");
+    }
+  }
+
+  iroha::protocol::Block_v1 transport;
+};
+
+/**
+ * @given block, which blob was already requested
+ * @when a signature is added to the block
+ * @then the blob contains the signature
+ */
+TEST_F(ProtoBlockTest, BlobIncludesAddedSignature) {
+  proto::Block block(transport);
+  auto blob_before = block.blob();
+
+  ASSERT_TRUE(block.addSignature(crypto::Signed("signature"),
+                                 crypto::PublicKey("public key")));
+
+  ASSERT_NE(block.blob(), blob_before);
+  ASSERT_EQ(block.blob(), proto::makeBlob(block.getTransport()));
+  ASSERT_EQ(boost::size(block.signatures()), 1);
+}
+
+/**
+ * @given block
+ * @when its transactions are requested from several threads at once
+ * @then all the threads get the same wrappers of the block transactions
+ */
+TEST_F(ProtoBlockTest, TransactionsAreSharedBetweenThreads) {
+  proto::Block block(transport);
+  std::vector<const interface::Transaction *> firsts(4);
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < firsts.size(); ++i) {
+    threads.emplace_back([&block, &firsts, i] {
+      firsts[i] = &*block.transactions().begin();
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (auto first : firsts) {
+    ASSERT_EQ(first, firsts.front());
+  }
+  ASSERT_EQ(boost::size(block.transactions()), 3);
+  ASSERT_EQ(block.transactions()[1].creatorAccountId(), "user1@test");
+}
+
+/**
+ * @given block
+ * @when hashes of its transactions are requested
+ * @then they are the hashes of the transaction payloads, as for transactions
+ * outside of a block
+ */
+TEST_F(ProtoBlockTest, TransactionHashesAreComputedAtOnce) {
+  proto::Block block(transport);
+
+  for (const auto &tx : block.transactions()) {
+    auto &transaction = static_cast<const proto::Transaction &>(tx);
+    ASSERT_EQ(tx.hash(), crypto::Sha3_256::makeHash(tx.payload()));
+    ASSERT_EQ(tx.hash(), proto::Transaction(transaction.getTransport()).hash());
+  }
+}
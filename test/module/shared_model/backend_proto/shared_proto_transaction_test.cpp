@@ -4,6 +4,7 @@
  */
 
 #include "backend/protobuf/transaction.hpp"
+#include "backend/protobuf/util.hpp"
 #include "builders/protobuf/transaction.hpp"
 #include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
@@ -102,3 +103,50 @@ TEST(ProtoTransaction, BuilderWithInvalidTx) {
                    .build(),
                std::invalid_argument);
 }
+
+/**
+ * @given transaction transport copied into an arena
+ * @when transaction is built over the shared transport AND the pointer to the
+ * transport is released
+ * @then the transaction keeps the arena alive AND equals to the transaction
+ * built over a heap copy of the transport
+ */
+TEST(ProtoTransaction, SharedArenaTransport) {
+  iroha::protocol::Transaction proto_tx = generateEmptyTransaction();
+  proto_tx.mutable_payload()
+      ->mutable_reduced_payload()
+      ->add_commands()
+      ->mutable_add_asset_quantity()
+      ->CopyFrom(generateAddAssetQuantity("coin#test"));
+
+  auto transport = shared_model::proto::makeArenaCopy(proto_tx);
+  ASSERT_NE(transport->GetArena(), nullptr);
+  shared_model::proto::Transaction arena_tx(std::move(transport));
+  shared_model::proto::Transaction heap_tx(proto_tx);
+
+  ASSERT_EQ(arena_tx.creatorAccountId(), creator_account_id);
+  ASSERT_EQ(boost::size(arena_tx.commands()), 1);
+  ASSERT_EQ(arena_tx.reducedHash(), heap_tx.reducedHash());
+  ASSERT_EQ(arena_tx.blob(), heap_tx.blob());
+}
+
+/**
+ * @given transaction which blob has already been requested
+ * @when a signature is added to the transaction
+ * @then the blob and the signatures reflect the added signature
+ */
+TEST(ProtoTransaction, AddSignatureUpdatesBlob) {
+  shared_model::proto::Transaction tx(generateEmptyTransaction());
+  const auto blob_before = tx.blob();
+  const auto hash_before = tx.hash();
+
+  auto keypair =
+      shared_model::crypto::CryptoProviderEd25519Sha3::generateKeypair();
+  auto signed_blob =
+      shared_model::crypto::CryptoSigner<>::sign(tx.payload(), keypair);
+  ASSERT_TRUE(tx.addSignature(signed_blob, keypair.publicKey()));
+
+  ASSERT_EQ(boost::size(tx.signatures()), 1);
+  ASSERT_NE(tx.blob(), blob_before);
+  ASSERT_EQ(tx.hash(), hash_before);
+}
@@ -0,0 +1,84 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace shared_model::crypto;
+
+namespace {
+  /**
+   * Algorithm, which accepts signatures equal to the source, and counts its
+   * verifications
+   */
+  struct CountingAlgorithm {
+    static bool verify(const Signed &signed_data,
+                       const Blob &source,
+                       const PublicKey &) {
+      ++verifications;
+      return signed_data.blob() == source.blob();
+    }
+
+    static size_t verifications;
+  };
+
+  size_t CountingAlgorithm::verifications = 0;
+
+  using Verifier = CryptoVerifier<CountingAlgorithm>;
+}  // namespace
+
+/**
+ * @given correct and wrong signatures
+ * @when they are verified twice
+ * @then only correct signatures are verified once and found in the cache
+ * after that, and the cache counters reflect it
+ */
+TEST(CryptoVerifierTest, CorrectSignaturesAreCached) {
+  const PublicKey key(std::string(32, 'k'));
+  const Blob source(std::string("source"));
+  const Signed correct(std::string("source"));
+  const Signed wrong(std::string("wrong"));
+  const auto verifications = CountingAlgorithm::verifications;
+  const auto metrics = Verifier::cacheMetrics();
+
+  ASSERT_TRUE(Verifier::verify(correct, source, key));
+  ASSERT_FALSE(Verifier::verify(wrong, source, key));
+  ASSERT_EQ(CountingAlgorithm::verifications, verifications + 2);
+
+  ASSERT_TRUE(Verifier::verify(correct, source, key));
+  ASSERT_FALSE(Verifier::verify(wrong, source, key));
+  ASSERT_EQ(CountingAlgorithm::verifications, verifications + 3);
+
+  // another key or source is a different triple
+  ASSERT_TRUE(
+      Verifier::verify(correct, source, PublicKey(std::string(32, 'l'))));
+  ASSERT_FALSE(Verifier::verify(correct, Blob(std::string("other")), key));
+  ASSERT_EQ(CountingAlgorithm::verifications, verifications + 5);
+
+  const auto new_metrics = Verifier::cacheMetrics();
+  ASSERT_EQ(new_metrics.hits, metrics.hits + 1);
+  ASSERT_EQ(new_metrics.misses, metrics.misses + 5);
+  ASSERT_EQ(new_metrics.size, metrics.size + 2);
+}
+
+/**
+ * @given a correct signature in the cache
+ * @when bytes are moved between the key, the signature and the source
+ * @then the triple is not found in the cache
+ */
+TEST(CryptoVerifierTest, BoundariesMatter) {
+  const PublicKey key(std::string("key"));
+  const Blob source(std::string("abcd"));
+  const Signed correct(std::string("abcd"));
+  ASSERT_TRUE(Verifier::verify(correct, source, key));
+
+  auto verifications = CountingAlgorithm::verifications;
+  ASSERT_FALSE(Verifier::verify(
+      Signed(std::string("abcda")), Blob(std::string("bcd")), key));
+  ASSERT_FALSE(Verifier::verify(
+      Signed(std::string("yabcd")), source, PublicKey(std::string("ke"))));
+  ASSERT_EQ(CountingAlgorithm::verifications, verifications + 2);
+}
@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/fixed_hash.hpp"
+
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+using namespace shared_model::crypto;
+
+/**
+ * @given 32 byte hash
+ * @when it is converted to FixedHash and back
+ * @then the result is equal to the original hash
+ */
+TEST(FixedHashTest, RoundTrip) {
+  Hash hash(std::string(31, 'a') + "b");
+  FixedHash fixed(hash);
+
+  ASSERT_EQ(fixed.size(), 32u);
+  ASSERT_EQ(fixed.toHash(), hash);
+  ASSERT_EQ(fixed.toHash().hex(), hash.hex());
+}
+
+/**
+ * @given hashes which differ only in length because of trailing zero bytes
+ * @when they are converted to FixedHash
+ * @then the results are not equal
+ */
+TEST(FixedHashTest, LengthMatters) {
+  Hash short_hash(std::string("ab"));
+  Hash long_hash(std::string("ab\0", 3));
+
+  ASSERT_NE(FixedHash(short_hash), FixedHash(long_hash));
+  ASSERT_TRUE(FixedHash(short_hash) < FixedHash(long_hash));
+}
+
+/**
+ * @given many distinct hashes, including ones sharing a long prefix
+ * @when they are inserted into an unordered set of FixedHash and then looked up
+ * @then every hash is found exactly once and Hash::Hasher agrees with
+ *       FixedHash::Hasher
+ */
+TEST(FixedHashTest, UnorderedSet) {
+  std::vector<Hash> hashes;
+  for (int i = 0; i < 1000; ++i) {
+    auto data = std::string(32, 'x');
+    data[31] = static_cast<char>(i % 256);
+    data[30] = static_cast<char>(i / 256);
+    hashes.emplace_back(data);
+  }
+
+  std::unordered_set<FixedHash, FixedHash::Hasher> set;
+  for (const auto &hash : hashes) {
+    ASSERT_TRUE(set.emplace(hash).second);
+  }
+  for (const auto &hash : hashes) {
+    ASSERT_EQ(set.count(FixedHash(hash)), 1u);
+    ASSERT_EQ(Hash::Hasher{}(hash), FixedHash::Hasher{}(FixedHash(hash)));
+  }
+  ASSERT_FALSE(set.emplace(hashes.front()).second);
+}
+
+/**
+ * @given blobs longer than FixedHash capacity, including 256 + 32 bytes which
+ *        would wrap to a valid size when narrowed to one byte
+ * @when they are converted to FixedHash
+ * @then conversion fails instead of truncating the blob
+ */
+TEST(FixedHashTest, OversizedBlobRejected) {
+  Hash longer(std::string(FixedHash::kMaxSize + 1, 'a'));
+  Hash wrapping(std::string(256 + FixedHash::kMaxSize, 'a'));
+
+  ASSERT_THROW(FixedHash{longer}, std::length_error);
+  ASSERT_THROW(FixedHash{wrapping}, std::length_error);
+}
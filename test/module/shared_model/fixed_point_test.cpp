@@ -0,0 +1,171 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "interfaces/common_objects/fixed_point.hpp"
+
+#include <random>
+#include <regex>
+
+#include <gtest/gtest.h>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "interfaces/common_objects/amount.hpp"
+
+using shared_model::interface::Amount;
+using shared_model::interface::FixedPoint;
+using boost::multiprecision::cpp_int;
+
+namespace {
+  /// parsing result of the former regex-based Amount
+  struct ReferenceAmount {
+    bool matched;
+    cpp_int value;
+    size_t precision;
+  };
+
+  ReferenceAmount parseWithRegex(const std::string &amount) {
+    static const std::regex r("([0-9]+)(\\.([0-9]+))?");
+    std::smatch match;
+    if (not std::regex_match(amount, match, r)) {
+      return {false, 0, 0};
+    }
+    auto str = match[0].str();
+    size_t pos = match[1].length();
+    if (pos < str.size()) {
+      str.erase(str.begin() + pos);
+    }
+    str.erase(0, std::min(str.find_first_not_of('0'), str.size() - 1));
+    return {true, cpp_int(str), static_cast<size_t>(match[3].length())};
+  }
+
+  cpp_int toInteger(const FixedPoint &value) {
+    cpp_int result;
+    for (auto word = value.words().rbegin(); word != value.words().rend();
+         ++word) {
+      result = (result << 64) | *word;
+    }
+    return result;
+  }
+
+  FixedPoint parse(const std::string &str) {
+    auto value = FixedPoint::fromString(str);
+    EXPECT_TRUE(value) << str;
+    return value.value_or(FixedPoint{});
+  }
+}  // namespace
+
+/**
+ * @given random strings of digits and points, which are numbers or not
+ * @when they are parsed by Amount and by the former regex-based parser
+ * @then both agree on the value and precision of numbers, which fit 256
+ * bits, and other strings make zero amounts
+ */
+TEST(FixedPointTest, MatchesRegexParsing) {
+  std::mt19937 random(42);
+  const std::string alphabet = "0123456789.x";
+  const auto make_string = [&random](const std::string &chars, size_t size) {
+    std::string str(random() % size, '0');
+    for (auto &c : str) {
+      c = chars[random() % chars.size()];
+    }
+    return str;
+  };
+  const cpp_int limit = cpp_int(1) << 256;
+  size_t numbers = 0;
+
+  for (int i = 0; i < 100000; ++i) {
+    std::string str;
+    switch (random() % 3) {
+      case 0:
+        str = make_string("0123456789", 90);
+        break;
+      case 1:
+        str = make_string("0123456789", 80) + "."
+            + make_string("0123456789", 80);
+        break;
+      default:
+        str = make_string(alphabet, 20);
+    }
+
+    auto reference = parseWithRegex(str);
+    Amount amount(str);
+    if (not reference.matched) {
+      ASSERT_TRUE(amount.value()) << str;
+      ASSERT_TRUE(amount.value()->isZero()) << str;
+      continue;
+    }
+    ++numbers;
+    ASSERT_EQ(amount.precision(), reference.precision) << str;
+    if (reference.value >= limit) {
+      ASSERT_FALSE(amount.value()) << str;
+      ASSERT_EQ(amount.toStringRepr(), str);
+      continue;
+    }
+    ASSERT_TRUE(amount.value()) << str;
+    ASSERT_EQ(toInteger(*amount.value()), reference.value) << str;
+    ASSERT_EQ(Amount(amount.toStringRepr()), amount) << str;
+  }
+  ASSERT_GT(numbers, 1000);
+}
+
+/**
+ * @given numbers with and without leading and trailing zeros
+ * @when they are formatted
+ * @then all the digits after the point are kept and leading zeros are not
+ */
+TEST(FixedPointTest, Format) {
+  ASSERT_EQ(parse("0").toString(), "0");
+  ASSERT_EQ(parse("000.0500").toString(), "0.0500");
+  ASSERT_EQ(parse("12345678901234567890.5").toString(),
+            "12345678901234567890.5");
+  auto max = "115792089237316195423570985008687907853269984665640564039457584"
+             "007913129639935";  // 2**256 - 1
+  ASSERT_EQ(parse(max).toString(), max);
+  ASSERT_FALSE(FixedPoint::fromString(
+      "115792089237316195423570985008687907853269984665640564039457584"
+      "007913129639936"));
+}
+
+/**
+ * @given numbers with different precisions
+ * @when they are added and subtracted
+ * @then results have the greater precision, and overflow and negative
+ * results are reported
+ */
+TEST(FixedPointTest, Arithmetic) {
+  ASSERT_EQ(parse("1.5").add(parse("2.25"))->toString(), "3.75");
+  ASSERT_EQ(parse("10").subtract(parse("0.01"))->toString(), "9.99");
+  ASSERT_EQ(parse("1.50").subtract(parse("1.5"))->toString(), "0.00");
+  ASSERT_FALSE(parse("1").subtract(parse("1.01")));
+
+  auto max = parse(
+      "115792089237316195423570985008687907853269984665640564039457584"
+      "007913129639935");
+  ASSERT_FALSE(max.add(parse("1")));
+  ASSERT_FALSE(max.add(parse("0.1")));
+  ASSERT_EQ(max.subtract(max)->toString(), "0");
+}
+
+/**
+ * @given numbers with different precisions
+ * @when they are compared or their precision is changed
+ * @then values are compared regardless of precisions, and digits are never
+ * lost
+ */
+TEST(FixedPointTest, CompareAndPrecision) {
+  ASSERT_EQ(parse("1.50").compare(parse("1.5")), 0);
+  ASSERT_NE(parse("1.50"), parse("1.5"));
+  ASSERT_LT(parse("1.49").compare(parse("1.5")), 0);
+  ASSERT_GT(parse("2").compare(parse("1.999")), 0);
+
+  auto max = parse(
+      "115792089237316195423570985008687907853269984665640564039457584"
+      "007913129639935");
+  ASSERT_GT(max.compare(parse("0.5")), 0);
+  ASSERT_LT(parse("0.5").compare(max), 0);
+
+  ASSERT_EQ(parse("1.500").withPrecision(1)->toString(), "1.5");
+  ASSERT_FALSE(parse("1.55").withPrecision(1));
+  ASSERT_FALSE(max.withPrecision(1));
+}
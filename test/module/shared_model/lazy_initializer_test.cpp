@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "utils/lazy_initializer.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using shared_model::detail::makeLazyInitializer;
+
+/**
+ * @given lazy initializer with a counting generator
+ * @when value is not accessed
+ * @then generator is not called
+ */
+TEST(LazyInitializer, NotAccessed) {
+  int calls = 0;
+  auto lazy = makeLazyInitializer([&calls] { return ++calls; });
+  ASSERT_EQ(calls, 0);
+}
+
+/**
+ * @given lazy initializer with a counting generator
+ * @when value is accessed several times
+ * @then generator is called only once
+ */
+TEST(LazyInitializer, GeneratedOnce) {
+  int calls = 0;
+  auto lazy = makeLazyInitializer([&calls] { return ++calls; });
+  ASSERT_EQ(*lazy, 1);
+  ASSERT_EQ(*lazy, 1);
+  ASSERT_EQ(calls, 1);
+}
+
+/**
+ * @given accessed lazy initializer
+ * @when it is invalidated and accessed again
+ * @then value is generated again
+ */
+TEST(LazyInitializer, Invalidate) {
+  int calls = 0;
+  auto lazy = makeLazyInitializer([&calls] { return ++calls; });
+  ASSERT_EQ(*lazy, 1);
+  lazy.invalidate();
+  ASSERT_EQ(*lazy, 2);
+  ASSERT_EQ(calls, 2);
+}
+
+/**
+ * @given lazy initializer with a counting generator
+ * @when value is accessed from several threads at once
+ * @then generator is called only once AND all threads see the same value
+ */
+TEST(LazyInitializer, ConcurrentAccess) {
+  std::atomic<int> calls{0};
+  auto lazy = makeLazyInitializer([&calls] {
+    std::this_thread::yield();
+    return ++calls;
+  });
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&lazy] { ASSERT_EQ(*lazy, 1); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(calls.load(), 1);
+}
@@ -0,0 +1,157 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+#include "module/shared_model/validators/field_regexes.hpp"
+
+class FieldMatchersTest : public ::testing::Test {
+ public:
+  /**
+   * Checks that every matcher agrees with its reference regex on given input
+   */
+  void checkAll(const std::string &input) {
+    for (const auto &c : regexes.cases) {
+      ASSERT_EQ(std::regex_match(input, c.regex), c.matcher(input))
+          << "Field: " << c.name << "\nInput: '" << input << "'";
+    }
+  }
+
+  /// random string over an alphabet which is relevant to the grammar
+  std::string randomString(size_t max_length) {
+    static const std::string alphabet =
+        "abcxyzABCXYZ0123456789_-.@#:0159.-a:\x7f\xff";
+    std::uniform_int_distribution<size_t> length_dist(0, max_length);
+    std::uniform_int_distribution<size_t> char_dist(0, alphabet.size() - 1);
+    std::string result(length_dist(engine), ' ');
+    for (auto &c : result) {
+      c = alphabet[char_dist(engine)];
+    }
+    return result;
+  }
+
+  /// random single-character mutation of the given string
+  std::string mutate(std::string input) {
+    const auto noise = randomString(2);
+    if (input.empty()) {
+      return noise;
+    }
+    std::uniform_int_distribution<size_t> pos_dist(0, input.size() - 1);
+    const auto pos = pos_dist(engine);
+    switch (engine() % 3) {
+      case 0:
+        input.erase(pos, 1);
+        break;
+      case 1:
+        input.insert(pos, noise);
+        break;
+      default:
+        input.replace(pos, 1, noise);
+        break;
+    }
+    return input;
+  }
+
+  FieldRegexes regexes;
+  std::mt19937 engine{42};
+};
+
+/**
+ * @given hand-picked boundary inputs for every field
+ * @when they are checked by matchers and by reference regexes
+ * @then both give the same answers
+ */
+TEST_F(FieldMatchersTest, BoundaryCases) {
+  const std::string label63(63, 'a');
+  const std::string label64(64, 'a');
+  for (const auto &input : std::vector<std::string>{
+           "",
+           "a",
+           std::string(32, 'a'),
+           std::string(33, 'a'),
+           std::string(64, 'A'),
+           std::string(65, 'A'),
+           "_",
+           "a-b",
+           "-ab",
+           "ab-",
+           "a.b",
+           "a..b",
+           ".a",
+           "a.",
+           "1a",
+           label63,
+           label64,
+           label63 + "." + label63,
+           "a" + std::string(61, '-') + "a",
+           "user@domain",
+           "user@@domain",
+           "@domain",
+           "user@",
+           "user@1domain",
+           "coin#domain",
+           "coin#domain#x",
+           "0.0.0.0:0",
+           "255.255.255.255:65535",
+           "256.0.0.1:1",
+           "01.0.0.1:1",
+           "1.2.3:1",
+           "1.2.3.4.5:1",
+           "1.2.3.4:65536",
+           "1.2.3.4:00",
+           "1.2.3.4:01",
+           "1.2.3.4:",
+           "1.2.3.4",
+           "localhost:50051",
+           "local-host.example.com:8080",
+           "localhost:50051:1",
+           "localhost::1",
+           ":1",
+           "1.2.3.4",
+           "1.2.3.04",
+           std::string("a\0b", 3),
+           "deadBEEF",
+           "xyz"}) {
+    checkAll(input);
+  }
+}
+
+/**
+ * @given random strings over the relevant alphabet
+ * @when they are checked by matchers and by reference regexes
+ * @then both give the same answers
+ */
+TEST_F(FieldMatchersTest, RandomStrings) {
+  for (int i = 0; i < 20000; ++i) {
+    checkAll(randomString(80));
+  }
+}
+
+/**
+ * @given random mutations of valid values of every field
+ * @when they are checked by matchers and by reference regexes
+ * @then both give the same answers
+ */
+TEST_F(FieldMatchersTest, MutatedValidValues) {
+  const std::vector<std::string> seeds{"admin",
+                                       "some_detail_Key_1",
+                                       "sub.domain-1.test",
+                                       "127.0.0.1",
+                                       "127.0.0.1:10001",
+                                       "peer-1.iroha.tech:65535",
+                                       "admin@test",
+                                       "coin#sub.test",
+                                       "0123456789abcdefABCDEF"};
+  for (const auto &seed : seeds) {
+    auto input = seed;
+    for (int i = 0; i < 2000; ++i) {
+      input = (i % 8 == 0) ? seed : mutate(input);
+      checkAll(input);
+    }
+  }
+}
@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TEST_FIELD_REGEXES_HPP
+#define IROHA_TEST_FIELD_REGEXES_HPP
+
+#include <functional>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "validators/field_matchers.hpp"
+
+/**
+ * Reference std::regex grammar which FieldValidator used before the
+ * hand-written matchers were introduced. Serves as an oracle for
+ * differential tests, fuzzing and benchmarks of the matchers.
+ */
+struct FieldRegexes {
+  const std::string account_name_pattern = R"#([a-z_0-9]{1,32})#";
+  const std::string domain_pattern =
+      R"#(([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*[a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#";
+  const std::string ip_v4_pattern =
+      R"#(^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\.){3})#"
+      R"#(([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])))#";
+  const std::string peer_address_pattern = "((" + ip_v4_pattern + ")|("
+      + domain_pattern + ")):"
+      + R"#((6553[0-5]|655[0-2]\d|65[0-4]\d\d|6[0-4]\d{3}|[1-5]\d{4}|[1-9]\d{0,3}|0)$)#";
+  const std::string account_id_pattern =
+      account_name_pattern + R"#(\@)#" + domain_pattern;
+  const std::string asset_id_pattern =
+      account_name_pattern + R"#(\#)#" + domain_pattern;
+  const std::string detail_key_pattern = R"([A-Za-z0-9_]{1,64})";
+  const std::string hex_pattern = R"([0-9a-fA-F]*)";
+
+  /// matcher under test paired with its reference regex
+  struct Case {
+    std::string name;
+    std::regex regex;
+    std::function<bool(const std::string &)> matcher;
+  };
+
+  const std::vector<Case> cases{
+      {"account_name",
+       std::regex(account_name_pattern),
+       shared_model::validation::matchers::isAccountName},
+      {"asset_name",
+       std::regex(account_name_pattern),
+       shared_model::validation::matchers::isAssetName},
+      {"role_id",
+       std::regex(account_name_pattern),
+       shared_model::validation::matchers::isRoleId},
+      {"detail_key",
+       std::regex(detail_key_pattern),
+       shared_model::validation::matchers::isDetailKey},
+      {"domain",
+       std::regex(domain_pattern),
+       shared_model::validation::matchers::isDomain},
+      {"ip_v4",
+       std::regex(ip_v4_pattern),
+       shared_model::validation::matchers::isIpV4},
+      {"peer_address",
+       std::regex(peer_address_pattern),
+       shared_model::validation::matchers::isPeerAddress},
+      {"account_id",
+       std::regex(account_id_pattern),
+       shared_model::validation::matchers::isAccountId},
+      {"asset_id",
+       std::regex(asset_id_pattern),
+       shared_model::validation::matchers::isAssetId},
+      {"hex",
+       std::regex(hex_pattern),
+       shared_model::validation::matchers::isHexString}};
+};
+
+#endif  // IROHA_TEST_FIELD_REGEXES_HPP